@@ -26,6 +26,7 @@ ME_COM_OSDEP          ?= 1
 ME_COM_PCRE           ?= 1
 ME_COM_SSL            ?= 1
 ME_COM_VXWORKS        ?= 0
+ME_HTTP_COMPRESS      ?= 1
 
 ME_COM_OPENSSL_PATH   ?= "/path/to/openssl"
 
@@ -116,6 +117,7 @@ clean:
 	rm -f "$(BUILD)/obj/cache.o"
 	rm -f "$(BUILD)/obj/chunkFilter.o"
 	rm -f "$(BUILD)/obj/client.o"
+	rm -f "$(BUILD)/obj/compressFilter.o"
 	rm -f "$(BUILD)/obj/config.o"
 	rm -f "$(BUILD)/obj/digest.o"
 	rm -f "$(BUILD)/obj/dirHandler.o"
@@ -141,6 +143,7 @@ clean:
 	rm -f "$(BUILD)/obj/pcre.o"
 	rm -f "$(BUILD)/obj/pipeline.o"
 	rm -f "$(BUILD)/obj/process.o"
+	rm -f "$(BUILD)/obj/proxyHandler.o"
 	rm -f "$(BUILD)/obj/queue.o"
 	rm -f "$(BUILD)/obj/rangeFilter.o"
 	rm -f "$(BUILD)/obj/route.o"
@@ -305,6 +308,16 @@ $(BUILD)/obj/client.o: \
 	@echo '   [Compile] $(BUILD)/obj/client.o'
 	$(CC) -c -o $(BUILD)/obj/client.o $(LDFLAGS) $(DFLAGS) -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" -DME_COM_OPENSSL_PATH=$(ME_COM_OPENSSL_PATH) $(IFLAGS) "-I$(ME_COM_OPENSSL_PATH)/include" src/client.c
 
+#
+#   compressFilter.o
+#
+DEPS_77 += src/http.h
+
+$(BUILD)/obj/compressFilter.o: \
+    src/compressFilter.c $(DEPS_77)
+	@echo '   [Compile] $(BUILD)/obj/compressFilter.o'
+	$(CC) -c -o $(BUILD)/obj/compressFilter.o $(LDFLAGS) $(DFLAGS) -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" -DME_COM_OPENSSL_PATH=$(ME_COM_OPENSSL_PATH) $(IFLAGS) "-I$(ME_COM_OPENSSL_PATH)/include" src/compressFilter.c
+
 #
 #   config.o
 #
@@ -576,6 +589,16 @@ $(BUILD)/obj/process.o: \
 	@echo '   [Compile] $(BUILD)/obj/process.o'
 	$(CC) -c -o $(BUILD)/obj/process.o $(LDFLAGS) $(DFLAGS) -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" -DME_COM_OPENSSL_PATH=$(ME_COM_OPENSSL_PATH) $(IFLAGS) "-I$(ME_COM_OPENSSL_PATH)/include" src/process.c
 
+#
+#   proxyHandler.o
+#
+DEPS_78 += src/http.h
+
+$(BUILD)/obj/proxyHandler.o: \
+    src/proxyHandler.c $(DEPS_78)
+	@echo '   [Compile] $(BUILD)/obj/proxyHandler.o'
+	$(CC) -c -o $(BUILD)/obj/proxyHandler.o $(LDFLAGS) $(DFLAGS) -D_FILE_OFFSET_BITS=64 -DMBEDTLS_USER_CONFIG_FILE=\"embedtls.h\" -DME_COM_OPENSSL_PATH=$(ME_COM_OPENSSL_PATH) $(IFLAGS) "-I$(ME_COM_OPENSSL_PATH)/include" src/proxyHandler.c
+
 #
 #   queue.o
 #
@@ -830,6 +853,7 @@ DEPS_65 += $(BUILD)/obj/basic.o
 DEPS_65 += $(BUILD)/obj/cache.o
 DEPS_65 += $(BUILD)/obj/chunkFilter.o
 DEPS_65 += $(BUILD)/obj/client.o
+DEPS_65 += $(BUILD)/obj/compressFilter.o
 DEPS_65 += $(BUILD)/obj/config.o
 DEPS_65 += $(BUILD)/obj/digest.o
 DEPS_65 += $(BUILD)/obj/dirHandler.o
@@ -849,6 +873,7 @@ DEPS_65 += $(BUILD)/obj/pam.o
 DEPS_65 += $(BUILD)/obj/passHandler.o
 DEPS_65 += $(BUILD)/obj/pipeline.o
 DEPS_65 += $(BUILD)/obj/process.o
+DEPS_65 += $(BUILD)/obj/proxyHandler.o
 DEPS_65 += $(BUILD)/obj/queue.o
 DEPS_65 += $(BUILD)/obj/rangeFilter.o
 DEPS_65 += $(BUILD)/obj/route.o
@@ -869,7 +894,7 @@ DEPS_65 += $(BUILD)/obj/webSockFilter.o
 
 $(BUILD)/bin/libhttp.a: $(DEPS_65)
 	@echo '      [Link] $(BUILD)/bin/libhttp.a'
-	$(AR) -cr $(BUILD)/bin/libhttp.a "$(BUILD)/obj/actionHandler.o" "$(BUILD)/obj/auth.o" "$(BUILD)/obj/basic.o" "$(BUILD)/obj/cache.o" "$(BUILD)/obj/chunkFilter.o" "$(BUILD)/obj/client.o" "$(BUILD)/obj/config.o" "$(BUILD)/obj/digest.o" "$(BUILD)/obj/dirHandler.o" "$(BUILD)/obj/endpoint.o" "$(BUILD)/obj/error.o" "$(BUILD)/obj/fileHandler.o" "$(BUILD)/obj/host.o" "$(BUILD)/obj/hpack.o" "$(BUILD)/obj/http1Filter.o" "$(BUILD)/obj/http2Filter.o" "$(BUILD)/obj/huff.o" "$(BUILD)/obj/monitor.o" "$(BUILD)/obj/net.o" "$(BUILD)/obj/netConnector.o" "$(BUILD)/obj/packet.o" "$(BUILD)/obj/pam.o" "$(BUILD)/obj/passHandler.o" "$(BUILD)/obj/pipeline.o" "$(BUILD)/obj/process.o" "$(BUILD)/obj/queue.o" "$(BUILD)/obj/rangeFilter.o" "$(BUILD)/obj/route.o" "$(BUILD)/obj/rx.o" "$(BUILD)/obj/server.o" "$(BUILD)/obj/service.o" "$(BUILD)/obj/session.o" "$(BUILD)/obj/stage.o" "$(BUILD)/obj/stream.o" "$(BUILD)/obj/tailFilter.o" "$(BUILD)/obj/trace.o" "$(BUILD)/obj/tx.o" "$(BUILD)/obj/uploadFilter.o" "$(BUILD)/obj/uri.o" "$(BUILD)/obj/user.o" "$(BUILD)/obj/var.o" "$(BUILD)/obj/webSockFilter.o"
+	$(AR) -cr $(BUILD)/bin/libhttp.a "$(BUILD)/obj/actionHandler.o" "$(BUILD)/obj/auth.o" "$(BUILD)/obj/basic.o" "$(BUILD)/obj/cache.o" "$(BUILD)/obj/chunkFilter.o" "$(BUILD)/obj/client.o" "$(BUILD)/obj/compressFilter.o" "$(BUILD)/obj/config.o" "$(BUILD)/obj/digest.o" "$(BUILD)/obj/dirHandler.o" "$(BUILD)/obj/endpoint.o" "$(BUILD)/obj/error.o" "$(BUILD)/obj/fileHandler.o" "$(BUILD)/obj/host.o" "$(BUILD)/obj/hpack.o" "$(BUILD)/obj/http1Filter.o" "$(BUILD)/obj/http2Filter.o" "$(BUILD)/obj/huff.o" "$(BUILD)/obj/monitor.o" "$(BUILD)/obj/net.o" "$(BUILD)/obj/netConnector.o" "$(BUILD)/obj/packet.o" "$(BUILD)/obj/pam.o" "$(BUILD)/obj/passHandler.o" "$(BUILD)/obj/pipeline.o" "$(BUILD)/obj/process.o" "$(BUILD)/obj/proxyHandler.o" "$(BUILD)/obj/queue.o" "$(BUILD)/obj/rangeFilter.o" "$(BUILD)/obj/route.o" "$(BUILD)/obj/rx.o" "$(BUILD)/obj/server.o" "$(BUILD)/obj/service.o" "$(BUILD)/obj/session.o" "$(BUILD)/obj/stage.o" "$(BUILD)/obj/stream.o" "$(BUILD)/obj/tailFilter.o" "$(BUILD)/obj/trace.o" "$(BUILD)/obj/tx.o" "$(BUILD)/obj/uploadFilter.o" "$(BUILD)/obj/uri.o" "$(BUILD)/obj/user.o" "$(BUILD)/obj/var.o" "$(BUILD)/obj/webSockFilter.o"
 
 #
 #   http
@@ -914,6 +939,9 @@ ifeq ($(ME_COM_PCRE),1)
     LIBS_66 += -lpcre
 endif
 LIBS_66 += -lmpr
+ifeq ($(ME_HTTP_COMPRESS),1)
+    LIBS_66 += -lz
+endif
 
 $(BUILD)/bin/http: $(DEPS_66)
 	@echo '      [Link] $(BUILD)/bin/http'
@@ -989,6 +1017,9 @@ ifeq ($(ME_COM_PCRE),1)
     LIBS_68 += -lpcre
 endif
 LIBS_68 += -lmpr
+ifeq ($(ME_HTTP_COMPRESS),1)
+    LIBS_68 += -lz
+endif
 
 $(BUILD)/bin/server: $(DEPS_68)
 	@echo '      [Link] $(BUILD)/bin/server'
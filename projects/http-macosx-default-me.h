@@ -87,6 +87,9 @@
 #ifndef ME_HTTP_CMD
     #define ME_HTTP_CMD 1
 #endif
+#ifndef ME_HTTP_COMPRESS
+    #define ME_HTTP_COMPRESS 1
+#endif
 #ifndef ME_HTTP_HTTP2
     #define ME_HTTP_HTTP2 1
 #endif
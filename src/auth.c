@@ -9,6 +9,26 @@
 
 #include    "http.h"
 
+/*********************************** Locals ***********************************/
+
+#define HMAC_BLOCK      64                  /* SHA1 block size */
+#define HMAC_DIGEST     20                  /* SHA1 digest size */
+
+#define hexValue(c)     (isdigit((uchar) (c)) ? (c) - '0' : (c) - 'a' + 10)
+
+/*
+    Password verification performed by a worker so that password hashing does not block the stream dispatcher
+ */
+typedef struct AuthJob {
+    HttpStream      *stream;                /* Stream requesting verification */
+    HttpRx          *rx;                    /* Request requesting verification */
+    MprDispatcher   *dispatcher;            /* Stream dispatcher to notify when verified */
+    char            *credentials;           /* Plain text "username:realm:password" */
+    char            *hash;                  /* Required password hash */
+    char            *key;                   /* Credential key for the cache and to match the result to the request */
+    bool            verified;               /* Password was verified */
+} AuthJob;
+
 /********************************* Forwards ***********************************/
 
 #undef  GRADUATE_HASH
@@ -22,9 +42,16 @@
     }
 
 static void manageAuth(HttpAuth *auth, int flags);
+static void authWorker(AuthJob *job, MprWorker *worker);
+static void cacheCredentials(cchar *key, cchar *hash);
+static char *credentialKey(cchar *credentials);
+static void credentialsVerified(AuthJob *job, MprEvent *event);
 static void formLogin(HttpStream *stream);
 PUBLIC int formParse(HttpStream *stream, cchar **username, cchar **password);
 static bool configVerifyUser(HttpStream *stream, cchar *username, cchar *password);
+static void manageAuthJob(AuthJob *job, int flags);
+static bool lookupCredentials(cchar *key, cchar *hash);
+static bool verifyPassword(HttpStream *stream, cchar *credentials, cchar *hash);
 
 /*********************************** Code *************************************/
 
@@ -641,8 +668,8 @@ static bool configVerifyUser(HttpStream *stream, cchar *username, cchar *passwor
 {
     HttpRx      *rx;
     HttpAuth    *auth;
-    bool        success;
-    cchar       *requiredPassword;
+    bool        success, resumed;
+    cchar       *credentials, *requiredPassword;
 
     rx = stream->rx;
     auth = rx->route->auth;
@@ -658,7 +685,27 @@ static bool configVerifyUser(HttpStream *stream, cchar *username, cchar *passwor
         if (sncmp(requiredPassword, "BF", 2) == 0 && slen(requiredPassword) > 4 && isdigit(requiredPassword[2]) &&
                 requiredPassword[3] == ':') {
             /* Blowifsh */
-            success = mprCheckPassword(sfmt("%s:%s:%s", username, auth->realm, password), stream->user->password);
+            if (rx->authPending) {
+                return 0;
+            }
+            credentials = sfmt("%s:%s:%s", username, auth->realm, password);
+            success = resumed = 0;
+            if (rx->authVerified || rx->authRejected) {
+                /*
+                    Result from a worker when routing resumes. Only used once and only for the credentials the
+                    worker verified.
+                 */
+                resumed = rx->authKey && smatch(rx->authKey, credentialKey(credentials));
+                success = rx->authVerified;
+                rx->authVerified = rx->authRejected = 0;
+                rx->authKey = 0;
+            }
+            if (!resumed) {
+                success = verifyPassword(stream, credentials, stream->user->password);
+                if (rx->authPending) {
+                    return 0;
+                }
+            }
 
         } else {
             if (!stream->encoded) {
@@ -678,6 +725,167 @@ static bool configVerifyUser(HttpStream *stream, cchar *username, cchar *passwor
 }
 
 
+/*
+    Verify a password against a Blowfish hash. Verified credentials are cached under a keyed hash so that clients
+    sending the same credentials on every request pay for the password hashing once. When routing a buffered request,
+    the hashing is done by a worker and rx->authPending is set. Routing resumes when verified.
+ */
+static bool verifyPassword(HttpStream *stream, cchar *credentials, cchar *hash)
+{
+    Http        *http;
+    HttpRx      *rx;
+    AuthJob     *job;
+    char        *key;
+
+    http = stream->http;
+    rx = stream->rx;
+    key = credentialKey(credentials);
+
+    if (key && http->credentialCache && lookupCredentials(key, hash)) {
+        mprAtomicAdd64(&http->credentialHits, 1);
+        return 1;
+    }
+    mprAtomicAdd64(&http->credentialMisses, 1);
+
+    if (rx->authAsync && (job = mprAllocObj(AuthJob, manageAuthJob)) != 0) {
+        job->stream = stream;
+        job->rx = rx;
+        job->dispatcher = stream->dispatcher;
+        job->credentials = sclone(credentials);
+        job->hash = sclone(hash);
+        job->key = key;
+        /* Set before starting as the result may be posted before mprStartWorker returns */
+        rx->authPending = 1;
+        if (mprStartWorker((MprWorkerProc) authWorker, job) == 0) {
+            return 0;
+        }
+        rx->authPending = 0;
+    }
+    /* No worker available or not routing. Verify here */
+    if (!mprCheckPassword(credentials, hash)) {
+        return 0;
+    }
+    if (key && http->credentialCache) {
+        cacheCredentials(key, hash);
+    }
+    return 1;
+}
+
+
+/*
+    Runs on a worker thread and must only access the job
+ */
+static void authWorker(AuthJob *job, MprWorker *worker)
+{
+    job->verified = mprCheckPassword(job->credentials, job->hash);
+    mprCreateEvent(job->dispatcher, "credentialsVerified", 0, credentialsVerified, job, 0);
+}
+
+
+/*
+    Runs on the stream dispatcher when the worker has verified the password. Route the request again.
+ */
+static void credentialsVerified(AuthJob *job, MprEvent *event)
+{
+    HttpStream  *stream;
+    HttpRx      *rx;
+
+    if (job->verified && job->key && HTTP->credentialCache) {
+        cacheCredentials(job->key, job->hash);
+    }
+    stream = job->stream;
+    rx = job->rx;
+    if (stream->destroyed || stream->rx != rx) {
+        /* Request has completed or the stream was closed */
+        return;
+    }
+    rx->authPending = 0;
+    rx->authVerified = job->verified;
+    rx->authRejected = !job->verified;
+    rx->authKey = job->key;
+    httpProcess(stream->inputq);
+}
+
+
+static void manageAuthJob(AuthJob *job, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(job->stream);
+        mprMark(job->rx);
+        mprMark(job->dispatcher);
+        mprMark(job->credentials);
+        mprMark(job->hash);
+        mprMark(job->key);
+    } else if (flags & MPR_MANAGE_FREE) {
+        if (job->credentials) {
+            memset(job->credentials, 0, slen(job->credentials));
+        }
+    }
+}
+
+
+/*
+    Keyed hash (HMAC-SHA1) of the credentials using the per-process secret. The key never discloses the password.
+ */
+static char *credentialKey(cchar *credentials)
+{
+    char    *buf, *inner, outer[HMAC_BLOCK + HMAC_DIGEST], pad[HMAC_BLOCK];
+    cchar   *secret;
+    ssize   len, slength;
+    int     i;
+
+    secret = HTTP->secret;
+    slength = min(slen(secret), HMAC_BLOCK);
+    memset(pad, 0, sizeof(pad));
+    memcpy(pad, secret, slength);
+
+    len = slen(credentials);
+    if ((buf = mprAlloc(HMAC_BLOCK + len)) == 0) {
+        return 0;
+    }
+    for (i = 0; i < HMAC_BLOCK; i++) {
+        buf[i] = pad[i] ^ 0x36;
+        outer[i] = pad[i] ^ 0x5c;
+    }
+    memcpy(&buf[HMAC_BLOCK], credentials, len);
+    inner = mprGetSHAWithPrefix(buf, HMAC_BLOCK + len, NULL);
+    memset(buf, 0, HMAC_BLOCK + len);
+
+    for (i = 0; i < HMAC_DIGEST; i++) {
+        outer[HMAC_BLOCK + i] = (char) ((hexValue(inner[i * 2]) << 4) | hexValue(inner[i * 2 + 1]));
+    }
+    return mprGetSHAWithPrefix(outer, sizeof(outer), NULL);
+}
+
+
+/*
+    Test if the credentials have been verified. The cached hash must match in case the password has since changed.
+ */
+static bool lookupCredentials(cchar *key, cchar *hash)
+{
+    cchar   *cached;
+
+    if ((cached = mprReadCache(HTTP->credentialCache, key, 0, 0)) == 0) {
+        return 0;
+    }
+    return smatch(cached, hash);
+}
+
+
+static void cacheCredentials(cchar *key, cchar *hash)
+{
+    mprWriteCache(HTTP->credentialCache, key, sclone(hash), 0, ME_MAX_CREDENTIAL_DURATION, 0, MPR_CACHE_SET);
+}
+
+
+PUBLIC void httpFlushCredentials()
+{
+    if (HTTP && HTTP->credentialCache) {
+        mprRemoveCache(HTTP->credentialCache, NULL);
+    }
+}
+
+
 /*
     Web form-based authentication callback for the "form" auth protocol.
     Asks the user to login via a web page.
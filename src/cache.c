@@ -23,7 +23,7 @@ static int matchCacheHandler(HttpStream *stream, HttpRoute *route, int dir);
 static void outgoingCacheFilterService(HttpQueue *q);
 static void readyCacheHandler(HttpQueue *q);
 static void saveCachedResponse(HttpStream *stream);
-static cchar *setHeadersFromCache(HttpStream *stream, cchar *content);
+static cchar *setHeadersFromCache(HttpStream *stream, cchar *content, ssize len, ssize *dataLen);
 
 /************************************ Code ************************************/
 
@@ -127,14 +127,15 @@ static void readyCacheHandler(HttpQueue *q)
     HttpStream  *stream;
     HttpTx      *tx;
     cchar       *data;
+    ssize       len;
 
     stream = q->stream;
     tx = stream->tx;
 
     if (tx->cachedContent) {
-        if ((data = setHeadersFromCache(stream, tx->cachedContent)) != 0) {
-            tx->length = slen(data);
-            httpWriteString(q, data);
+        if ((data = setHeadersFromCache(stream, tx->cachedContent, tx->cachedLength, &len)) != 0) {
+            tx->length = len;
+            httpWriteBlock(q, data, len, HTTP_BUFFER);
         }
     }
     httpFinalize(stream);
@@ -159,9 +160,10 @@ static void outgoingCacheFilterService(HttpQueue *q)
     HttpPacket  *packet, *data;
     HttpStream  *stream;
     HttpTx      *tx;
+    MprHash     *headers;
     MprKey      *kp;
     cchar       *cachedData;
-    ssize       size;
+    ssize       size, cachedSize;
 
     stream = q->stream;
     tx = stream->tx;
@@ -178,8 +180,8 @@ static void outgoingCacheFilterService(HttpQueue *q)
     if (mprLookupKey(stream->tx->headers, "X-SendCache") != 0) {
         if (fetchCachedResponse(stream)) {
             httpLog(stream->trace, "cache.sendcache", "context", "msg:'Using cached content'");
-            cachedData = setHeadersFromCache(stream, tx->cachedContent);
-            tx->length = slen(cachedData);
+            cachedData = setHeadersFromCache(stream, tx->cachedContent, tx->cachedLength, &cachedSize);
+            tx->length = cachedSize;
         }
     }
     for (packet = httpGetPacket(q); packet; packet = httpGetPacket(q)) {
@@ -200,13 +202,15 @@ static void outgoingCacheFilterService(HttpQueue *q)
                  */
                 if (mprGetBufLength(tx->cacheBuffer) == 0) {
                     /*
-                        Add defined headers to the start of the cache buffer. Separate with a double newline.
+                        Start the cache record with the status and defined headers packed as a hash.
+                        The response body follows.
                      */
-                    mprPutToBuf(tx->cacheBuffer, "X-Status: %d\n", tx->status);
-                    for (kp = 0; (kp = mprGetNextKey(tx->headers, kp)) != 0; ) {
-                        mprPutToBuf(tx->cacheBuffer, "%s: %s\n", kp->key, (char*) kp->data);
+                    headers = mprCreateHash(HTTP_SMALL_HASH_SIZE, MPR_HASH_STATIC_ALL);
+                    mprAddKey(headers, "X-Status", itos(tx->status));
+                    for (ITERATE_KEYS(tx->headers, kp)) {
+                        mprAddKey(headers, kp->key, kp->data);
                     }
-                    mprPutCharToBuf(tx->cacheBuffer, '\n');
+                    mprPackHash(tx->cacheBuffer, headers);
                 }
                 size = mprGetBufLength(packet->content);
                 if ((tx->cacheBufferLength + size) < stream->limits->cacheItemSize) {
@@ -290,7 +294,8 @@ static bool fetchCachedResponse(HttpStream *stream)
             (scontains(value, "max-age=0") == 0 || scontains(value, "no-cache") == 0)) {
         httpLog(stream->trace, "cache.reload", "context", "msg:'Client reload'");
 
-    } else if ((tx->cachedContent = mprReadCache(stream->host->responseCache, key, &modified, 0)) != 0) {
+    } else if ((tx->cachedContent = mprReadCacheBlock(stream->host->responseCache, key, &tx->cachedLength, &modified,
+            0)) != 0) {
         /*
             See if a NotModified response can be served. This is much faster than sending the response.
             Observe headers:
@@ -342,8 +347,8 @@ static void saveCachedResponse(HttpStream *stream)
         Truncate modified time to get a 1 sec resolution. This is the resolution for If-Modified headers.
      */
     modified = mprGetTime() / TPS * TPS;
-    mprWriteCache(stream->host->responseCache, makeCacheKey(stream), mprGetBufStart(buf), modified,
-        tx->cache->serverLifespan, 0, 0);
+    mprWriteCacheBlock(stream->host->responseCache, makeCacheKey(stream), mprGetBufStart(buf), mprGetBufLength(buf),
+        modified, tx->cache->serverLifespan, 0, 0);
 }
 
 
@@ -351,23 +356,24 @@ PUBLIC ssize httpWriteCached(HttpStream *stream)
 {
     MprTime     modified;
     cchar       *cacheKey, *data, *content;
+    ssize       len;
 
     if (!stream->tx->cache) {
         return MPR_ERR_CANT_FIND;
     }
     cacheKey = makeCacheKey(stream);
-    if ((content = mprReadCache(stream->host->responseCache, cacheKey, &modified, 0)) == 0) {
+    if ((content = mprReadCacheBlock(stream->host->responseCache, cacheKey, &len, &modified, 0)) == 0) {
         httpLog(stream->trace, "cache.none", "context", "msg:'No response data in cache', key:'%s'", cacheKey);
         return 0;
     }
     httpLog(stream->trace, "cache.cached", "context", "msg:'Used cached response', key:'%s'", cacheKey);
-    data = setHeadersFromCache(stream, content);
+    data = setHeadersFromCache(stream, content, len, &len);
     httpSetHeaderString(stream, "Etag", mprGetMD5(cacheKey));
     httpSetHeaderString(stream, "Last-Modified", mprFormatUniversalTime(MPR_HTTP_DATE, modified));
     stream->tx->cacheBuffer = 0;
-    httpWriteString(stream->writeq, data);
+    httpWriteBlock(stream->writeq, data, len, HTTP_BUFFER);
     httpFinalizeOutput(stream);
-    return slen(data);
+    return len;
 }
 
 
@@ -514,11 +520,33 @@ static char *makeCacheKey(HttpStream *stream)
     Parse cached content of the form:  headers \n\n data
     Set headers in the current request and return a reference to the data portion
  */
-static cchar *setHeadersFromCache(HttpStream *stream, cchar *content)
+/*
+    Set the status and headers from a cached response record and return a reference to the body.
+    Captured responses start with a packed hash of headers whose strings are referenced without copying.
+    Content saved via httpUpdateCache may have text headers separated from the body by a double newline.
+ */
+static cchar *setHeadersFromCache(HttpStream *stream, cchar *content, ssize len, ssize *dataLen)
 {
+    MprHash *hash;
+    MprKey  *kp;
     cchar   *data;
     char    *header, *headers, *key, *value, *tok;
-
+    ssize   used;
+
+    if (len > 0 && (uchar) content[0] == MPR_PACK_HASH) {
+        hash = mprCreateHash(HTTP_SMALL_HASH_SIZE, MPR_HASH_STATIC_ALL);
+        if ((used = mprUnpackHash(hash, content, len, MPR_PACK_REFERENCE)) >= 0) {
+            for (ITERATE_KEYS(hash, kp)) {
+                if (smatch(kp->key, "X-Status")) {
+                    stream->tx->status = (int) stoi(kp->data);
+                } else {
+                    httpAddHeaderString(stream, kp->key, kp->data);
+                }
+            }
+            *dataLen = len - used;
+            return &content[used];
+        }
+    }
     if ((data = strstr(content, "\n\n")) == 0) {
         data = content;
     } else {
@@ -533,6 +561,7 @@ static cchar *setHeadersFromCache(HttpStream *stream, cchar *content)
             }
         }
     }
+    *dataLen = len - (data - content);
     return data;
 }
 
@@ -31,7 +31,7 @@ PUBLIC int httpOpenChunkFilter()
         return MPR_ERR_CANT_CREATE;
     }
     HTTP->chunkFilter = filter;
-    filter->flags |= HTTP_STAGE_INTERNAL;
+    filter->flags |= HTTP_STAGE_INTERNAL | HTTP_STAGE_ENTITY;
     filter->incoming = incomingChunk;
     filter->outgoingService = outgoingChunkService;
     return 0;
@@ -217,7 +217,10 @@ static void outgoingChunkService(HttpQueue *q)
         return;
     }
     for (packet = httpGetPacket(q); packet; packet = httpGetPacket(q)) {
-        if (packet->flags & HTTP_PACKET_DATA) {
+        if ((packet->flags & HTTP_PACKET_DATA) && packet->esize == 0) {
+            /*
+                Entity packets are sent from the file as a single chunk and are not joined or resized
+             */
             httpPutBackPacket(q, packet);
             httpJoinPackets(q, tx->chunkSize);
             packet = httpGetPacket(q);
@@ -247,6 +250,8 @@ static bool needChunking(HttpQueue *q)
 {
     HttpStream  *stream;
     HttpTx      *tx;
+    HttpPacket  *packet;
+    MprOff      count;
     cchar       *value;
 
     stream = q->stream;
@@ -264,8 +269,12 @@ static bool needChunking(HttpQueue *q)
     }
     if (tx->length < 0 && tx->chunkSize < 0) {
         if (q->last->flags & HTTP_PACKET_END) {
-            if (q->count > 0) {
-                tx->length = q->count;
+            /* Entity packets are not included in q->count */
+            for (count = 0, packet = q->first; packet; packet = packet->next) {
+                count += httpGetPacketEntityLength(packet);
+            }
+            if (count > 0) {
+                tx->length = count;
             }
         } else {
             tx->chunkSize = min(stream->limits->chunkSize, q->max);
@@ -287,8 +296,8 @@ static void setChunkPrefix(HttpQueue *q, HttpPacket *packet)
     /*
         NOTE: prefixes don't count in the queue length. No need to adjust q->count
      */
-    if (httpGetPacketLength(packet)) {
-        mprPutToBuf(packet->prefix, "\r\n%zx\r\n", httpGetPacketLength(packet));
+    if (httpGetPacketEntityLength(packet)) {
+        mprPutToBuf(packet->prefix, "\r\n%llx\r\n", httpGetPacketEntityLength(packet));
     } else {
         mprPutStringToBuf(packet->prefix, "\r\n0\r\n\r\n");
     }
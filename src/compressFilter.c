@@ -0,0 +1,499 @@
+/*
+    compressFilter.c - Response compression filter.
+
+    This is an output only filter that compresses response data with gzip or deflate. The encoding is selected via
+    the Accept-Encoding request header. Only successful responses of a compressible mime type that meet the route's
+    minimum size are compressed. Compression is streamed so that dynamic content of unknown length is compressed as
+    it is written. Compressed variants of responses with an ETag may be saved in the host response cache.
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************* Includes ***********************************/
+
+#include    "http.h"
+
+#if ME_HTTP_COMPRESS
+#include    <zlib.h>
+
+/********************************** Defines ***********************************/
+
+#define HTTP_COMPRESS_GZIP      1           /* gzip content encoding */
+#define HTTP_COMPRESS_DEFLATE   2           /* deflate (zlib) content encoding */
+
+/*
+    Compressible mime types when a route does not define its own. All text/ types are also compressed.
+ */
+static cchar *defaultTypes[] = {
+    "application/javascript",
+    "application/json",
+    "application/xml",
+    "image/svg+xml",
+    0
+};
+
+/*
+    Compression state for a request
+ */
+typedef struct Compress {
+    z_stream    zs;                         /* Zlib stream state */
+    HttpPacket  *out;                       /* Current output packet being filled */
+    MprBuf      *saved;                     /* Compressed content saved in or read from the response cache */
+    char        *cacheKey;                  /* Response cache key for the compressed variant */
+    int         encoding;                   /* Selected content encoding */
+    int         decided;                    /* Decided whether to compress the response */
+    int         compressing;                /* Compressing the response */
+    int         cached;                     /* Response sent from a cached compressed variant */
+    int         active;                     /* Zlib stream is initialized */
+} Compress;
+
+/********************************** Forwards **********************************/
+
+static void closeCompress(HttpQueue *q);
+static void compressData(HttpQueue *q, cchar *data, ssize len, int flush);
+static bool decideCompress(HttpQueue *q);
+static void decideHead(HttpStream *stream, Compress *cp, cchar *encoding);
+static void manageCompress(Compress *cp, int flags);
+static int matchCompress(HttpStream *stream, HttpRoute *route, int dir);
+static bool matchType(HttpCompress *compress, cchar *mimeType);
+static int openCompress(HttpQueue *q);
+static void outgoingCompressService(HttpQueue *q);
+static void saveCompressed(HttpQueue *q);
+static int selectEncoding(HttpStream *stream);
+static void sendCached(HttpQueue *q, MprBuf *buf);
+static void setVariant(HttpStream *stream, cchar *encoding);
+
+/*********************************** Code *************************************/
+
+PUBLIC int httpOpenCompressFilter()
+{
+    HttpStage     *filter;
+
+    if ((filter = httpCreateFilter("compressFilter", NULL)) == 0) {
+        return MPR_ERR_CANT_CREATE;
+    }
+    HTTP->compressFilter = filter;
+    filter->flags |= HTTP_STAGE_INTERNAL;
+    filter->match = matchCompress;
+    filter->open = openCompress;
+    filter->close = closeCompress;
+    filter->outgoingService = outgoingCompressService;
+    return 0;
+}
+
+
+/*
+    The filter is not matched via the route output stages. It is added by httpCreateTxPipeline if the route enables
+    compression. Ranged requests are not compressed as the ranges apply to the uncompressed content. HTTP/1.0
+    requests are not compressed as the compressed length is not known in advance and chunking is not available.
+    HEAD requests are matched so the response headers are the same as for GET.
+ */
+static int matchCompress(HttpStream *stream, HttpRoute *route, int dir)
+{
+    if (!(dir & HTTP_STAGE_TX) || !route->compress || !httpServerStream(stream) || stream->net->protocol == 0) {
+        return HTTP_ROUTE_OMIT_FILTER;
+    }
+    if (stream->tx->outputRanges || selectEncoding(stream) == 0) {
+        return HTTP_ROUTE_OMIT_FILTER;
+    }
+    return HTTP_ROUTE_OK;
+}
+
+
+static int openCompress(HttpQueue *q)
+{
+    Compress    *cp;
+
+    if ((cp = mprAllocObj(Compress, manageCompress)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    cp->encoding = selectEncoding(q->stream);
+    q->queueData = cp;
+    return 0;
+}
+
+
+static void closeCompress(HttpQueue *q)
+{
+    Compress    *cp;
+
+    if ((cp = q->queueData) != 0 && cp->active) {
+        deflateEnd(&cp->zs);
+        cp->active = 0;
+    }
+}
+
+
+static void manageCompress(Compress *cp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(cp->out);
+        mprMark(cp->saved);
+        mprMark(cp->cacheKey);
+
+    } else if (flags & MPR_MANAGE_FREE) {
+        if (cp->active) {
+            deflateEnd(&cp->zs);
+        }
+    }
+}
+
+
+/*
+    Select the content encoding from the Accept-Encoding header. Prefer gzip over deflate and honor "q=0" refusals.
+ */
+static int selectEncoding(HttpStream *stream)
+{
+    char    *value, *item, *name, *params, *tok, *qp;
+    double  gzip, deflate, any;
+
+    if (!stream->rx->acceptEncoding) {
+        return 0;
+    }
+    gzip = deflate = any = -1;
+    value = slower(stream->rx->acceptEncoding);
+    for (item = stok(value, ",", &tok); item; item = stok(0, ",", &tok)) {
+        name = strim(ssplit(item, ";", &params), " \t", MPR_TRIM_BOTH);
+        qp = params ? scontains(params, "q=") : 0;
+        if (smatch(name, "gzip") || smatch(name, "x-gzip")) {
+            gzip = qp ? stof(&qp[2]) : 1;
+        } else if (smatch(name, "deflate")) {
+            deflate = qp ? stof(&qp[2]) : 1;
+        } else if (smatch(name, "*")) {
+            any = qp ? stof(&qp[2]) : 1;
+        }
+    }
+    if (gzip > 0 || (gzip < 0 && any > 0)) {
+        return HTTP_COMPRESS_GZIP;
+    }
+    if (deflate > 0 || (deflate < 0 && any > 0)) {
+        return HTTP_COMPRESS_DEFLATE;
+    }
+    return 0;
+}
+
+
+static bool matchType(HttpCompress *compress, cchar *mimeType)
+{
+    char    *type, *slash;
+    cchar   **tp;
+
+    type = slower(mimeType);
+    type = strim(ssplit(type, ";", NULL), " \t", MPR_TRIM_BOTH);
+    if (compress->types) {
+        if (mprLookupKey(compress->types, type)) {
+            return 1;
+        }
+        if ((slash = schr(type, '/')) != 0) {
+            return mprLookupKey(compress->types, sfmt("%.*s/*", (int) (slash - type), type)) != 0;
+        }
+        return 0;
+    }
+    if (sstarts(type, "text/")) {
+        return 1;
+    }
+    for (tp = defaultTypes; *tp; tp++) {
+        if (smatch(type, *tp)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/*
+    Decide whether to compress the response. This is done before any data is passed downstream and thus before the
+    headers are created. If the response length is not yet known, wait until sufficient data is queued or the end
+    of the response. Return false to wait for more data.
+ */
+static bool decideCompress(HttpQueue *q)
+{
+    HttpStream      *stream;
+    HttpCompress    *compress;
+    HttpPacket      *packet;
+    HttpTx          *tx;
+    Compress        *cp;
+    MprOff          length;
+    cchar           *mimeType, *encoding;
+    int             windowBits;
+
+    stream = q->stream;
+    tx = stream->tx;
+    cp = q->queueData;
+    compress = stream->rx->route->compress;
+
+    if (!compress || cp->encoding == 0 || stream->error || httpGetTxHeader(stream, "Content-Encoding")) {
+        cp->decided = 1;
+        return 1;
+    }
+    if ((mimeType = httpGetTxHeader(stream, "Content-Type")) == 0 && tx->ext) {
+        mimeType = mprLookupMime(stream->rx->route->mimeTypes, tx->ext);
+    }
+    if (!mimeType || !matchType(compress, mimeType)) {
+        cp->decided = 1;
+        return 1;
+    }
+    encoding = (cp->encoding == HTTP_COMPRESS_GZIP) ? "gzip" : "deflate";
+    if (tx->status == HTTP_CODE_NOT_MODIFIED) {
+        /* Revalidating a compressed variant must return the ETag of that variant */
+        if (tx->entityLength >= compress->minSize) {
+            setVariant(stream, encoding);
+        }
+        cp->decided = 1;
+        return 1;
+    }
+    if (tx->status != HTTP_CODE_OK || (tx->flags & HTTP_TX_NO_BODY)) {
+        cp->decided = 1;
+        return 1;
+    }
+    if ((length = tx->length) < 0) {
+        if (!(q->last && (q->last->flags & HTTP_PACKET_END)) && q->count < min(compress->minSize, q->max)) {
+            return 0;
+        }
+        for (length = 0, packet = q->first; packet; packet = packet->next) {
+            length += httpGetPacketEntityLength(packet);
+        }
+        if (!(q->last && (q->last->flags & HTTP_PACKET_END))) {
+            length = max(length, compress->minSize);
+        }
+    }
+    cp->decided = 1;
+    if (length < compress->minSize) {
+        return 1;
+    }
+
+    if ((compress->flags & HTTP_COMPRESS_CACHE) && tx->etag) {
+        cp->cacheKey = sfmt("http::compress::%s::%s%s::%s", encoding, stream->rx->route->prefix,
+            stream->rx->pathInfo, tx->etag);
+        if (mprReadCache(stream->host->responseCache, cp->cacheKey, 0, 0) &&
+                (cp->saved = mprGetCacheLink(stream->host->responseCache, cp->cacheKey)) != 0) {
+            /* Retain the cached content in case the cache item expires before the response is complete */
+            cp->cached = 1;
+            httpLog(stream->trace, "compress.cached", "context", "msg:'Use cached compressed content',key:'%s'",
+                cp->cacheKey);
+        }
+    }
+    if (stream->rx->flags & HTTP_HEAD) {
+        decideHead(stream, cp, encoding);
+        return 1;
+    }
+    if (!cp->cached) {
+        windowBits = (cp->encoding == HTTP_COMPRESS_GZIP) ? 15 + 16 : 15;
+        if (deflateInit2(&cp->zs, compress->level, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            httpLog(stream->trace, "compress.error", "error", "msg:'Cannot initialize compression'");
+            return 1;
+        }
+        cp->active = 1;
+        if (cp->cacheKey && stream->limits->cacheItemSize > 0) {
+            cp->saved = mprCreateBuf(ME_BUFSIZE, stream->limits->cacheItemSize);
+        }
+    }
+    cp->compressing = 1;
+
+    /*
+        The compressed length is not known in advance so the response is chunked or uses HTTP/2 framing
+     */
+    httpSetHeaderString(stream, "Content-Encoding", encoding);
+    httpRemoveHeader(stream, "Content-Length");
+    tx->length = -1;
+    setVariant(stream, encoding);
+    return 1;
+}
+
+
+/*
+    Define the same headers for HEAD as for GET without compressing. The compressed length is only known if the
+    variant is cached, otherwise the length is omitted as it would be for a chunked GET response.
+ */
+static void decideHead(HttpStream *stream, Compress *cp, cchar *encoding)
+{
+    HttpTx      *tx;
+
+    tx = stream->tx;
+    httpSetHeaderString(stream, "Content-Encoding", encoding);
+    httpRemoveHeader(stream, "Content-Length");
+    if (cp->cached) {
+        tx->length = mprGetBufLength(cp->saved);
+    } else {
+        tx->length = -1;
+        tx->flags |= HTTP_TX_NO_LENGTH;
+    }
+    setVariant(stream, encoding);
+}
+
+
+/*
+    The ETag identifies the encoded representation and so must differ from the uncompressed ETag.
+    Caches must key the response on the Accept-Encoding request header.
+ */
+static void setVariant(HttpStream *stream, cchar *encoding)
+{
+    HttpTx      *tx;
+    cchar       *vary;
+
+    tx = stream->tx;
+    if (tx->etag) {
+        tx->etag = sfmt("%s-%s", tx->etag, encoding);
+    }
+    if ((vary = httpGetTxHeader(stream, "Vary")) == 0) {
+        httpSetHeaderString(stream, "Vary", "Accept-Encoding");
+    } else if (!scontains(slower(vary), "accept-encoding")) {
+        httpAppendHeaderString(stream, "Vary", "Accept-Encoding");
+    }
+}
+
+
+static void outgoingCompressService(HttpQueue *q)
+{
+    HttpPacket  *packet;
+    Compress    *cp;
+
+    cp = q->queueData;
+    if (!cp->decided && !decideCompress(q)) {
+        return;
+    }
+    if (!cp->compressing) {
+        httpDefaultOutgoingServiceStage(q);
+        return;
+    }
+    for (packet = httpGetPacket(q); packet; packet = httpGetPacket(q)) {
+        if (packet->flags & HTTP_PACKET_DATA) {
+            if (cp->cached) {
+                /* Discard the uncompressed data. The cached variant is sent when the response is complete. */
+                continue;
+            }
+            if (!httpWillNextQueueAcceptSize(q, q->nextQ->packetSize)) {
+                httpPutBackPacket(q, packet);
+                return;
+            }
+            if (packet->content) {
+                compressData(q, mprGetBufStart(packet->content), mprGetBufLength(packet->content), Z_NO_FLUSH);
+            }
+
+        } else if (packet->flags & HTTP_PACKET_END) {
+            if (cp->cached) {
+                sendCached(q, cp->saved);
+            } else {
+                compressData(q, NULL, 0, Z_FINISH);
+                saveCompressed(q);
+            }
+            httpPutPacketToNext(q, packet);
+
+        } else {
+            httpPutPacketToNext(q, packet);
+        }
+    }
+}
+
+
+/*
+    Compress data into output packets of the downstream packet size. Full packets are passed downstream.
+    On Z_FINISH, all remaining output is flushed.
+ */
+static void compressData(HttpQueue *q, cchar *data, ssize len, int flush)
+{
+    HttpStream  *stream;
+    Compress    *cp;
+    MprBuf      *content;
+    ssize       size, nbytes;
+    int         rc;
+
+    stream = q->stream;
+    cp = q->queueData;
+    if (!cp->active) {
+        return;
+    }
+    cp->zs.next_in = (Bytef*) data;
+    cp->zs.avail_in = (uInt) len;
+    while (1) {
+        if (!cp->out) {
+            cp->out = httpCreateDataPacket(q->nextQ->packetSize);
+        }
+        content = cp->out->content;
+        size = mprGetBufSpace(content);
+        cp->zs.next_out = (Bytef*) mprGetBufEnd(content);
+        cp->zs.avail_out = (uInt) size;
+        if ((rc = deflate(&cp->zs, flush)) == Z_STREAM_ERROR) {
+            httpError(stream, HTTP_CODE_INTERNAL_SERVER_ERROR, "Cannot compress response");
+            return;
+        }
+        nbytes = size - cp->zs.avail_out;
+        if (cp->saved && nbytes > 0 && mprPutBlockToBuf(cp->saved, mprGetBufEnd(content), nbytes) != nbytes) {
+            /* Too big to cache */
+            cp->saved = 0;
+        }
+        mprAdjustBufEnd(content, nbytes);
+        if (mprGetBufSpace(content) == 0) {
+            httpPutPacketToNext(q, cp->out);
+            cp->out = 0;
+        }
+        if (flush == Z_FINISH ? rc == Z_STREAM_END : cp->zs.avail_out != 0) {
+            break;
+        }
+    }
+    if (flush == Z_FINISH) {
+        if (cp->out && mprGetBufLength(cp->out->content) > 0) {
+            httpPutPacketToNext(q, cp->out);
+        }
+        cp->out = 0;
+        deflateEnd(&cp->zs);
+        cp->active = 0;
+    }
+}
+
+
+/*
+    Save the compressed variant in the response cache. Cache items are strings, so the binary content is attached
+    as a cache link and the item value records the length.
+ */
+static void saveCompressed(HttpQueue *q)
+{
+    HttpStream  *stream;
+    Compress    *cp;
+    MprCache    *cache;
+
+    stream = q->stream;
+    cp = q->queueData;
+    if (!cp->saved || !cp->cacheKey || stream->error || mprGetBufLength(cp->saved) > stream->limits->cacheItemSize) {
+        return;
+    }
+    cache = stream->host->responseCache;
+    if (mprWriteCache(cache, cp->cacheKey, itos(mprGetBufLength(cp->saved)), 0, -1, 0, MPR_CACHE_SET) > 0) {
+        mprSetCacheLink(cache, cp->cacheKey, cp->saved);
+    }
+    cp->saved = 0;
+}
+
+
+/*
+    Send a cached compressed variant. The content length is known, so chunking is not required.
+ */
+static void sendCached(HttpQueue *q, MprBuf *buf)
+{
+    HttpPacket  *packet;
+    cchar       *start;
+    ssize       len, size;
+
+    q->stream->tx->length = mprGetBufLength(buf);
+    start = mprGetBufStart(buf);
+    for (len = mprGetBufLength(buf); len > 0; len -= size) {
+        size = min(len, q->nextQ->packetSize);
+        packet = httpCreateDataPacket(size);
+        mprPutBlockToBuf(packet->content, start, size);
+        httpPutPacketToNext(q, packet);
+        start += size;
+    }
+}
+
+#else
+PUBLIC int httpOpenCompressFilter() { return 0; }
+#endif /* ME_HTTP_COMPRESS */
+
+/*
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+ */
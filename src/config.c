@@ -446,6 +446,35 @@ static void parseAuthSessionEnable(HttpRoute *route, cchar *key, MprJson *prop)
 }
 
 
+/*
+    Session token keys. The first key is current and later keys are retained to decrypt older tokens.
+
+    keys: ['current-secret', 'prior-secret']
+ */
+static void parseAuthSessionKeys(HttpRoute *route, cchar *key, MprJson *prop)
+{
+    MprJson     *child;
+    int         ji;
+
+    for (ji = prop->length - 1; ji >= 0; ji--) {
+        if ((child = mprGetJsonObj(prop, itos(ji))) != 0 && child->value && *child->value) {
+            if (httpAddSessionKey(httpExpandRouteVars(route, child->value)) < 0) {
+                httpParseError(route, "Cannot add session key");
+                break;
+            }
+        }
+    }
+}
+
+
+static void parseAuthSessionStore(HttpRoute *route, cchar *key, MprJson *prop)
+{
+    if (httpSetRouteSessionStore(route, prop->value) < 0) {
+        httpParseError(route, "Unknown session store %s", prop->value);
+    }
+}
+
+
 static void parseAuthSessionVisible(HttpRoute *route, cchar *key, MprJson *prop)
 {
     httpSetRouteSessionVisibility(route, scaselessmatch(prop->value, "true"));
@@ -586,12 +615,39 @@ static void parseCgiPrefix(HttpRoute *route, cchar *key, MprJson *prop)
 }
 
 
+/*
+    compress: true
+    compress: [ extensions ]
+    compress: {
+        level: 6,
+        minimum: '1k',
+        types: [ 'text/plain', 'application/json' ],
+        cache: true
+    }
+    The true and array forms serve pre-compressed files if present. The object form also compresses other
+    responses on the fly.
+ */
 static void parseCompress(HttpRoute *route, cchar *key, MprJson *prop)
 {
+    cchar   *level, *minimum;
+    int     flags;
+
     if (smatch(prop->value, "true")) {
         httpAddRouteMapping(route, "", "${1}.gz, min.${1}.gz, min.${1}");
+
     } else if (prop->type & MPR_JSON_ARRAY) {
         httpAddRouteMapping(route, mprJsonToString(prop, 0), "${1}.gz, min.${1}.gz, min.${1}");
+
+    } else if (prop->type & MPR_JSON_OBJ) {
+        httpAddRouteMapping(route, "", "${1}.gz, min.${1}.gz, min.${1}");
+        level = mprReadJson(prop, "level");
+        minimum = mprReadJson(prop, "minimum");
+        flags = smatch(mprReadJson(prop, "cache"), "true") ? HTTP_COMPRESS_CACHE : 0;
+        httpSetRouteCompress(route, level ? (int) stoi(level) : HTTP_COMPRESS_LEVEL,
+            minimum ? (ssize) httpGetNumber(minimum) : -1, getList(mprReadJsonObj(prop, "types")), flags);
+
+    } else {
+        httpSetRouteCompress(route, 0, 0, 0, 0);
     }
 }
 
@@ -775,6 +831,15 @@ static void parseLimits(HttpRoute *route, cchar *key, MprJson *prop)
 }
 
 
+/*
+    limits: { arena: size }
+ */
+static void parseLimitsArena(HttpRoute *route, cchar *key, MprJson *prop)
+{
+    route->limits->arenaSize = (ssize) httpGetNumber(prop->value);
+}
+
+
 static void parseLimitsCache(HttpRoute *route, cchar *key, MprJson *prop)
 {
     mprSetCacheLimits(route->host->responseCache, 0, 0, httpGetNumber(prop->value), 0);
@@ -830,12 +895,37 @@ static void parseLimitsDepletion(HttpRoute *route, cchar *key, MprJson *prop)
 }
 
 
+/*
+    limits: { eventLoops: 'cores' | count }
+ */
+static void parseLimitsEventLoops(HttpRoute *route, cchar *key, MprJson *prop)
+{
+    int     count;
+
+    if (smatch(prop->value, "cores")) {
+        count = mprGetMemStats()->cpuCores;
+    } else {
+        count = httpGetInt(prop->value);
+    }
+    route->limits->eventLoops = max(count, 0);
+}
+
+
 static void parseLimitsFiles(HttpRoute *route, cchar *key, MprJson *prop)
 {
     mprSetFilesLimit(httpGetInt(prop->value));
 }
 
 
+/*
+    Time in msec to wait for threads to yield before abandoning a GC collection. This is process wide.
+ */
+static void parseLimitsGcSyncTimeout(HttpRoute *route, cchar *key, MprJson *prop)
+{
+    mprSetGCSyncTimeout(httpGetInt(prop->value));
+}
+
+
 static void parseLimitsKeepAlive(HttpRoute *route, cchar *key, MprJson *prop)
 {
     route->limits->keepAliveMax = httpGetInt(prop->value);
@@ -926,6 +1016,12 @@ static void parseLimitsSessions(HttpRoute *route, cchar *key, MprJson *prop)
 }
 
 
+static void parseLimitsSessionToken(HttpRoute *route, cchar *key, MprJson *prop)
+{
+    route->limits->sessionTokenSize = httpGetInt(prop->value);
+}
+
+
 static void parseLimitsUri(HttpRoute *route, cchar *key, MprJson *prop)
 {
     route->limits->uriSize = httpGetInt(prop->value);
@@ -945,6 +1041,12 @@ static void parseLimitsWebSockets(HttpRoute *route, cchar *key, MprJson *prop)
 }
 
 
+static void parseLimitsWebSocketsDeflate(HttpRoute *route, cchar *key, MprJson *prop)
+{
+    route->limits->webSocketsDeflate = (int) httpGetNumber(prop->value);
+}
+
+
 static void parseLimitsWebSocketsMessage(HttpRoute *route, cchar *key, MprJson *prop)
 {
     route->limits->webSocketsMessageSize = httpGetInt(prop->value);
@@ -1116,6 +1218,62 @@ static void parsePrefix(HttpRoute *route, cchar *key, MprJson *prop)
 }
 
 
+/*
+    proxy: {
+        upstreams: [ 'http://127.0.0.1:8080', 'https://backend:4443' ],
+        balance: 'round-robin' | 'least-connections',
+        protocol: 1 | 2,
+        pool: { max: 16, timeout: '30 secs' },
+        health: { uri: '/health', period: '10 secs', failures: 3 },
+        verify: true
+    }
+ */
+static void parseProxy(HttpRoute *route, cchar *key, MprJson *prop)
+{
+    HttpProxy       *proxy;
+    HttpUpstream    *up;
+    MprJson         *child, *upstreams;
+    cchar           *balance, *max, *period, *failures, *protocol, *timeout;
+    int             ji;
+
+    if (!(prop->type & MPR_JSON_OBJ)) {
+        httpParseError(route, "Proxy configuration must be an object");
+        return;
+    }
+    balance = mprReadJson(prop, "balance");
+    if (balance && !smatch(balance, "round-robin") && !smatch(balance, "least-connections")) {
+        httpParseError(route, "Unknown proxy balance \"%s\"", balance);
+        return;
+    }
+    protocol = mprReadJson(prop, "protocol");
+    proxy = httpCreateProxy(smatch(balance, "least-connections") ? HTTP_PROXY_LEAST_CONN : HTTP_PROXY_ROUND_ROBIN,
+        protocol ? (int) stoi(protocol) : 1);
+
+    upstreams = mprReadJsonObj(prop, "upstreams");
+    for (ITERATE_CONFIG(route, upstreams, child, ji)) {
+        if ((up = httpAddProxyUpstream(proxy, child->value)) == 0) {
+            httpParseError(route, "Bad proxy upstream \"%s\"", child->value);
+            return;
+        }
+        if (up->ssl && smatch(mprReadJson(prop, "verify"), "false")) {
+            mprVerifySslPeer(up->ssl, 0);
+        }
+    }
+    max = mprGetJson(prop, "pool.max");
+    timeout = mprGetJson(prop, "pool.timeout");
+    httpSetProxyPool(proxy, max ? (int) httpGetNumber(max) : -1, timeout ? httpGetTicks(timeout) : 0);
+
+    period = mprGetJson(prop, "health.period");
+    failures = mprGetJson(prop, "health.failures");
+    httpSetProxyHealth(proxy, mprGetJson(prop, "health.uri"), period ? httpGetTicks(period) : 0,
+        failures ? (int) httpGetNumber(failures) : 0);
+
+    if (httpSetRouteProxy(route, proxy) < 0) {
+        httpParseError(route, "Cannot enable proxy for route %s", route->pattern);
+    }
+}
+
+
 static void createRedirectAlias(HttpRoute *route, int status, cchar *from, cchar *to)
 {
     HttpRoute   *alias;
@@ -1744,6 +1902,24 @@ static void parseTimeoutsExit(HttpRoute *route, cchar *key, MprJson *prop)
 }
 
 
+/*
+    Resolution of parse, inactivity and request timeouts. Permits sub-second values with a "msec" suffix.
+ */
+static void parseTimeoutsGranularity(HttpRoute *route, cchar *key, MprJson *prop)
+{
+    MprTicks    granularity;
+
+    if (sends(prop->value, "ms") || sends(prop->value, "msec") || sends(prop->value, "msecs")) {
+        granularity = stoi(prop->value);
+    } else {
+        granularity = httpGetTicks(prop->value);
+    }
+    if (httpSetTimerGranularity(granularity) < 0) {
+        httpParseError(route, "Cannot set timeout granularity to %s", prop->value);
+    }
+}
+
+
 static void parseTimeoutsParse(HttpRoute *route, cchar *key, MprJson *prop)
 {
     if (! mprGetDebugMode()) {
@@ -1831,6 +2007,12 @@ static void parseTrace(HttpRoute *route, cchar *key, MprJson *prop)
 }
 
 
+static void parseWebSocketsDeflate(HttpRoute *route, cchar *key, MprJson *prop)
+{
+    httpSetRouteWebSocketsDeflate(route, (prop->type & MPR_JSON_TRUE) ? 1 : 0);
+}
+
+
 static void parseWebSocketsProtocol(HttpRoute *route, cchar *key, MprJson *prop)
 {
     route->webSocketsProtocol = sclone(prop->value);
@@ -1930,6 +2112,8 @@ PUBLIC int httpInitParser()
     httpAddConfig("http.auth.session.persist", parseAuthSessionCookiePersist);
     httpAddConfig("http.auth.session.same", parseAuthSessionCookieSame);
     httpAddConfig("http.auth.session.enable", parseAuthSessionEnable);
+    httpAddConfig("http.auth.session.keys", parseAuthSessionKeys);
+    httpAddConfig("http.auth.session.store", parseAuthSessionStore);
     httpAddConfig("http.auth.session.visible", parseAuthSessionVisible);
     httpAddConfig("http.auth.store", parseAuthStore);
     httpAddConfig("http.auth.type", parseAuthType);
@@ -1958,14 +2142,17 @@ PUBLIC int httpInitParser()
     httpAddConfig("http.indexes", parseIndexes);
     httpAddConfig("http.languages", parseLanguages);
     httpAddConfig("http.limits", parseLimits);
+    httpAddConfig("http.limits.arena", parseLimitsArena);
     httpAddConfig("http.limits.cache", parseLimitsCache);
     httpAddConfig("http.limits.cacheItem", parseLimitsCacheItem);
     httpAddConfig("http.limits.chunk", parseLimitsChunk);
     httpAddConfig("http.limits.clients", parseLimitsClients);
     httpAddConfig("http.limits.connections", parseLimitsConnections);
     httpAddConfig("http.limits.depletion", parseLimitsDepletion);
+    httpAddConfig("http.limits.eventLoops", parseLimitsEventLoops);
     httpAddConfig("http.limits.keepAlive", parseLimitsKeepAlive);
     httpAddConfig("http.limits.files", parseLimitsFiles);
+    httpAddConfig("http.limits.gcSyncTimeout", parseLimitsGcSyncTimeout);
     httpAddConfig("http.limits.memory", parseLimitsMemory);
     httpAddConfig("http.limits.rxBody", parseLimitsRxBody);
     httpAddConfig("http.limits.rxForm", parseLimitsRxForm);
@@ -1974,6 +2161,7 @@ PUBLIC int httpInitParser()
     httpAddConfig("http.limits.processes", parseLimitsProcesses);
     httpAddConfig("http.limits.requests", parseLimitsRequests);
     httpAddConfig("http.limits.sessions", parseLimitsSessions);
+    httpAddConfig("http.limits.sessionToken", parseLimitsSessionToken);
     httpAddConfig("http.limits.txBody", parseLimitsTxBody);
     httpAddConfig("http.limits.upload", parseLimitsUpload);
     httpAddConfig("http.limits.uri", parseLimitsUri);
@@ -1990,6 +2178,7 @@ PUBLIC int httpInitParser()
     httpAddConfig("http.pipeline.handlers", parsePipelineHandlers);
     httpAddConfig("http.profile", parseProfile);
     httpAddConfig("http.prefix", parsePrefix);
+    httpAddConfig("http.proxy", parseProxy);
     httpAddConfig("http.redirect", parseRedirect);
     httpAddConfig("http.renameUploads", parseRenameUploads);
     httpAddConfig("http.routes", parseRoutes);
@@ -2021,11 +2210,14 @@ PUBLIC int httpInitParser()
     httpAddConfig("http.target", parseTarget);
     httpAddConfig("http.timeouts", parseTimeouts);
     httpAddConfig("http.timeouts.exit", parseTimeoutsExit);
+    httpAddConfig("http.timeouts.granularity", parseTimeoutsGranularity);
     httpAddConfig("http.timeouts.parse", parseTimeoutsParse);
     httpAddConfig("http.timeouts.inactivity", parseTimeoutsInactivity);
     httpAddConfig("http.timeouts.request", parseTimeoutsRequest);
     httpAddConfig("http.timeouts.session", parseTimeoutsSession);
     httpAddConfig("http.trace", parseTrace);
+    httpAddConfig("http.websockets", httpParseAll);
+    httpAddConfig("http.websockets.deflate", parseWebSocketsDeflate);
     httpAddConfig("http.websockets.protocol", parseWebSocketsProtocol);
     httpAddConfig("http.xsrf", parseXsrf);
 
@@ -2036,6 +2228,7 @@ PUBLIC int httpInitParser()
 
 #if ME_HTTP_WEB_SOCKETS
     httpAddConfig("http.limits.webSockets", parseLimitsWebSockets);
+    httpAddConfig("http.limits.webSocketsDeflate", parseLimitsWebSocketsDeflate);
     httpAddConfig("http.limits.webSocketsMessage", parseLimitsWebSocketsMessage);
     httpAddConfig("http.limits.webSocketsPacket", parseLimitsWebSocketsPacket);
     httpAddConfig("http.limits.webSocketsFrame", parseLimitsWebSocketsFrame);
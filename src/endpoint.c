@@ -11,7 +11,12 @@
 /********************************** Forwards **********************************/
 
 static void acceptNet(HttpEndpoint *endpoint);
+static void acceptLoopNet(MprSocket *listen);
+static void acceptOnSocket(HttpEndpoint *endpoint, MprSocket *listen);
+static void closeListeners(HttpEndpoint *endpoint);
+static MprSocket *listenOnEndpoint(HttpEndpoint *endpoint, int flags);
 static int manageEndpoint(HttpEndpoint *endpoint, int flags);
+static int startEventLoops(HttpEndpoint *endpoint, int count);
 
 /************************************ Code ************************************/
 /*
@@ -38,10 +43,7 @@ PUBLIC HttpEndpoint *httpCreateEndpoint(cchar *ip, int port, MprDispatcher *disp
 
 PUBLIC void httpDestroyEndpoint(HttpEndpoint *endpoint)
 {
-    if (endpoint->sock) {
-        mprCloseSocket(endpoint->sock, 0);
-        endpoint->sock = 0;
-    }
+    closeListeners(endpoint);
     httpRemoveEndpoint(endpoint);
 }
 
@@ -55,6 +57,7 @@ static int manageEndpoint(HttpEndpoint *endpoint, int flags)
         mprMark(endpoint->context);
         mprMark(endpoint->limits);
         mprMark(endpoint->sock);
+        mprMark(endpoint->listeners);
         mprMark(endpoint->dispatcher);
         mprMark(endpoint->ssl);
         mprMark(endpoint->mutex);
@@ -142,7 +145,7 @@ PUBLIC int httpStartEndpoint(HttpEndpoint *endpoint)
 {
     HttpHost    *host;
     cchar       *proto, *ip;
-    int         next;
+    int         next, loops;
 
     if (!validateEndpoint(endpoint)) {
         return MPR_ERR_BAD_ARGS;
@@ -150,25 +153,30 @@ PUBLIC int httpStartEndpoint(HttpEndpoint *endpoint)
     for (ITERATE_ITEMS(endpoint->hosts, host, next)) {
         httpStartHost(host);
     }
-    if ((endpoint->sock = mprCreateSocket()) == 0) {
-        return MPR_ERR_MEMORY;
+    /*
+        Event loops require an async endpoint without a caller supplied dispatcher
+     */
+    loops = (endpoint->async && !endpoint->dispatcher && endpoint->limits) ? endpoint->limits->eventLoops : 0;
+    if (loops > 0 && mprGetEventLoop(0) == 0) {
+        mprLog("warn http", 1, "Event loops are not supported on this platform, using the shared event service");
+        loops = 0;
     }
-    if (mprListenOnSocket(endpoint->sock, endpoint->ip, endpoint->port,
-                MPR_SOCKET_NODELAY | MPR_SOCKET_THREAD) == SOCKET_ERROR) {
-        if (mprGetError() == EADDRINUSE) {
-            mprLog("error http", 0, "Cannot open a socket on %s:%d, socket already bound.",
-                *endpoint->ip ? endpoint->ip : "*", endpoint->port);
-        } else {
-            mprLog("error http", 0, "Cannot open a socket on %s:%d", *endpoint->ip ? endpoint->ip : "*", endpoint->port);
-        }
+    if ((endpoint->sock = listenOnEndpoint(endpoint, loops > 0 ? MPR_SOCKET_REUSEPORT : 0)) == 0) {
         return MPR_ERR_CANT_OPEN;
     }
     if (endpoint->http->listenCallback && (endpoint->http->listenCallback)(endpoint) < 0) {
         return MPR_ERR_CANT_OPEN;
     }
     if (endpoint->async && !endpoint->sock->handler) {
-        mprAddSocketHandler(endpoint->sock, MPR_SOCKET_READABLE, endpoint->dispatcher, acceptNet, endpoint,
-            (endpoint->dispatcher ? 0 : MPR_WAIT_NEW_DISPATCHER) | MPR_WAIT_IMMEDIATE);
+        if (loops > 0) {
+            if (startEventLoops(endpoint, loops) < 0) {
+                closeListeners(endpoint);
+                return MPR_ERR_CANT_OPEN;
+            }
+        } else {
+            mprAddSocketHandler(endpoint->sock, MPR_SOCKET_READABLE, endpoint->dispatcher, acceptNet, endpoint,
+                (endpoint->dispatcher ? 0 : MPR_WAIT_NEW_DISPATCHER) | MPR_WAIT_IMMEDIATE);
+        }
     } else {
         mprSetSocketBlockingMode(endpoint->sock, 1);
     }
@@ -191,6 +199,74 @@ PUBLIC void httpStopEndpoint(HttpEndpoint *endpoint)
     for (ITERATE_ITEMS(endpoint->hosts, host, next)) {
         httpStopHost(host);
     }
+    closeListeners(endpoint);
+}
+
+
+static MprSocket *listenOnEndpoint(HttpEndpoint *endpoint, int flags)
+{
+    MprSocket   *sock;
+
+    if ((sock = mprCreateSocket()) == 0) {
+        return 0;
+    }
+    if (mprListenOnSocket(sock, endpoint->ip, endpoint->port,
+                MPR_SOCKET_NODELAY | MPR_SOCKET_THREAD | flags) == SOCKET_ERROR) {
+        if (mprGetError() == EADDRINUSE) {
+            mprLog("error http", 0, "Cannot open a socket on %s:%d, socket already bound.",
+                *endpoint->ip ? endpoint->ip : "*", endpoint->port);
+        } else {
+            mprLog("error http", 0, "Cannot open a socket on %s:%d", *endpoint->ip ? endpoint->ip : "*", endpoint->port);
+        }
+        return 0;
+    }
+    return sock;
+}
+
+
+/*
+    Open a listening socket per event loop. The O/S distributes new connections over the sockets (SO_REUSEPORT) and
+    each connection is then accepted and serviced on the loop thread that owns the socket.
+ */
+static int startEventLoops(HttpEndpoint *endpoint, int count)
+{
+    MprEventService *loop;
+    MprDispatcher   *dispatcher;
+    MprSocket       *sock;
+    int             i;
+
+    endpoint->listeners = mprCreateList(count, 0);
+    for (i = 0; i < count; i++) {
+        if ((loop = mprGetEventLoop(i)) == 0) {
+            return MPR_ERR_CANT_INITIALIZE;
+        }
+        if (i == 0) {
+            sock = endpoint->sock;
+        } else if ((sock = listenOnEndpoint(endpoint, MPR_SOCKET_REUSEPORT)) == 0) {
+            return MPR_ERR_CANT_OPEN;
+        }
+        mprAddItem(endpoint->listeners, sock);
+        sock->data = endpoint;
+        dispatcher = mprCreateLoopDispatcher(loop, "listen", 0);
+        mprAddSocketHandler(sock, MPR_SOCKET_READABLE, dispatcher, acceptLoopNet, sock,
+            MPR_WAIT_NEW_DISPATCHER | MPR_WAIT_IMMEDIATE);
+    }
+    mprLog("info http", 2, "Using %d event loops for %s:%d", count, *endpoint->ip ? endpoint->ip : "*", endpoint->port);
+    return 0;
+}
+
+
+static void closeListeners(HttpEndpoint *endpoint)
+{
+    MprSocket   *sock;
+    int         next;
+
+    for (ITERATE_ITEMS(endpoint->listeners, sock, next)) {
+        if (sock != endpoint->sock) {
+            mprCloseSocket(sock, 0);
+        }
+    }
+    endpoint->listeners = 0;
     if (endpoint->sock) {
         mprCloseSocket(endpoint->sock, 0);
         endpoint->sock = 0;
@@ -204,22 +280,38 @@ PUBLIC void httpStopEndpoint(HttpEndpoint *endpoint)
     event listen masks.
  */
 static void acceptNet(HttpEndpoint *endpoint)
+{
+    acceptOnSocket(endpoint, endpoint->sock);
+}
+
+
+/*
+    Accept on an event loop listener. This runs on the loop thread and the connection dispatcher is created on the
+    same loop so the connection stays pinned to this thread.
+ */
+static void acceptLoopNet(MprSocket *listen)
+{
+    acceptOnSocket(listen->data, listen);
+}
+
+
+static void acceptOnSocket(HttpEndpoint *endpoint, MprSocket *listen)
 {
     MprDispatcher   *dispatcher;
     MprEvent        *event;
     MprSocket       *sock;
     MprWaitHandler  *wp;
 
-    if ((sock = mprAcceptSocket(endpoint->sock)) == 0) {
+    if ((sock = mprAcceptSocket(listen)) == 0) {
         return;
     }
     if (mprShouldDenyNewRequests()) {
         mprCloseSocket(sock, 0);
         return;
     }
-    wp = endpoint->sock->handler;
+    wp = listen->handler;
     if (wp->flags & MPR_WAIT_NEW_DISPATCHER) {
-        dispatcher = mprCreateDispatcher("IO", MPR_DISPATCHER_AUTO);
+        dispatcher = mprCreateLoopDispatcher(wp->dispatcher ? wp->dispatcher->service : 0, "IO", MPR_DISPATCHER_AUTO);
     } else if (wp->dispatcher) {
         dispatcher = wp->dispatcher;
     } else {
@@ -405,7 +497,7 @@ PUBLIC HttpHost *httpLookupHostOnEndpoint(HttpEndpoint *endpoint, cchar *name)
                 return host;
             }
         } else if (host->flags & HTTP_HOST_WILD_REGEXP) {
-            if (pcre_exec(host->nameCompiled, NULL, name, (int) slen(name), 0, 0, matches,
+            if (pcre_exec(host->nameCompiled, host->nameStudy, name, (int) slen(name), 0, 0, matches,
                     sizeof(matches) / sizeof(int)) >= 1) {
                 return host;
             }
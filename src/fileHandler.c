@@ -26,6 +26,7 @@ static ssize readFileData(HttpQueue *q, HttpPacket *packet, MprOff pos, ssize si
 static void readyFileHandler(HttpQueue *q);
 static int rewriteFileHandler(HttpStream *stream);
 static void startFileHandler(HttpQueue *q);
+static bool useSendFile(HttpQueue *q);
 
 /*********************************** Code *************************************/
 /*
@@ -224,7 +225,13 @@ static void startFileHandler(HttpQueue *q)
             if (!tx->outputRanges && tx->chunkSize < 0) {
                 tx->length = tx->entityLength;
             }
+            if (useSendFile(q)) {
+                tx->flags |= HTTP_TX_SENDFILE;
+            }
             httpPutPacket(q, packet);
+        } else {
+            /* Not modified or no body, so there is no entity packet to trigger finalization in the service routine */
+            httpFinalizeOutput(stream);
         }
     } else {
         httpFinalizeOutput(stream);
@@ -232,6 +239,38 @@ static void startFileHandler(HttpQueue *q)
 }
 
 
+/*
+    Determine if the entity packet can be passed unfilled to the connector to be sent via sendfile. This requires
+    plain HTTP/1 (TLS and HTTP/2 framing must see the data) and that all output filters can pass entity packets.
+ */
+static bool useSendFile(HttpQueue *q)
+{
+#if ME_HTTP_SENDFILE
+    HttpStream  *stream;
+    HttpNet     *net;
+    HttpTx      *tx;
+    HttpStage   *stage;
+    int         next;
+
+    stream = q->stream;
+    net = stream->net;
+    tx = stream->tx;
+
+    if (!tx->file || net->protocol != 1 || !net->sock || mprIsSocketSecure(net->sock) || httpClientStream(stream)) {
+        return 0;
+    }
+    for (ITERATE_ITEMS(tx->outputPipeline, stage, next)) {
+        if (stage != tx->handler && !(stage->flags & HTTP_STAGE_ENTITY)) {
+            return 0;
+        }
+    }
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+
 /*
     The ready callback is invoked when all the input body data has been received
     The queue already contains a single data packet representing all the output data.
@@ -336,9 +375,10 @@ static void outgoingFileService(HttpQueue *q)
         The queue will contain an entity packet which holds the position from which to read in the file.
         If the downstream queue is full, the data packet will be put onto the queue ahead of the entity packet.
         When EOF, and END packet will be added to the queue via httpFinalizeOutput which will then be sent.
+        If sending via sendfile, the entity packet is passed unfilled to the connector.
      */
     for (packet = q->first; packet; packet = q->first) {
-        if (packet->fill) {
+        if (packet->fill && !(stream->tx->flags & HTTP_TX_SENDFILE)) {
             size = min(packet->esize, q->packetSize);
             size = min(size, q->nextQ->packetSize);
             if (size > 0) {
@@ -74,6 +74,7 @@ static void manageHost(HttpHost *host, int flags)
         mprMark(host->parent);
         mprMark(host->responseCache);
         mprMark(host->routes);
+        mprMark(host->routeTrie);
         mprMark(host->defaultRoute);
         mprMark(host->defaultEndpoint);
         mprMark(host->secureEndpoint);
@@ -82,6 +83,7 @@ static void manageHost(HttpHost *host, int flags)
     } else if (flags & MPR_MANAGE_FREE) {
         if (host->nameCompiled) {
             free(host->nameCompiled);
+            free(host->nameStudy);
         }
     }
 }
@@ -116,6 +118,7 @@ PUBLIC int httpStartHost(HttpHost *host)
             route->trace = route->parent->trace;
         }
     }
+    httpCompileRoutes(host);
     return 0;
 }
 
@@ -287,11 +290,14 @@ PUBLIC int httpSetHostName(HttpHost *host, cchar *name)
         host->flags |= HTTP_HOST_WILD_REGEXP;
         if (host->nameCompiled) {
             free(host->nameCompiled);
+            free(host->nameStudy);
+            host->nameStudy = 0;
         }
         if ((host->nameCompiled = pcre_compile2(host->hostname, 0, 0, &errMsg, &column, NULL)) == 0) {
             mprLog("error http route", 0, "Cannot compile condition match pattern. Error %s at column %d", errMsg, column);
             return MPR_ERR_BAD_SYNTAX;
         }
+        host->nameStudy = pcre_study(host->nameCompiled, 0, &errMsg);
     }
     return 0;
 }
@@ -308,6 +314,8 @@ PUBLIC int httpAddRoute(HttpHost *host, HttpRoute *route)
         host->routes = mprCloneList(host->parent->routes);
     }
     if (mprLookupItem(host->routes, route) < 0) {
+        /* Route indexes change, so fall back to scanning until the routes are compiled again */
+        host->routeTrie = 0;
         if (route->pattern[0] && (lastRoute = mprGetLastItem(host->routes)) && lastRoute->pattern[0] == '\0') {
             /*
                 Insert non-default route before last default route
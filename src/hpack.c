@@ -78,116 +78,236 @@ static cchar *staticStrings[] = {
 
 #define HTTP2_STATIC_TABLE_ENTRIES ((sizeof(staticStrings) / sizeof(char*) / 2) - 1)
 
+/*
+    Initial capacity of the dynamic table ring. Must be a power of two. The ring grows as entries are added.
+ */
+#define HTTP2_TABLE_ENTRIES 16
+
+/*
+    Entry with insertion number "a" is the "age"th newest entry
+ */
+#define ENTRY_AGE(headers, a)   ((headers)->inserted - (a))
+#define ENTRY_VALID(headers, a) ((a) && ENTRY_AGE(headers, a) < (uint64) (headers)->count)
+
+/********************************** Forwards **********************************/
+
+static bool allocTable(HttpHeaderTable *headers, int capacity);
+static void evictHeader(HttpHeaderTable *headers);
+static uint hashPair(uint nameHash, cchar *value);
+static void linkEntry(HttpHeaderTable *headers, uint64 a);
+static void manageHeaderTable(HttpHeaderTable *headers, int flags);
+
 /*********************************** Code *************************************/
 
 PUBLIC void httpCreatePackedHeaders()
 {
     cchar   **cp;
+    int     index;
 
     /*
-        Create the static table of common headers
+        Create the static table of common headers and an index of the first entry for each name.
+        Static entries with the same name are contiguous.
      */
     HTTP->staticHeaders = mprCreateList(HTTP2_STATIC_TABLE_ENTRIES, 0);
+    HTTP->staticIndex = mprCreateHash(HTTP2_STATIC_TABLE_ENTRIES, MPR_HASH_STATIC_VALUES);
     for (cp = staticStrings; *cp; cp += 2) {
-        mprAddItem(HTTP->staticHeaders, mprCreateKeyPair(cp[0], cp[1], 0));
+        index = mprAddItem(HTTP->staticHeaders, mprCreateKeyPair(cp[0], cp[1], 0)) + 1;
+        if (!mprLookupKey(HTTP->staticIndex, cp[0])) {
+            mprAddKey(HTTP->staticIndex, cp[0], ITOP(index));
+        }
+    }
+}
+
+
+PUBLIC HttpHeaderTable *httpCreatePackedHeaderTable(int max)
+{
+    HttpHeaderTable     *headers;
+
+    if ((headers = mprAllocObj(HttpHeaderTable, manageHeaderTable)) == 0) {
+        return 0;
+    }
+    if (!allocTable(headers, HTTP2_TABLE_ENTRIES)) {
+        return 0;
+    }
+    headers->max = max;
+    return headers;
+}
+
+
+static void manageHeaderTable(HttpHeaderTable *headers, int flags)
+{
+    uint64      a;
+
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(headers->entries);
+        mprMark(headers->names);
+        mprMark(headers->pairs);
+        if (headers->entries) {
+            for (a = headers->inserted - headers->count + 1; a <= headers->inserted; a++) {
+                mprMark(headers->entries[a & headers->mask].kp);
+            }
+        }
     }
 }
 
 
+/*
+    Allocate (or grow) the ring and hash buckets. Existing entries keep their insertion numbers.
+ */
+static bool allocTable(HttpHeaderTable *headers, int capacity)
+{
+    HttpHeaderEntry     *entries, *old;
+    uint64              a;
+    int                 oldMask;
+
+    if ((entries = mprAllocZeroed(capacity * sizeof(HttpHeaderEntry))) == 0) {
+        return 0;
+    }
+    old = headers->entries;
+    oldMask = headers->mask;
+    headers->entries = entries;
+    headers->names = mprAllocZeroed(capacity * sizeof(uint64));
+    headers->pairs = mprAllocZeroed(capacity * sizeof(uint64));
+    headers->mask = capacity - 1;
+    if (headers->names == 0 || headers->pairs == 0) {
+        return 0;
+    }
+    if (old) {
+        /*
+            Relink from oldest to newest so the bucket chains remain ordered newest first
+         */
+        for (a = headers->inserted - headers->count + 1; a <= headers->inserted; a++) {
+            entries[a & headers->mask] = old[a & oldMask];
+            linkEntry(headers, a);
+        }
+    }
+    return 1;
+}
+
+
+static void linkEntry(HttpHeaderTable *headers, uint64 a)
+{
+    HttpHeaderEntry     *ep;
+    uint64              *bucket;
+
+    ep = &headers->entries[a & headers->mask];
+    bucket = &headers->names[ep->nameHash & headers->mask];
+    ep->nameNext = *bucket;
+    *bucket = a;
+    bucket = &headers->pairs[ep->pairHash & headers->mask];
+    ep->pairNext = *bucket;
+    *bucket = a;
+}
+
+
+static uint hashPair(uint nameHash, cchar *value)
+{
+    return (nameHash * 31) ^ shash(value, slen(value));
+}
+
+
+/*
+    Evict the oldest entry. Chains run newest to oldest, so stale links are simply ignored by lookups.
+ */
+static void evictHeader(HttpHeaderTable *headers)
+{
+    HttpHeaderEntry     *ep;
+
+    ep = &headers->entries[(headers->inserted - headers->count + 1) & headers->mask];
+    headers->size -= slen(ep->kp->key) + slen(ep->kp->value) + HTTP2_HEADER_OVERHEAD;
+    ep->kp = 0;
+    headers->count--;
+    assert(headers->size >= 0);
+}
+
+
 /*
     Lookup a key/value in the HPACK header table.
-    Look in the dynamic list first as it will contain most of the headers with values.
+    Prefer a full name/value match in the dynamic then static tables, then a name match in the static table
+    (smaller index) and lastly a name match in the dynamic table.
     Set *withValue if the value matches as well as the name.
     The dynamic table uses indexes after the static table.
  */
 PUBLIC int httpLookupPackedHeader(HttpHeaderTable *headers, cchar *key, cchar *value, bool *withValue)
 {
+    HttpHeaderEntry *ep;
     MprKeyValue     *kp;
-    int             next, onext;
+    uint64          a;
+    uint            nameHash, pairHash;
+    int             index, first;
 
     assert(headers);
     assert(key && *key);
     assert(value && *value);
 
     *withValue = 0;
+    nameHash = shash(key, slen(key));
+    pairHash = hashPair(nameHash, value);
 
-    /*
-        Prefer dynamic table as we can encode more values
-     */
-    for (ITERATE_ITEMS(headers->list, kp, next)) {
-        if (strcmp(key, kp->key) == 0) {
-            onext = next;
-            do {
-                if (smatch(kp->value, value) && smatch(kp->key, key)) {
-                    *withValue = 1;
-                    return next + HTTP2_STATIC_TABLE_ENTRIES;
-                }
-            } while ((kp = mprGetNextItem(headers->list, &next)) != 0);
-            return onext + HTTP2_STATIC_TABLE_ENTRIES;
+    for (a = headers->pairs[pairHash & headers->mask]; ENTRY_VALID(headers, a); a = ep->pairNext) {
+        ep = &headers->entries[a & headers->mask];
+        if (ep->pairHash == pairHash && smatch(ep->kp->key, key) && smatch(ep->kp->value, value)) {
+            *withValue = 1;
+            return (int) (HTTP2_STATIC_TABLE_ENTRIES + 1 + ENTRY_AGE(headers, a));
         }
     }
-
-    for (ITERATE_ITEMS(HTTP->staticHeaders, kp, next)) {
-        if (smatch(key, kp->key)) {
-            if (value && kp->value) {
-                onext = next;
-                do {
-                    if (smatch(kp->value, value) && smatch(kp->key, key)) {
-                        *withValue = 1;
-                        return next;
-                    }
-                } while ((kp = mprGetNextItem(HTTP->staticHeaders, &next)) != 0);
-                return onext;
-            } else {
-                return next;
+    if ((first = (int) PTOI(mprLookupKey(HTTP->staticIndex, key))) > 0) {
+        for (index = first; (kp = mprGetItem(HTTP->staticHeaders, index - 1)) != 0 && smatch(kp->key, key); index++) {
+            if (smatch(kp->value, value)) {
+                *withValue = 1;
+                return index;
             }
         }
+        return first;
+    }
+    for (a = headers->names[nameHash & headers->mask]; ENTRY_VALID(headers, a); a = ep->nameNext) {
+        ep = &headers->entries[a & headers->mask];
+        if (ep->nameHash == nameHash && smatch(ep->kp->key, key)) {
+            return (int) (HTTP2_STATIC_TABLE_ENTRIES + 1 + ENTRY_AGE(headers, a));
+        }
     }
     return 0;
 }
 
 
 /*
-    Add a header to the dynamic table.
+    Add a header to the dynamic table. Returns the index of the new entry or zero if the entry is larger than
+    the table. Per RFC 7541 4.4, such an entry empties the table and is not an error.
  */
 PUBLIC int httpAddPackedHeader(HttpHeaderTable *headers, cchar *key, cchar *value)
 {
-    MprKeyValue     *kp;
-    ssize           len;
-    int             index;
+    HttpHeaderEntry     *ep;
+    MprKeyValue         *kp;
+    ssize               len;
 
     len = slen(key) + slen(value) + HTTP2_HEADER_OVERHEAD;
-    if (len > headers->max) {
-        return MPR_ERR_WONT_FIT;
-    }
+
     /*
         Make room for the new entry if required. Evict the oldest entries first.
      */
-    while ((headers->size + len) >= headers->max) {
-        if (headers->list->length == 0) {
-            break;
-        }
-        kp = mprPopItem(headers->list);
-        headers->size -= (slen(kp->key) + slen(kp->value) + HTTP2_HEADER_OVERHEAD);
-        if (headers->size < 0) {
-            /* Should never happen */
-            assert(0);
-            return MPR_ERR_BAD_STATE;
-        }
+    while (headers->count > 0 && (headers->size + len) > headers->max) {
+        evictHeader(headers);
     }
-    assert (headers->size >= 0 && (headers->size + len) < headers->max);
-
-    /*
-        New entries are inserted at the start of the table and all existing entries shuffle down
-     */
-    if ((index = mprInsertItemAtPos(headers->list, 0, mprCreateKeyPair(key, value, 0))) < 0) {
+    if (len > headers->max) {
+        return 0;
+    }
+    if (headers->count > headers->mask && !allocTable(headers, (headers->mask + 1) * 2)) {
+        return MPR_ERR_MEMORY;
+    }
+    if ((kp = mprCreateKeyPair(key, value, 0)) == 0) {
         return MPR_ERR_MEMORY;
     }
-    index += 1 + HTTP2_STATIC_TABLE_ENTRIES;
+    headers->inserted++;
+    headers->count++;
     headers->size += len;
-    return index;
-}
 
+    ep = &headers->entries[headers->inserted & headers->mask];
+    ep->kp = kp;
+    ep->nameHash = shash(kp->key, slen(kp->key));
+    ep->pairHash = hashPair(ep->nameHash, kp->value);
+    linkEntry(headers, headers->inserted);
+    return HTTP2_STATIC_TABLE_ENTRIES + 1;
+}
 
 
 /*
@@ -195,48 +315,36 @@ PUBLIC int httpAddPackedHeader(HttpHeaderTable *headers, cchar *key, cchar *valu
  */
 PUBLIC int httpSetPackedHeadersMax(HttpHeaderTable *headers, int max)
 {
-    MprKeyValue     *kp;
-
     if (max < 0) {
         return MPR_ERR_BAD_ARGS;
     }
-    if (max >= headers->max) {
-        headers->max = max;
-        return 0;
-    }
     headers->max = max;
-    while (headers->size >= max) {
-        if (headers->list->length == 0) {
-            break;
-        }
-        kp = mprPopItem(headers->list);
-        headers->size -= (slen(kp->key) + slen(kp->value) + HTTP2_HEADER_OVERHEAD);
-        if (headers->size < 0) {
-            /* Should never happen */
-            assert(0);
-            return MPR_ERR_BAD_STATE;
-        }
+    while (headers->count > 0 && headers->size > max) {
+        evictHeader(headers);
     }
     return 0;
 }
 
+
 /*
     Get a header at a specific index.
  */
 PUBLIC MprKeyValue *httpGetPackedHeader(HttpHeaderTable *headers, int index)
 {
-    if (index <= 0 || index > (1 + HTTP2_STATIC_TABLE_ENTRIES + mprGetListLength(headers->list))) {
+    int     age;
+
+    if (index <= 0) {
         return 0;
     }
-    if (--index < HTTP2_STATIC_TABLE_ENTRIES) {
-        return mprGetItem(HTTP->staticHeaders, index);
+    if (index <= HTTP2_STATIC_TABLE_ENTRIES) {
+        return mprGetItem(HTTP->staticHeaders, index - 1);
     }
-    index = index - HTTP2_STATIC_TABLE_ENTRIES;
-    if (index >= mprGetListLength(headers->list)) {
+    age = index - HTTP2_STATIC_TABLE_ENTRIES - 1;
+    if (age >= headers->count) {
         /* Bad index */
         return 0;
     }
-    return mprGetItem(headers->list, index);
+    return headers->entries[(headers->inserted - age) & headers->mask].kp;
 }
 #endif /* ME_HTTP_HTTP2 */
 
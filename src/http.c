@@ -14,12 +14,42 @@
 
 #define MAX_REDIRECTS   10
 
+/*
+    Latency histogram. Values are recorded in microseconds into log-linear buckets: each power of two range is divided
+    into LAT_SUB_COUNT linear sub-buckets so values are recorded with better than 1% precision.
+ */
+#define LAT_SUB_BITS    7
+#define LAT_SUB_COUNT   (1 << LAT_SUB_BITS)
+#define LAT_MAX_SHIFT   (32 - LAT_SUB_BITS - 1)
+#define LAT_MAX_VALUE   0xFFFFFFFF
+#define LAT_BUCKETS     ((LAT_MAX_SHIFT + 2) * LAT_SUB_COUNT)
+
+/*
+    Load statistics. These are collected per thread without locking and are merged when the run completes.
+ */
+typedef struct Stats {
+    uint64          latency[LAT_BUCKETS];   /* Latency histogram counts */
+    uint64          count;                  /* Number of latency samples */
+    uint64          min;                    /* Minimum latency in usec */
+    uint64          max;                    /* Maximum latency in usec */
+    double          sum;                    /* Sum of latencies for the mean */
+    double          sumSquares;             /* Sum of squared latencies for the standard deviation */
+    uint64          status[6];              /* Responses by status class. Index zero is for no status */
+    uint64          connectErrors;          /* Failed connections */
+    uint64          ioErrors;               /* Requests failed due to communications errors */
+    uint64          timeouts;               /* Requests that timed out */
+    uint64          *completions;           /* Requests completed in each second of the run */
+    int             seconds;                /* Size of the completions array */
+} Stats;
+
 typedef struct ThreadData {
     int             activeRequests;
     MprCond         *cond;
     MprDispatcher   *dispatcher;
     HttpNet         *net;
     MprList         *requests;
+    Stats           *stats;
+    int             index;
 } ThreadData;
 
 /*
@@ -34,6 +64,8 @@ typedef struct Request {
     int         retries;            /* Current retry count */
     MprEvent    *timeout;           /* Timeout event */
     ThreadData  *threadData;
+    uint64      due;                /* Time the next request is due to start when pacing in usec */
+    uint64      started;            /* Time the request started in usec */
     bool        written;
 } Request;
 
@@ -45,6 +77,7 @@ typedef struct App {
     cchar       *cert;              /* Certificate to identify the client */
     int         chunkSize;          /* Ask for response data to be chunked in this quanta */
     char        *ciphers;           /* Set of acceptable ciphers to use for SSL */
+    MprTicks    duration;           /* Duration of a load run. Overrides iterations */
     int         continueOnErrors;   /* Continue testing even if an error occurs. Default is to stop */
     int         fetchCount;         /* Total count of fetches */
     cchar       *file;              /* File to put / upload */
@@ -55,11 +88,13 @@ typedef struct App {
     MprBuf      *bodyData;          /* Block body data */
     Mpr         *mpr;               /* Portable runtime */
     MprList     *headers;           /* Request headers */
+    uint64      interval;           /* Interval between requests on each stream when pacing in usec */
     Http        *http;              /* Http service object */
     char        *host;              /* Host to connect to */
     MprFile     *inFile;            /* Input file for post/put data */
     cchar       *ip;                /* First hop IP for the request URL */
     int         iterations;         /* URLs to fetch (per thread) */
+    int         json;               /* Output benchmark results in JSON */
     cchar       *key;               /* Private key file */
     int         loadThreads;        /* Number of threads to use for URL requests */
     int         maxRetries;         /* Times to retry a failed request */
@@ -76,12 +111,14 @@ typedef struct App {
     int         printable;          /* Make binary output printable */
     int         protocol;           /**< HTTP protocol: 0 for HTTP/1.0, 1 for HTTP/1.1 or 2+ */
     char        *ranges;            /* Request ranges */
+    double      rate;               /* Target request rate per second. Zero for a closed loop */
     int         sequence;           /* Sequence requests with a custom header */
     int         status;             /* Status for single requests */
     int         showStatus;         /* Output the Http response status */
     int         showHeaders;        /* Output the response headers */
     int         singleStep;         /* Pause between requests */
     MprSsl      *ssl;               /* SSL configuration */
+    uint64      start;              /* Time the run started in usec */
     int         streams;            /* Number of HTTP/2 streams to spawn */
     int         success;            /* Total success flag */
     cchar       *target;            /* Destination url */
@@ -113,19 +150,25 @@ static char     *extendUrl(cchar *url);
 static void     finishRequest(Request *request);
 static void     finishThread(MprThread *thread);
 static cchar    *formatOutput(HttpStream *stream, cchar *buf, ssize *count);
+static uint64   getMicroseconds(void);
 static char     *getPassword(void);
+static uint64   getPercentile(Stats *stats, double percentile);
 static cchar    *getRedirectUrl(HttpStream *stream, cchar *url);
 static int      initSettings(void);
 static bool     isPort(cchar *name);
 static void     manageApp(App *app, int flags);
 static void     manageRequest(Request *request, int flags);
+static void     manageStats(Stats *stats, int flags);
 static void     manageThreadData(ThreadData *data, int flags);
+static Stats    *mergeStats(void);
 static void     notifier(HttpStream *stream, int event, int arg);
 static int      parseArgs(int argc, char **argv);
 static void     parseStatus(HttpStream *stream);
 static void     prepHeaders(HttpStream *stream);
 static void     readBody(HttpStream *stream);
 static int      processResponse(HttpStream *stream);
+static void     recordRequest(HttpStream *stream, int status);
+static void     report(MprTicks elapsed);
 static int      setContentLength(HttpStream *stream);
 static void     setDefaults(void);
 static int      showUsage(void);
@@ -141,7 +184,6 @@ static ssize    writeBody(HttpStream *stream);
 MAIN(httpMain, int argc, char **argv, char **envp)
 {
     MprTime     start;
-    double      elapsed;
     int         success;
 
     if (mprCreate(argc, argv, MPR_USER_EVENTS_THREAD) == 0) {
@@ -168,22 +210,13 @@ MAIN(httpMain, int argc, char **argv, char **envp)
         exit(2);
     }
     start = mprGetTime();
+    app->start = getMicroseconds();
 
     startThreads();
     mprServiceEvents(-1, 0);
 
     if (app->benchmark) {
-        elapsed = (double) (mprGetTime() - start);
-        if (app->fetchCount == 0) {
-            elapsed = 0;
-            app->fetchCount = 1;
-        }
-        mprPrintf("\nRequest Count:       %13d\n", app->fetchCount);
-        mprPrintf("Time elapsed:        %13.4f sec\n", elapsed / 1000.0);
-        mprPrintf("Time per request:    %13.4f sec\n", elapsed / 1000.0 / app->fetchCount);
-        mprPrintf("Requests per second: %13.4f\n", app->fetchCount * 1.0 / (elapsed / 1000.0));
-        mprPrintf("Load threads:        %13d\n", app->loadThreads);
-        mprPrintf("Worker threads:      %13d\n", app->workers);
+        report(mprGetTime() - start);
     }
     if (!app->success && app->verbose) {
         mprLog("error http", 0, "Request failed");
@@ -393,6 +426,13 @@ static int parseArgs(int argc, char **argv)
         } else if (smatch(argp, "--delete")) {
             app->method = "DELETE";
 
+        } else if (smatch(argp, "--duration")) {
+            if (nextArg >= argc) {
+                return showUsage();
+            } else {
+                app->duration = atoi(argv[++nextArg]) * TPS;
+            }
+
         } else if (smatch(argp, "--form") || smatch(argp, "-f")) {
             if (nextArg >= argc) {
                 return showUsage();
@@ -467,6 +507,10 @@ static int parseArgs(int argc, char **argv)
                 app->iterations = atoi(argv[++nextArg]);
             }
 
+        } else if (smatch(argp, "--json")) {
+            app->json++;
+            app->benchmark++;
+
         } else if (smatch(argp, "--key")) {
             if (nextArg >= argc) {
                 return showUsage();
@@ -553,6 +597,13 @@ static int parseArgs(int argc, char **argv)
                 }
             }
 
+        } else if (smatch(argp, "--rate")) {
+            if (nextArg >= argc) {
+                return showUsage();
+            } else {
+                app->rate = atof(argv[++nextArg]);
+            }
+
         } else if (smatch(argp, "--retries") || smatch(argp, "-r")) {
             if (nextArg >= argc) {
                 return showUsage();
@@ -707,6 +758,16 @@ static int parseArgs(int argc, char **argv)
     if (app->loadThreads > 1 || app->streams > 1) {
         app->nofollow = 1;
     }
+    if (app->duration > 0 || app->rate > 0) {
+        /*
+            Load runs continue despite errors and report the results
+         */
+        app->benchmark++;
+        app->continueOnErrors++;
+        if (app->duration > 0) {
+            app->iterations = MAXINT;
+        }
+    }
     if (app->method == 0) {
         if (app->bodyData || app->formData || app->upload) {
             app->method = "POST";
@@ -777,7 +838,7 @@ static int showUsage()
     mprEprintf("usage: %s [options] [file] url\n"
         "  Options:\n"
         "  --auth basic|digest   # Set authentication type.\n"
-        "  --benchmark           # Compute benchmark results.\n"
+        "  --benchmark           # Compute benchmark results including latency percentiles.\n"
         "  --ca file             # Certificate bundle to use when validating the server certificate.\n"
         "  --cert file           # Certificate to send to the server to identify the client.\n"
         "  --chunk size          # Request response data to use this chunk size.\n"
@@ -787,6 +848,7 @@ static int showUsage()
         "  --data bodyData       # Body data to send with PUT or POST.\n"
         "  --debugger            # Disable timeouts to make running in a debugger easier.\n"
         "  --delete              # Use the DELETE method. Shortcut for --method DELETE..\n"
+        "  --duration secs       # Run requests for this duration instead of a count of iterations.\n"
         "  --form string         # Form data. Must already be form-www-urlencoded.\n"
         "  --frame size          # Set maximum HTTP/2 input frame size (min 16K).\n"
         "  --header 'key: value' # Add a custom request header.\n"
@@ -796,6 +858,7 @@ static int showUsage()
         "  --http2               # Alias for --protocol HTTP/2 (default HTTP/1.1).\n"
 #endif
         "  --iterations count    # Number of times to fetch the URLs per thread (default 1).\n"
+        "  --json                # Output benchmark results in JSON.\n"
         "  --key file            # Private key file.\n"
         "  --log logFile:level   # Log to the file at the verbosity level.\n"
         "  --method KIND         # HTTP request method GET|OPTIONS|POST|PUT|TRACE (default GET).\n"
@@ -808,6 +871,7 @@ static int showUsage()
         "  --protocol PROTO      # Set HTTP protocol to HTTP/1.0, HTTP/1.1 or HTTP/2 (default HTTP/1.1).\n"
         "  --put                 # Use PUT method. Shortcut for --method PUT.\n"
         "  --range byteRanges    # Request a subset range of the document.\n"
+        "  --rate count          # Pace requests at this total rate per second (default as fast as possible).\n"
         "  --retries count       # Number of times to retry failing requests (default 2).\n"
         "  --sequence            # Sequence requests with a custom header.\n"
         "  --showHeaders         # Output response headers.\n"
@@ -840,12 +904,17 @@ static void startThreads()
     }
     app->activeLoadThreads = app->loadThreads;
     app->threadData = mprCreateList(app->loadThreads, 0);
+    if (app->rate > 0) {
+        app->interval = (uint64) (1000000.0 * app->loadThreads * app->streams / app->rate);
+    }
 
     for (j = 0; j < app->loadThreads; j++) {
         char name[64];
         if ((data = mprAllocObj(ThreadData, manageThreadData)) == 0) {
             return;
         }
+        data->stats = mprAllocObj(Stats, manageStats);
+        data->index = j;
         mprAddItem(app->threadData, data);
         fmt(name, sizeof(name), "http.%d", j);
         tp = mprCreateThread(name, threadMain, NULL, 0);
@@ -862,6 +931,15 @@ static void manageThreadData(ThreadData *data, int flags)
         mprMark(data->dispatcher);
         mprMark(data->requests);
         mprMark(data->net);
+        mprMark(data->stats);
+    }
+}
+
+
+static void manageStats(Stats *stats, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(stats->completions);
     }
 }
 
@@ -894,6 +972,7 @@ static void threadMain(void *data, MprThread *thread)
 
     if (httpConnectNet(net, app->ip, app->port, app->ssl) < 0) {
         mprLog("error http", 0, "%s", net->errorMsg);
+        td->stats->connectErrors++;
 
     } else {
         for (i = 0; i < app->streams && app->success; i++) {
@@ -903,6 +982,11 @@ static void threadMain(void *data, MprThread *thread)
                 break;
             }
             request = createRequest(td, stream);
+            if (app->rate > 0) {
+                /* Stagger the first request of each stream across the interval */
+                request->due = app->start + app->interval * (i * app->loadThreads + td->index) /
+                    (app->loadThreads * app->streams);
+            }
             mprAddItem(td->requests, request);
             /* Run serialized on the network dispatcher */
             mprCreateEvent(td->dispatcher, "startRequest", 0, startRequest, request, 0);
@@ -976,9 +1060,30 @@ static void startRequest(Request *request)
 {
     HttpNet     *net;
     HttpStream  *stream;
+    uint64      now;
 
     stream = request->stream;
     net = stream->net;
+    if (app->duration > 0 && getMicroseconds() - app->start >= (uint64) app->duration * 1000) {
+        finishRequest(request);
+        return;
+    }
+    if (app->rate > 0) {
+        /*
+            Open loop pacing. Requests start on schedule and latency is measured from the scheduled start so that
+            a slow server is not excused by delaying requests.
+         */
+        now = getMicroseconds();
+        if (request->due > now + 1000) {
+            mprCreateEvent(stream->dispatcher, "startRequest", (MprTicks) ((request->due - now) / 1000), startRequest,
+                request, 0);
+            return;
+        }
+        request->started = min(request->due, now);
+        request->due += app->interval;
+    } else {
+        request->started = getMicroseconds();
+    }
     if (request->count++ >= app->iterations || (!app->success && !app->continueOnErrors)) {
         finishRequest(request);
         return;
@@ -1002,6 +1107,7 @@ static void startRequest(Request *request)
     }
     if (httpConnect(stream, app->method, app->url, app->ssl) < 0) {
         mprLog("error http", 0, "Failed request for \"%s\". %s.", app->url, net->errorMsg);
+        request->threadData->stats->connectErrors++;
         app->success = 0;
         if (!app->continueOnErrors) {
             mprCreateEvent(stream->dispatcher, "done", 0, mprSignalCond, request->threadData->cond, 0);
@@ -1190,18 +1296,25 @@ static int processResponse(HttpStream *stream)
     HttpRx      *rx;
     MprOff      bytesRead;
     cchar       *msg, *responseHeaders, *sep;
-    int         status;
+    int         level, status;
 
     net = stream->net;
 
     if (!stream->rx) {
         return 0;
     }
+    /*
+        Benchmarks count errors rather than logging each one
+     */
+    level = app->benchmark ? 2 : 0;
     app->status = status = httpGetStatus(stream);
     bytesRead = httpGetContentLength(stream);
     if (bytesRead < 0 && stream->rx) {
         bytesRead = stream->rx->bytesRead;
     }
+    if (app->benchmark) {
+        recordRequest(stream, status);
+    }
     mprDebug("http", 6, "Response status %d, elapsed %lld", status, mprGetTicks() - stream->started);
     if (stream->rx) {
         if (app->showHeaders) {
@@ -1219,10 +1332,10 @@ static int processResponse(HttpStream *stream)
         app->success = 0;
         msg = (stream->errorMsg) ? stream->errorMsg : "";
         sep = (msg && *msg) ? "\n" : "";
-        mprLog("error http", 0, "Failed \"%s\" request for %s%s%s", app->method, app->url, sep, msg);
+        mprLog("error http", level, "Failed \"%s\" request for %s%s%s", app->method, app->url, sep, msg);
 
     } else if (status < 0) {
-        mprLog("error http", 0, "\nCannot process request for \"%s\" %s", app->url, httpGetError(stream));
+        mprLog("error http", level, "\nCannot process request for \"%s\" %s", app->url, httpGetError(stream));
         return MPR_ERR_CANT_READ;
 
     } else if (status == 0 && net->protocol == 0) {
@@ -1233,7 +1346,8 @@ static int processResponse(HttpStream *stream)
             app->success = 0;
         }
         if (!app->showStatus) {
-            mprLog("error http", 0, "\nCannot process request for %s \"%s\" (%d) %s", app->method, app->url, status, httpGetError(stream));
+            mprLog("error http", level, "\nCannot process request for %s \"%s\" (%d) %s", app->method, app->url, status,
+                httpGetError(stream));
             return MPR_ERR_CANT_READ;
         }
     }
@@ -1430,6 +1544,235 @@ static void manageRequest(Request *request, int flags)
 }
 
 
+/*
+    Record the latency and outcome of a completed request
+ */
+static void recordRequest(HttpStream *stream, int status)
+{
+    Request     *request;
+    Stats       *stats;
+    uint64      now, value;
+    int         second, shift, size;
+
+    request = stream->data;
+    stats = request->threadData->stats;
+    now = getMicroseconds();
+
+    if (stream->error) {
+        if (stream->timeout) {
+            stats->timeouts++;
+        } else {
+            stats->ioErrors++;
+        }
+    } else {
+        stats->status[(100 <= status && status < 600) ? status / 100 : 0]++;
+    }
+    value = min(now - request->started, LAT_MAX_VALUE);
+    shift = 0;
+    while ((value >> shift) >= (LAT_SUB_COUNT * 2)) {
+        shift++;
+    }
+    stats->latency[shift * LAT_SUB_COUNT + (value >> shift)]++;
+    if (stats->count++ == 0 || value < stats->min) {
+        stats->min = value;
+    }
+    stats->max = max(stats->max, value);
+    stats->sum += (double) value;
+    stats->sumSquares += (double) value * value;
+
+    second = (int) ((now - app->start) / 1000000);
+    if (second >= stats->seconds) {
+        size = max(second + 1, stats->seconds * 2);
+        stats->completions = mprRealloc(stats->completions, size * sizeof(uint64));
+        memset(&stats->completions[stats->seconds], 0, (size - stats->seconds) * sizeof(uint64));
+        stats->seconds = size;
+    }
+    stats->completions[second]++;
+}
+
+
+/*
+    Merge the statistics from all threads
+ */
+static Stats *mergeStats()
+{
+    ThreadData  *td;
+    Stats       *stats, *ts;
+    int         i, next;
+
+    stats = mprAllocObj(Stats, manageStats);
+    for (ITERATE_ITEMS(app->threadData, td, next)) {
+        ts = td->stats;
+        for (i = 0; i < LAT_BUCKETS; i++) {
+            stats->latency[i] += ts->latency[i];
+        }
+        if (ts->count && (stats->count == 0 || ts->min < stats->min)) {
+            stats->min = ts->min;
+        }
+        stats->count += ts->count;
+        stats->max = max(stats->max, ts->max);
+        stats->sum += ts->sum;
+        stats->sumSquares += ts->sumSquares;
+        for (i = 0; i < 6; i++) {
+            stats->status[i] += ts->status[i];
+        }
+        stats->connectErrors += ts->connectErrors;
+        stats->ioErrors += ts->ioErrors;
+        stats->timeouts += ts->timeouts;
+        if (ts->seconds > stats->seconds) {
+            stats->completions = mprRealloc(stats->completions, ts->seconds * sizeof(uint64));
+            memset(&stats->completions[stats->seconds], 0, (ts->seconds - stats->seconds) * sizeof(uint64));
+            stats->seconds = ts->seconds;
+        }
+        for (i = 0; i < ts->seconds; i++) {
+            stats->completions[i] += ts->completions[i];
+        }
+    }
+    /*
+        Trim seconds without completions at the end of the run
+     */
+    while (stats->seconds > 0 && stats->completions[stats->seconds - 1] == 0) {
+        stats->seconds--;
+    }
+    return stats;
+}
+
+
+/*
+    Return the latency at the given percentile. This is the highest value equivalent to the bucket containing the
+    percentile sample.
+ */
+static uint64 getPercentile(Stats *stats, double percentile)
+{
+    uint64  target, sofar;
+    int     i, shift;
+
+    if (stats->count == 0) {
+        return 0;
+    }
+    target = (uint64) (stats->count * percentile / 100.0 + 0.5);
+    if (target < 1) {
+        target = 1;
+    }
+    sofar = 0;
+    for (i = 0; i < LAT_BUCKETS; i++) {
+        if ((sofar += stats->latency[i]) >= target) {
+            break;
+        }
+    }
+    shift = (i < LAT_SUB_COUNT * 2) ? 0 : i / LAT_SUB_COUNT - 1;
+    return min((((uint64) (i - shift * LAT_SUB_COUNT) + 1) << shift) - 1, stats->max);
+}
+
+
+/*
+    Output the benchmark results
+ */
+static void report(MprTicks elapsed)
+{
+    MprJson     *json;
+    Stats       *stats;
+    double      mean, stdev, rps;
+    uint64      count, p50, p90, p99, p999;
+    int         i;
+
+    stats = mergeStats();
+    /*
+        Count all completed requests including those with error responses
+     */
+    count = max(stats->count, (uint64) app->fetchCount);
+    if (count == 0) {
+        elapsed = 0;
+        count = 1;
+    }
+    rps = elapsed ? count * 1.0 / (elapsed / 1000.0) : 0;
+    mean = stats->count ? stats->sum / stats->count : 0;
+    stdev = stats->count ? sqrt(max(stats->sumSquares / stats->count - mean * mean, 0)) : 0;
+    p50 = getPercentile(stats, 50);
+    p90 = getPercentile(stats, 90);
+    p99 = getPercentile(stats, 99);
+    p999 = getPercentile(stats, 99.9);
+
+    if (app->json) {
+        json = mprCreateJson(MPR_JSON_OBJ);
+        mprSetJson(json, "requests", sfmt("%lld", count), MPR_JSON_NUMBER);
+        mprSetJson(json, "elapsed", sfmt("%.4f", elapsed / 1000.0), MPR_JSON_NUMBER);
+        mprSetJson(json, "requestsPerSecond", sfmt("%.4f", rps), MPR_JSON_NUMBER);
+        mprSetJson(json, "targetRate", sfmt("%.4f", app->rate), MPR_JSON_NUMBER);
+        mprSetJson(json, "threads", sfmt("%d", app->loadThreads), MPR_JSON_NUMBER);
+        mprSetJson(json, "streams", sfmt("%d", app->streams), MPR_JSON_NUMBER);
+        mprSetJson(json, "latency.min", sfmt("%.3f", stats->min / 1000.0), MPR_JSON_NUMBER);
+        mprSetJson(json, "latency.mean", sfmt("%.3f", mean / 1000.0), MPR_JSON_NUMBER);
+        mprSetJson(json, "latency.stdev", sfmt("%.3f", stdev / 1000.0), MPR_JSON_NUMBER);
+        mprSetJson(json, "latency.max", sfmt("%.3f", stats->max / 1000.0), MPR_JSON_NUMBER);
+        mprSetJson(json, "latency.p50", sfmt("%.3f", p50 / 1000.0), MPR_JSON_NUMBER);
+        mprSetJson(json, "latency.p90", sfmt("%.3f", p90 / 1000.0), MPR_JSON_NUMBER);
+        mprSetJson(json, "latency.p99", sfmt("%.3f", p99 / 1000.0), MPR_JSON_NUMBER);
+        mprSetJson(json, "latency.p999", sfmt("%.3f", p999 / 1000.0), MPR_JSON_NUMBER);
+        for (i = 1; i < 6; i++) {
+            mprSetJson(json, sfmt("status.%dxx", i), sfmt("%lld", stats->status[i]), MPR_JSON_NUMBER);
+        }
+        mprSetJson(json, "errors.connect", sfmt("%lld", stats->connectErrors), MPR_JSON_NUMBER);
+        mprSetJson(json, "errors.io", sfmt("%lld", stats->ioErrors), MPR_JSON_NUMBER);
+        mprSetJson(json, "errors.timeout", sfmt("%lld", stats->timeouts), MPR_JSON_NUMBER);
+        mprSetJsonObj(json, "throughput", mprCreateJson(MPR_JSON_ARRAY));
+        for (i = 0; i < stats->seconds; i++) {
+            mprSetJson(json, "throughput[$]", sfmt("%lld", stats->completions[i]), MPR_JSON_NUMBER);
+        }
+        mprPrintf("%s\n", mprJsonToString(json, MPR_JSON_PRETTY | MPR_JSON_QUOTES));
+        return;
+    }
+    mprPrintf("\nRequest Count:       %13lld\n", count);
+    mprPrintf("Time elapsed:        %13.4f sec\n", elapsed / 1000.0);
+    mprPrintf("Time per request:    %13.4f sec\n", elapsed / 1000.0 / count);
+    mprPrintf("Requests per second: %13.4f\n", rps);
+    mprPrintf("Load threads:        %13d\n", app->loadThreads);
+    mprPrintf("Worker threads:      %13d\n", app->workers);
+    if (app->rate > 0) {
+        mprPrintf("Target rate:         %13.4f\n", app->rate);
+    }
+    mprPrintf("\nLatency (msec):  min %.3f, mean %.3f, stdev %.3f, max %.3f\n",
+        stats->min / 1000.0, mean / 1000.0, stdev / 1000.0, stats->max / 1000.0);
+    mprPrintf("  50%%:              %13.3f\n", p50 / 1000.0);
+    mprPrintf("  90%%:              %13.3f\n", p90 / 1000.0);
+    mprPrintf("  99%%:              %13.3f\n", p99 / 1000.0);
+    mprPrintf("  99.9%%:            %13.3f\n", p999 / 1000.0);
+    mprPrintf("\nResponses:           1xx %lld, 2xx %lld, 3xx %lld, 4xx %lld, 5xx %lld\n",
+        stats->status[1], stats->status[2], stats->status[3], stats->status[4], stats->status[5]);
+    mprPrintf("Errors:              connect %lld, timeout %lld, i/o %lld\n",
+        stats->connectErrors, stats->timeouts, stats->ioErrors);
+    if (stats->seconds > 1) {
+        mprPrintf("Throughput (req/sec):");
+        for (i = 0; i < stats->seconds; i++) {
+            mprPrintf(" %lld", stats->completions[i]);
+        }
+        mprPrintf("\n");
+    }
+}
+
+
+/*
+    Return a monotonic time in microseconds for measuring latency
+ */
+static uint64 getMicroseconds()
+{
+#if ME_UNIX_LIKE
+    struct timespec tv;
+
+    clock_gettime(CLOCK_MONOTONIC, &tv);
+    return (uint64) tv.tv_sec * 1000000 + tv.tv_nsec / 1000;
+#elif ME_WIN_LIKE
+    LARGE_INTEGER   freq, now;
+
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (uint64) (now.QuadPart / freq.QuadPart * 1000000 + now.QuadPart % freq.QuadPart * 1000000 / freq.QuadPart);
+#else
+    return (uint64) mprGetTicks() * 1000;
+#endif
+}
+
+
 static void waitForUser()
 {
     int     c;
@@ -49,6 +49,15 @@ struct HttpWebSocket;
 #ifndef ME_HTTP_WEB_SOCKETS
     #define ME_HTTP_WEB_SOCKETS     1
 #endif
+#ifndef ME_HTTP_COMPRESS
+    #define ME_HTTP_COMPRESS        0               /**< Compress responses with gzip or deflate (requires zlib) */
+#endif
+#ifndef ME_HTTP_SENDFILE
+    #define ME_HTTP_SENDFILE        1               /**< Use sendfile() for static file content where possible */
+#endif
+#ifndef ME_HTTP_WRITE_BUDGET
+    #define ME_HTTP_WRITE_BUDGET    (64 * 1024)     /**< HTTP/2 bytes to write per I/O event before reading new frames */
+#endif
 
 /*
     Unlimited limit value
@@ -113,18 +122,27 @@ struct HttpWebSocket;
 #ifndef ME_MAX_CLIENTS_HASH
     #define ME_MAX_CLIENTS_HASH     131                  /**< Hash table for client IP addresses */
 #endif
+#ifndef ME_MAX_ARENA
+    #define ME_MAX_ARENA            0                    /**< Request arena chunk size (0 disables request arenas) */
+#endif
 #ifndef  ME_MAX_CACHE_ITEM
     #define ME_MAX_CACHE_ITEM       (256 * 1024)         /**< Maximum cachable item size */
 #endif
 #ifndef ME_MAX_CHUNK
     #define ME_MAX_CHUNK            (8 * 1024)           /**< Maximum chunk size for transfer chunk encoding */
 #endif
+#ifndef ME_MAX_CREDENTIALS
+    #define ME_MAX_CREDENTIALS      1000                 /**< Maximum cached verified credentials (0 disables the cache) */
+#endif
 #ifndef ME_MAX_CLIENTS
     #define ME_MAX_CLIENTS          32                   /**< Maximum unique client IP addresses */
 #endif
 #ifndef ME_MAX_CONNECTIONS
     #define ME_MAX_CONNECTIONS      50                   /**< Maximum concurrent client endpoints */
 #endif
+#ifndef ME_MAX_EVENT_LOOPS
+    #define ME_MAX_EVENT_LOOPS      0                    /**< Event loop threads per endpoint (0 for the shared loop) */
+#endif
 #ifndef ME_MAX_HPACK_SIZE
     #define ME_MAX_HPACK_SIZE       4096                 /**< Maximum size of the hpack table */
 #endif
@@ -170,12 +188,21 @@ struct HttpWebSocket;
 #ifndef ME_MAX_SESSION_HASH
     #define ME_MAX_SESSION_HASH     31                   /**< Hash table for session data */
 #endif
+#ifndef ME_MAX_SESSION_KEYS
+    #define ME_MAX_SESSION_KEYS     4                    /**< Session token keys retained for key rotation */
+#endif
+#ifndef ME_MAX_SESSION_TOKEN
+    #define ME_MAX_SESSION_TOKEN    4000                 /**< Maximum size of an encrypted session token cookie */
+#endif
 #ifndef ME_MAX_TX_BODY
     #define ME_MAX_TX_BODY          HTTP_UNLIMITED       /**< Maximum buffer for response data */
 #endif
 #ifndef ME_MAX_UPLOAD
     #define ME_MAX_UPLOAD           HTTP_UNLIMITED       /**< Maximum file upload size */
 #endif
+#ifndef ME_MAX_UPLOAD_SPOOL
+    #define ME_MAX_UPLOAD_SPOOL     (256 * 1024)         /**< Upload data batched per background file write */
+#endif
 #ifndef ME_MAX_WSS_FRAME
     #define ME_MAX_WSS_FRAME        (4 * 1024)           /**< Default max WebSockets message frame size */
 #endif
@@ -188,9 +215,18 @@ struct HttpWebSocket;
 #ifndef ME_MAX_WSS_MESSAGE
     #define ME_MAX_WSS_MESSAGE      (2147483647)         /**< Default max WebSockets message size (2GB) */
 #endif
+#ifndef ME_MAX_WSS_BACKLOG
+    #define ME_MAX_WSS_BACKLOG      (256 * 1024)         /**< Default max undelivered broadcast data per subscriber */
+#endif
+#ifndef ME_MAX_WSS_DEFLATE
+    #define ME_MAX_WSS_DEFLATE      (320 * 1024)         /**< Default max permessage-deflate memory per WebSocket */
+#endif
 #ifndef ME_MAX_CACHE_DURATION
     #define ME_MAX_CACHE_DURATION   (86400 * 1000)       /**< Default cache lifespan to 1 day */
 #endif
+#ifndef ME_MAX_CREDENTIAL_DURATION
+    #define ME_MAX_CREDENTIAL_DURATION (5 * 60 * 1000)  /**< Default verified credential cache lifespan (5 mins) */
+#endif
 #ifndef ME_MAX_INACTIVITY_DURATION
     #define ME_MAX_INACTIVITY_DURATION (30  * 1000)     /**< Default keep alive between requests timeout (30 sec) */
 #endif
@@ -225,6 +261,9 @@ struct HttpWebSocket;
 #define HTTP_MAX_SECRET               16                  /**< Size of secret data for auth */
 #define HTTP_SMALL_HASH_SIZE          31                  /* Small hash (less than the alphabet) */
 #define HTTP_TIMER_PERIOD             1000                /**< HttpTimer checks ever 1 second */
+#define HTTP_WHEEL_BITS               6                   /**< Log2 of the timer wheel slots per level */
+#define HTTP_WHEEL_SLOTS              (1 << HTTP_WHEEL_BITS) /**< Timer wheel slots per level */
+#define HTTP_WHEEL_LEVELS             4                   /**< Timer wheel levels (spans 16M ticks) */
 
 #define HTTP_PACKET_ALIGN(x)          (((x) + 0x3FF) & ~0x3FF)
 
@@ -922,6 +961,87 @@ PUBLIC void httpWriteTraceLogFile(HttpTrace *trace, cchar *buf, ssize len);
  */
 PUBLIC cchar *httpMakePrintable(HttpTrace *trace, cchar *buf, bool *hex, ssize *lenp);
 
+/******************************** HttpTimerWheel ******************************/
+/**
+    Timeout entry in the timer wheel.
+    @description Entries are embedded in HttpNet and HttpStream objects. An entry is scheduled for the earliest time
+    its owner could time out. When the slot expires, the owner's deadline is recomputed from its current activity
+    and the entry is either timed out or rescheduled. Activity updates therefore never need to touch the wheel.
+    @ingroup HttpTimerWheel
+    @stability Internal
+ */
+typedef struct HttpWheelEntry {
+    struct HttpWheelEntry *next;            /**< Next entry in the slot (null if not scheduled) */
+    struct HttpWheelEntry *prev;            /**< Previous entry in the slot */
+    struct HttpNet      *net;               /**< Owning network */
+    struct HttpStream   *stream;            /**< Owning stream (null for network entries) */
+    uint64              tick;               /**< Wheel tick when the entry expires */
+} HttpWheelEntry;
+
+/**
+    Hierarchical timer wheel for network and stream timeouts
+    @description The wheel has HTTP_WHEEL_LEVELS levels of HTTP_WHEEL_SLOTS slots. Level zero slots are one tick
+        (the granularity) apart and each higher level slot spans a full rotation of the level below. Entries cascade
+        down a level as the wheel turns, so each timer tick only touches the entries that are due.
+    @defgroup HttpTimerWheel HttpTimerWheel
+    @see httpCancelTimeout httpExpireTimeouts httpScheduleNetTimeout httpScheduleStreamTimeout httpSetTimerGranularity
+    @stability Internal
+ */
+typedef struct HttpTimerWheel {
+    HttpWheelEntry  slots[HTTP_WHEEL_LEVELS][HTTP_WHEEL_SLOTS];    /**< Slot list heads */
+    MprTicks        start;                  /**< Time of tick zero */
+    MprTicks        granularity;            /**< Time per tick */
+    uint64          tick;                   /**< Last tick serviced */
+    int             count;                  /**< Number of scheduled entries */
+    MprMutex        *mutex;                 /**< Multithread sync */
+} HttpTimerWheel;
+
+/**
+    Schedule a network inactivity timeout
+    @description Call when the network limits change. Activity updates do not require rescheduling.
+    @param net HttpNet object
+    @ingroup HttpTimerWheel
+    @stability Internal
+ */
+PUBLIC void httpScheduleNetTimeout(struct HttpNet *net);
+
+/**
+    Schedule a stream parse, inactivity and request timeout
+    @description Call when the stream limits change. Activity updates do not require rescheduling.
+    @param stream HttpStream object
+    @ingroup HttpTimerWheel
+    @stability Internal
+ */
+PUBLIC void httpScheduleStreamTimeout(struct HttpStream *stream);
+
+/**
+    Remove a network or stream from the timer wheel
+    @param entry Timer wheel entry embedded in the HttpNet or HttpStream
+    @ingroup HttpTimerWheel
+    @stability Internal
+ */
+PUBLIC void httpCancelTimeout(HttpWheelEntry *entry);
+
+/**
+    Expire due network and stream timeouts
+    @description Turns the timer wheel to the current time (Http.now) and times out the networks and streams that
+        are due. Those with activity since they were scheduled are rescheduled. This is called by the http timer.
+    @ingroup HttpTimerWheel
+    @stability Internal
+ */
+PUBLIC void httpExpireTimeouts(void);
+
+/**
+    Set the timeout granularity
+    @description Timeouts are checked at this period. The granularity can only be changed while there are no
+        scheduled timeouts, typically when configuring the server.
+    @param granularity Time in milliseconds. Defaults to HTTP_TIMER_PERIOD.
+    @return Zero if successful, otherwise a negative MPR error code.
+    @ingroup HttpTimerWheel
+    @stability Prototype
+ */
+PUBLIC int httpSetTimerGranularity(MprTicks granularity);
+
 /************************************ Http **********************************/
 /**
     Http service object
@@ -941,6 +1061,8 @@ typedef struct Http {
     MprHash         *parsers;               /**< Table config parser callbacks */
     MprHash         *stages;                /**< Possible stages in connection pipelines */
     MprCache        *sessionCache;          /**< Session state cache */
+    MprList         *sessionKeys;           /**< Session token encryption keys. The first key is current. */
+    MprCache        *credentialCache;       /**< Verified password credentials keyed by a keyed hash */
     MprHash         *statusCodes;           /**< Http status codes */
 
     MprHash         *routeSets;             /**< Http route sets functions */
@@ -953,6 +1075,7 @@ typedef struct Http {
     MprHash         *dateCache;             /**< Cache of date modified times */
 
     MprList         *staticHeaders;         /**< HTTP/2 static headers */
+    MprHash         *staticIndex;           /**< HTTP/2 static header index by name */
     MprList         *counters;              /**< List of counters */
     MprList         *monitors;              /**< List of monitors */
     MprHash         *defenses;              /**< List of Defenses */
@@ -966,6 +1089,7 @@ typedef struct Http {
     struct HttpStage *cacheFilter;          /**< Cache filter */
     struct HttpStage *cacheHandler;         /**< Cache filter */
     struct HttpStage *chunkFilter;          /**< Chunked transfer encoding filter */
+    struct HttpStage *compressFilter;       /**< Response compression filter */
     struct HttpStage *httpFilter;           /**< Http filter */
     struct HttpStage *cgiHandler;           /**< CGI handler */
     struct HttpStage *cgiConnector;         /**< CGI connector */
@@ -980,6 +1104,7 @@ typedef struct Http {
     struct HttpStage *netConnector;         /**< Default network connector */
     struct HttpStage *passHandler;          /**< Pass through handler */
     struct HttpStage *phpHandler;           /**< PHP through handler */
+    struct HttpStage *proxyHandler;         /**< Reverse proxy handler */
     struct HttpStage *rangeFilter;          /**< Ranged requests filter */
     struct HttpStage *tailFilter;           /**< Tail filter */
     struct HttpStage *uploadFilter;         /**< Upload filter */
@@ -997,6 +1122,7 @@ typedef struct Http {
 
     MprEvent        *timer;                 /**< Admin service timer */
     MprEvent        *timestamp;             /**< Timestamp timer */
+    HttpTimerWheel  *wheel;                 /**< Network and stream timeouts */
     MprTime         booted;                 /**< Time the server started */
     MprTicks        now;                    /**< Current time in ticks */
     MprMutex        *mutex;                 /**< Multithread sync */
@@ -1012,6 +1138,8 @@ typedef struct Http {
     int             activeProcesses;        /**< Count of active external processes */
     uint64          totalConnections;       /**< Total connections accepted */
     uint64          totalRequests;          /**< Total requests served */
+    int64           credentialHits;         /**< Password verifications served from the credential cache */
+    int64           credentialMisses;       /**< Password verifications that required hashing */
 
     int             flags;                  /**< Open flags */
     void            *context;               /**< Embedding context */
@@ -1339,10 +1467,19 @@ typedef struct HttpStats {
     int     activeProcesses;            /**< Current active processes */
     int     activeRequests;             /**< Current active requests */
     int     activeSessions;             /**< Current active sessions */
+    int     activeCredentials;          /**< Current cached verified credentials */
 
     uint64  totalSweeps;                /**< Total GC sweeps */
+    uint64  gcPauses[MPR_GC_PAUSE_BUCKETS]; /**< Completed GC pause histogram. See MPR_GC_PAUSE_LIMIT for limits */
+    uint64  gcPauseMax;                 /**< Longest completed GC pause in usec */
+    uint64  gcPauseTotal;               /**< Total completed GC pause time in usec */
+    uint64  gcAbandoned;                /**< GC collections abandoned over the sync timeout */
+    uint64  gcAbandonedMax;             /**< Longest wait in usec by an abandoned GC collection */
+    uint64  gcAbandonedTotal;           /**< Total wait in usec by abandoned GC collections */
     uint64  totalRequests;              /**< Total requests served */
     uint64  totalConnections;           /**< Total connections accepted */
+    uint64  credentialHits;             /**< Password verifications served from the credential cache */
+    uint64  credentialMisses;           /**< Password verifications that required hashing */
     uint64  cpuUsage;                   /**< Total process CPU usage in ticks */
     int     cpuCores;
 } HttpStats;
@@ -1375,10 +1512,14 @@ PUBLIC void httpGetStats(HttpStats *sp);
     @stability Internal
  */
 typedef struct HttpLimits {
+    ssize    arenaSize;                 /**< Chunk size of per-request arenas for request lifetime allocations.
+                                             Zero disables request arenas. */
     int      cacheItemSize;             /**< Maximum size of a cachable item */
     ssize    chunkSize;                 /**< Maximum chunk size for transfer encoding */
     int      clientMax;                 /**< Maximum number of unique clients IP addresses */
     int      connectionsMax;            /**< Maximum number of simultaneous client connections */
+    int      eventLoops;                /**< Number of event loop threads that listen for and service connections.
+                                             Zero uses the shared event service and worker pool. */
     int      headerMax;                 /**< Maximum number of header lines */
     int      headerSize;                /**< Maximum size of the total header */
     MprTicks inactivityTimeout;         /**< Timeout for keep-alive and idle requests (msec) */
@@ -1393,11 +1534,14 @@ typedef struct HttpLimits {
     MprOff   rxFormSize;                /**< Maximum size of form data */
     int      sessionMax;                /**< Maximum number of sessions */
     MprTicks sessionTimeout;            /**< Time a session can persist (msec) */
+    int      sessionTokenSize;          /**< Maximum size of an encrypted session token cookie */
     MprOff   txBodySize;                /**< Maximum size of transmission body content */
     MprOff   uploadSize;                /**< Maximum size of an uploaded file */
     int      uriSize;                   /**< Maximum size of a uri */
 
 #if ME_HTTP_WEB_SOCKETS || DOXYGEN
+    int      webSocketsDeflate;         /**< Maximum zlib memory for permessage-deflate per WebSocket. Window sizes are
+                                             reduced to fit. */
     int      webSocketsFrameSize;       /**< Maximum size of sent WebSocket frames. Incoming frames have no limit
                                              except message size.  */
     int      webSocketsMax;             /**< Maximum number of WebSockets */
@@ -1504,6 +1648,19 @@ PUBLIC HttpUri *httpCompleteUri(HttpUri *uri, HttpUri *other);
  */
 PUBLIC HttpUri *httpCreateUri(cchar *uri, int flags);
 
+/**
+    Create and initialize a URI in an arena.
+    @description Parse a uri and return a tokenized HttpUri structure. The structure and its parts are allocated
+        from the given arena.
+    @param arena Arena to allocate from. If NULL, this is equivalent to #httpCreateUri.
+    @param uri Uri string to parse
+    @param flags Set to HTTP_COMPLETE_URI to add missing components. ie. Add scheme, host and port if not supplied.
+    @return A newly allocated HttpUri structure.
+    @ingroup HttpUri
+    @stability Prototype
+ */
+PUBLIC HttpUri *httpCreateUriInArena(MprArena *arena, cchar *uri, int flags);
+
 /**
     Create a URI from parts
     @description This call constructs a URI from the given parts. Various URI parts can be omitted by setting to null.
@@ -1792,6 +1949,7 @@ typedef struct HttpRange {
 #define HTTP_PACKET_DATA        0x4               /**< Packet contains actual content data */
 #define HTTP_PACKET_END         0x8               /**< End of stream packet */
 #define HTTP_PACKET_SOLO        0x10              /**< Don't join this packet */
+#define HTTP_PACKET_FRAMED      0x20              /**< Packet content is a shared, pre-encoded WebSocket frame */
 
 /**
     Callback procedure to fill a packet with data
@@ -1965,6 +2123,22 @@ PUBLIC ssize httpGetPacketLength(HttpPacket *packet);
     #define httpGetPacketLength(p) ((p && p->content) ? mprGetBufLength(p->content) : 0)
 #endif
 
+#if DOXYGEN
+/**
+    Get the length of the packet data including entity data.
+    @description Get the length of data represented by a packet. For entity packets that have not yet been filled,
+        this is the size of the entity (file) data described by the packet. Otherwise it is the length of the
+        buffered data contents. This does not include the prefix.
+    @param packet Packet to examine.
+    @return Count of bytes represented by the packet.
+    @ingroup HttpPacket
+    @stability Evolving
+ */
+PUBLIC MprOff httpGetPacketEntityLength(HttpPacket *packet);
+#else
+    #define httpGetPacketEntityLength(p) ((p && p->esize) ? p->esize : (MprOff) httpGetPacketLength(p))
+#endif
+
 /**
     Get the start of the packet data contents.
     @param packet Packet to examine.
@@ -2023,11 +2197,6 @@ PUBLIC int httpJoinPacket(HttpPacket *packet, HttpPacket *other);
  */
 PUBLIC HttpPacket *httpSplitPacket(HttpPacket *packet, ssize offset);
 
-/*
-    Internal
- */
-#define httpGetPacketEntityLength(p) (p->content ? mprGetBufLength(p->content) : packet->esize)
-
 /************************************* Queue *********************************/
 /*
     Queue directions
@@ -2123,7 +2292,7 @@ typedef struct HttpQueue {
      */
     MprIOVec            iovec[ME_MAX_IOVEC];
     int                 ioIndex;                /**< Next index into iovec */
-    int                 ioFile;                 /**< Sending a file */
+    int                 ioFile;                 /**< Sending a file. The iovec holds a file placeholder entry */
     MprOff              ioCount;                /**< Count of bytes in iovec including file I/O */
     MprOff              ioPos;                  /**< Position in file */
 } HttpQueue;
@@ -2552,6 +2721,7 @@ PUBLIC void httpTraceQueues(struct HttpStream *stream);
 #define HTTP_STAGE_RX             0x40000           /**< Stage to be used in the Rx direction */
 #define HTTP_STAGE_TX             0x80000           /**< Stage to be used in the Tx direction */
 #define HTTP_STAGE_INTERNAL       0x100000          /**< Internal stage - hidden */
+#define HTTP_STAGE_ENTITY         0x200000          /**< Stage can pass unfilled entity packets without reading data */
 
 typedef int (*HttpParse)(cchar *key, char *value, void *state);
 
@@ -2865,10 +3035,12 @@ PUBLIC void httpAddStage(HttpStage *stage);
 PUBLIC ssize httpFilterChunkData(HttpQueue *q, HttpPacket *packet);
 PUBLIC int httpOpenActionHandler(void);
 PUBLIC int httpOpenChunkFilter(void);
+PUBLIC int httpOpenCompressFilter(void);
 PUBLIC int httpOpenCacheHandler(void);
 PUBLIC int httpOpenDirHandler(void);
 PUBLIC int httpOpenFileHandler(void);
 PUBLIC int httpOpenPassHandler(void);
+PUBLIC int httpOpenProxyHandler(void);
 PUBLIC int httpOpenRangeFilter(void);
 PUBLIC int httpOpenNetConnector(void);
 PUBLIC int httpOpenUploadFilter(void);
@@ -2901,6 +3073,7 @@ PUBLIC int httpOpenTailFilter(void);
  */
 #define HTTP2_FRAME_OVERHEAD        9                       /**< Minimum HTTP/2 frame size */
 #define HTTP2_SETTINGS_SIZE         6                       /**< Size of settings frame data */
+#define HTTP2_PRIORITY_SIZE         5                       /**< Size of priority frame data */
 #define HTTP2_WINDOW_SIZE           4                       /**< Size of windows frame data */
 #define HTTP2_RESET_SIZE            4                       /**< Size of rest frame data */
 #define HTTP2_GOAWAY_SIZE           8                       /**< Size of goaway frame data */
@@ -2917,7 +3090,10 @@ PUBLIC int httpOpenTailFilter(void);
  */
 #define HTTP2_MIN_WINDOW            65535                   /**< Initial default window size by spec */
 #define HTTP2_MIN_FRAME_SIZE        (16 * 1024)             /**< Default and minimum frame size - modified by config */
-#define HTTP2_DEFAULT_WEIGHT        16                      /**< Unused */
+#define HTTP2_DEFAULT_WEIGHT        16                      /**< Default stream weight by spec (RFC 7540) */
+#define HTTP2_MAX_WEIGHT            256                     /**< Maximum stream weight by spec (RFC 7540) */
+#define HTTP2_DEFAULT_URGENCY       3                       /**< Default priority urgency by spec (RFC 9218) */
+#define HTTP2_MAX_URGENCY           7                       /**< Lowest priority urgency by spec (RFC 9218) */
 
 /*
     Misc flags and constants
@@ -2929,6 +3105,8 @@ PUBLIC int httpOpenTailFilter(void);
 #define HTTP2_HEADER_TABLE_SIZE     512
 #define HTTP2_TABLE_SIZE            4096
 #define HTTP2_HEADER_OVERHEAD       32                      /**< HPACK table overhead by spec */
+#define HTTP2_HUFF_SCRATCH          1024                    /**< Stack buffer for decoding Huffman header fields */
+#define HTTP2_HUFF_DECODED_MAX(len) (((len) * 8) / 5 + 1)   /**< Decoded size bound. Shortest code is 5 bits */
 #define HTTP_STREAM_MASK            0x7fffffff
 
 /*
@@ -3006,24 +3184,50 @@ typedef struct HttpFrame {
 } HttpFrame;
 
 /**
-    HTTP HPACK header table
+    HTTP HPACK dynamic header table entry
+ */
+typedef struct HttpHeaderEntry {
+    MprKeyValue     *kp;                    /**< Header name and value */
+    uint            nameHash;               /**< Hash of the header name */
+    uint            pairHash;               /**< Hash of the header name and value */
+    uint64          nameNext;               /**< Next older entry in the same name bucket */
+    uint64          pairNext;               /**< Next older entry in the same name/value bucket */
+} HttpHeaderEntry;
+
+/**
+    HTTP HPACK dynamic header table
+    @description Entries are stored in a ring indexed by their insertion number (starting at 1) so that new
+        entries and evictions do not shuffle existing entries. Hash buckets chain entries from newest to oldest
+        by name and by name/value.
  */
 typedef struct HttpHeaderTable {
-    MprList         *list;                  /**< Header list */
-    ssize           size;
-    ssize           max;
+    HttpHeaderEntry *entries;               /**< Ring of entries */
+    uint64          *names;                 /**< Hash buckets by name */
+    uint64          *pairs;                 /**< Hash buckets by name and value */
+    uint64          inserted;               /**< Insertion number of the newest entry */
+    int             count;                  /**< Number of entries in the table */
+    int             mask;                   /**< Ring and bucket capacity less one */
+    ssize           size;                   /**< HPACK size of the table entries */
+    ssize           max;                    /**< Maximum HPACK size of the table */
 } HttpHeaderTable;
 
 /*
     Internal
  */
 PUBLIC void httpCreatePackedHeaders(void);
+PUBLIC HttpHeaderTable *httpCreatePackedHeaderTable(int max);
 PUBLIC int httpLookupPackedHeader(HttpHeaderTable *headers, cchar *key, cchar *value, bool *withValue);
 PUBLIC MprKeyValue *httpGetPackedHeader(HttpHeaderTable *headers, int index);
 PUBLIC int httpAddPackedHeader(HttpHeaderTable *headers, cchar *key, cchar *value);
 PUBLIC int httpSetPackedHeadersMax(HttpHeaderTable *headers, int size);
+PUBLIC void httpCreateHuffTables(void);
+PUBLIC cchar *httpHuffDecode(cuchar *src, ssize len);
+PUBLIC ssize httpHuffDecodeBuf(cuchar *src, ssize len, char *dst, ssize size);
 PUBLIC ssize httpHuffEncode(cchar *src, ssize len, char *dst, uint lower);
-PUBLIC cchar *httpHuffDecode(uchar *src, int len);
+PUBLIC ssize httpHuffEncodedLength(cchar *src, ssize len, uint lower);
+PUBLIC void httpParsePriorityHeader(struct HttpStream *stream, cchar *value);
+PUBLIC HttpPacket *httpSelectHttp2Packet(HttpQueue *q);
+PUBLIC void httpUpdatePriorityTime(struct HttpNet *net, struct HttpStream *stream, ssize len);
 #endif /* ME_HTTP_HTTP2 */
 
 /********************************* Network *************************************/
@@ -3078,6 +3282,9 @@ typedef struct HttpNet {
     HttpHeaderTable *rxHeaders;             /**< Cache of HPACK rx headers */
     HttpHeaderTable *txHeaders;             /**< Cache of HPACK tx headers */
     HttpFrame       *frame;                 /**< Current frame being parsed */
+    uint64          priorityTime;           /**< Virtual time of the HTTP/2 stream scheduler */
+    ssize           ioWritten;              /**< Bytes written since the socket was last known to be writable */
+    int             scheduleMark;           /**< HTTP/2 stream scheduler scan marker */
 #endif
 
     MprDispatcher   *dispatcher;            /**< Event dispatcher */
@@ -3087,6 +3294,7 @@ typedef struct HttpNet {
 
     MprEvent        *timeoutEvent;          /**< Connection or request timeout event */
     MprEvent        *workerEvent;           /**< Event for running connection via a worker thread (used by ejs) */
+    HttpWheelEntry  wheelEntry;             /**< Inactivity timeout entry in the timer wheel */
     MprTicks        lastActivity;           /**< Last activity on the connection */
     MprOff          bytesWritten;           /**< Total bytes written */
 
@@ -3119,6 +3327,7 @@ typedef struct HttpNet {
     bool            receivedGoaway: 1;      /**< Received goaway frame */
     bool            ownDispatcher: 1;       /**< Using own the dispatcher and should destroy when closing connection */
     bool            push: 1;                /**< Receiver will accept push */
+    bool            readBlocked: 1;         /**< Reading is paused until the consumer of the input catches up */
     bool            secure: 1;              /**< Using https */
     bool            skipTrace: 1;           /**< Omit trace from now on */
     bool            worker: 1;              /**< Use worker */
@@ -3492,6 +3701,7 @@ typedef struct HttpStream {
     int             state;                  /**< Stream state */
     struct HttpRx   *rx;                    /**< Rx object for HTTP/1 */
     struct HttpTx   *tx;                    /**< Tx object for HTTP/1 */
+    MprArena        *arena;                 /**< Request lifetime arena. Reset when the request completes */
 
     HttpQueue       *rxHead;                /**< Receive queue head */
     HttpQueue       *txHead;                /**< Transmit queue head */
@@ -3512,6 +3722,7 @@ typedef struct HttpStream {
     MprTicks        started;                /**< When the request started (ticks) */
     MprTicks        lastActivity;           /**< Last activity on the connection */
     MprEvent        *timeoutEvent;          /**< Connection or request timeout event */
+    HttpWheelEntry  wheelEntry;             /**< Timeout entry in the timer wheel */
     HttpTrace       *trace;                 /**< Tracing configuration */
     uint64          startMark;              /**< High resolution tick time of request */
 
@@ -3535,6 +3746,14 @@ typedef struct HttpStream {
     int             streamID;               /**< Http/2 stream */
     int             timeout;                /**< Timeout indication */
 
+#if ME_HTTP_HTTP2 || DOXYGEN
+    uint64          priorityTime;           /**< Scheduler virtual time of the stream's next data frame */
+    int             dependency;             /**< Stream this stream depends upon (RFC 7540) */
+    int             scheduleMark;           /**< Scheduler scan marker. Set if the stream has queued packets */
+    int             urgency;                /**< Priority urgency from 0 (highest) to 7 (RFC 9218) */
+    int             weight;                 /**< Priority weight from 1 to 256 (RFC 7540) */
+#endif
+
     bool            authRequested: 1;       /**< Authorization requested based on user credentials */
     bool            complete: 1;            /**< Request is complete */
     bool            destroyed: 1;           /**< Stream has been destroyed */
@@ -3543,6 +3762,7 @@ typedef struct HttpStream {
     bool            error;                  /**< An error has occurred and the request cannot be completed */
     bool            errorDoc: 1;            /**< Processing an error document */
     bool            followRedirects: 1;     /**< Follow redirects for client requests */
+    bool            incremental: 1;         /**< HTTP/2 response data may be interleaved with peers of equal urgency */
     bool            peerCreated: 1;         /**< Stream created by peer */
     bool            ownDispatcher: 1;       /**< Own the dispatcher and should destroy when closing connection */
     bool            secure: 1;              /**< Using https */
@@ -3550,6 +3770,7 @@ typedef struct HttpStream {
     bool            streamReset: 1;         /**< Stream reset (http2) */
     bool            suppressTrace: 1;       /**< Do not trace this connection */
     bool            upgraded: 1;            /**< Request protocol upgraded */
+    bool            webSocketsDeflate: 1;   /**< Offer WebSockets permessage-deflate (clients) */
 
     /*
         Authentication
@@ -4371,6 +4592,16 @@ PUBLIC HttpUser *httpLookupUser(HttpAuth *auth, cchar *name);
  */
 PUBLIC int httpRemoveRole(HttpAuth *auth, cchar *role);
 
+/**
+    Discard verified credentials
+    @description Passwords stored as Blowfish hashes are costly to verify. Once verified, the credentials are cached
+        under a keyed hash of the username, realm and password so that later requests with the same credentials skip
+        the hashing. The cache is flushed when users are added, updated or removed.
+    @ingroup HttpAuth
+    @stability Evolving
+ */
+PUBLIC void httpFlushCredentials(void);
+
 /**
     Remove a user
     @param auth Auth object allocated by #httpCreateAuth.
@@ -4639,6 +4870,150 @@ typedef struct HttpLang {
     int         flags;                      /**< Control suffix position */
 } HttpLang;
 
+/******************************** HttpCompress ********************************/
+
+#define HTTP_COMPRESS_CACHE         0x1     /**< Save compressed variants in the response cache */
+
+#ifndef HTTP_COMPRESS_LEVEL
+    #define HTTP_COMPRESS_LEVEL     6       /**< Default zlib compression level */
+#endif
+#ifndef HTTP_COMPRESS_MIN_SIZE
+    #define HTTP_COMPRESS_MIN_SIZE  1024    /**< Default minimum response size to compress */
+#endif
+
+/**
+    Response compression configuration for a route
+    @see httpSetRouteCompress
+    @ingroup HttpRoute
+    @stability Prototype
+  */
+typedef struct HttpCompress {
+    MprHash     *types;                     /**< Compressible mime types (null for defaults) */
+    ssize       minSize;                    /**< Minimum response size to compress */
+    int         level;                      /**< Zlib compression level (1-9) */
+    int         flags;                      /**< Compression control flags */
+} HttpCompress;
+
+/********************************* HttpProxy **********************************/
+
+#define HTTP_PROXY_ROUND_ROBIN      0       /**< Select upstreams in turn */
+#define HTTP_PROXY_LEAST_CONN       1       /**< Select the upstream with the fewest active requests */
+
+#ifndef HTTP_PROXY_MAX_IDLE
+    #define HTTP_PROXY_MAX_IDLE     16      /**< Default maximum idle connections kept per upstream */
+#endif
+#ifndef HTTP_PROXY_IDLE_TIMEOUT
+    #define HTTP_PROXY_IDLE_TIMEOUT (30 * 1000) /**< Default time to keep an idle upstream connection */
+#endif
+#ifndef HTTP_PROXY_HEALTH_PERIOD
+    #define HTTP_PROXY_HEALTH_PERIOD (10 * 1000) /**< Default upstream health check period */
+#endif
+#ifndef HTTP_PROXY_MAX_FAILURES
+    #define HTTP_PROXY_MAX_FAILURES 3       /**< Default consecutive failures before an upstream is taken out of service */
+#endif
+
+/**
+    Reverse proxy upstream server
+    @description Each upstream keeps a pool of idle keep-alive network connections. HTTP/2 connections that are
+        in use may also be shared by other requests serviced on the same dispatcher.
+    @see httpAddProxyUpstream
+    @ingroup HttpRoute
+    @stability Prototype
+ */
+typedef struct HttpUpstream {
+    struct HttpProxy *proxy;                /**< Owning proxy */
+    char            *url;                   /**< Base URL of the upstream (scheme, host, port and optional path) */
+    MprSsl          *ssl;                   /**< SSL configuration for https upstreams */
+    MprList         *idle;                  /**< Idle connections available for reuse */
+    MprList         *shared;                /**< Active HTTP/2 connections that may accept more streams */
+    MprMutex        *mutex;                 /**< Multithread sync */
+    HttpNet         *probe;                 /**< Health check connection in progress */
+    int             active;                 /**< Number of active requests */
+    int             failures;               /**< Consecutive request or health check failures */
+    int             healthy;                /**< Upstream is in service */
+} HttpUpstream;
+
+/**
+    Reverse proxy configuration for a route
+    @see httpAddProxyUpstream httpSetRouteProxy
+    @ingroup HttpRoute
+    @stability Prototype
+ */
+typedef struct HttpProxy {
+    MprList         *upstreams;             /**< List of HttpUpstream servers */
+    MprDispatcher   *dispatcher;            /**< Dispatcher for idle connections and health checks */
+    MprEvent        *timer;                 /**< Health check and idle connection pruning timer */
+    MprMutex        *mutex;                 /**< Multithread sync */
+    char            *healthUri;             /**< URI to request to check upstream health (null for passive checks) */
+    MprTicks        healthPeriod;           /**< Period between health checks */
+    MprTicks        idleTimeout;            /**< Time to keep an idle upstream connection */
+    int             balance;                /**< Load balancing method: HTTP_PROXY_ROUND_ROBIN or HTTP_PROXY_LEAST_CONN */
+    int             maxFailures;            /**< Consecutive failures before an upstream is taken out of service */
+    int             maxIdle;                /**< Maximum idle connections per upstream */
+    int             next;                   /**< Next upstream for round robin selection */
+    int             protocol;               /**< HTTP protocol for upstream connections: 1 for HTTP/1.1 or 2 for HTTP/2 */
+} HttpProxy;
+
+/**
+    Create a reverse proxy configuration
+    @description Create a proxy with default settings. Add upstream servers via #httpAddProxyUpstream and then attach
+        the proxy to a route via #httpSetRouteProxy.
+    @param balance Load balancing method. Set to HTTP_PROXY_ROUND_ROBIN or HTTP_PROXY_LEAST_CONN.
+    @param protocol HTTP protocol for upstream connections. Set to 1 for HTTP/1.1 or 2 for HTTP/2.
+    @return A proxy object
+    @ingroup HttpRoute
+    @stability Prototype
+ */
+PUBLIC HttpProxy *httpCreateProxy(int balance, int protocol);
+
+/**
+    Add an upstream server to a proxy
+    @param proxy Proxy object created via #httpCreateProxy
+    @param url Base URL of the upstream server. The request URI is appended to the URL path.
+    @return The upstream object or null if the URL is invalid.
+    @ingroup HttpRoute
+    @stability Prototype
+ */
+PUBLIC HttpUpstream *httpAddProxyUpstream(HttpProxy *proxy, cchar *url);
+
+/**
+    Define how upstream health is checked
+    @description If a health URI is defined, each upstream is requested periodically and is in service if it responds
+        with a 2XX or 3XX status. Otherwise, upstreams are taken out of service after consecutive request failures and
+        are tried again after the health check period.
+    @param proxy Proxy object created via #httpCreateProxy
+    @param uri URI to request. Set to null for passive checks only.
+    @param period Period between checks.
+    @param maxFailures Consecutive failures before an upstream is taken out of service.
+    @ingroup HttpRoute
+    @stability Prototype
+ */
+PUBLIC void httpSetProxyHealth(HttpProxy *proxy, cchar *uri, MprTicks period, int maxFailures);
+
+/**
+    Define the upstream connection pool limits
+    @param proxy Proxy object created via #httpCreateProxy
+    @param maxIdle Maximum number of idle connections to keep per upstream
+    @param idleTimeout Time to keep an idle connection before it is closed
+    @ingroup HttpRoute
+    @stability Prototype
+ */
+PUBLIC void httpSetProxyPool(HttpProxy *proxy, int maxIdle, MprTicks idleTimeout);
+
+/**
+    Proxy requests for a route to upstream servers
+    @description This sets the route handler to the proxyHandler. Requests and responses are streamed between the
+        client and the upstream without buffering the body. Hop-by-hop headers are removed and X-Forwarded-For,
+        X-Forwarded-Host and X-Forwarded-Proto headers are added. The route accepts all request methods unless it
+        defines its own methods.
+    @param route Route to modify
+    @param proxy Proxy object created via #httpCreateProxy. Set to null to disable proxying.
+    @return Zero if successful, otherwise a negative MPR error code.
+    @ingroup HttpRoute
+    @stability Prototype
+ */
+PUBLIC int httpSetRouteProxy(struct HttpRoute *route, HttpProxy *proxy);
+
 /********************************** HttpCache  *********************************/
 
 #define HTTP_CACHE_CLIENT           0x1     /**< Cache on the client side */
@@ -4817,7 +5192,7 @@ PUBLIC void httpSetStreaming(struct HttpHost *host, cchar *mime, cchar *uri, boo
  */
 #define HTTP_ROUTE_NOT                  0x1         /**< Negate the route pattern test result */
 #define HTTP_ROUTE_FREE                 0x2         /**< Free Route.mdata back to malloc when route is freed */
-#define HTTP_ROUTE_FREE_PATTERN         0x4         /**< Free Route.patternCompiled back to malloc when route is freed */
+#define HTTP_ROUTE_FREE_PATTERN         0x4         /**< Free Route.patternCompiled and patternStudy back to malloc when route is freed */
 #define HTTP_ROUTE_RAW                  0x8         /**< Don't html encode the write data */
 #define HTTP_ROUTE_STARTED              0x10        /**< Route initialized */
 #define HTTP_ROUTE_XSRF                 0x20        /**< Generate XSRF tokens */
@@ -4838,6 +5213,9 @@ PUBLIC void httpSetStreaming(struct HttpHost *host, cchar *mime, cchar *uri, boo
 #define HTTP_ROUTE_UTILITY              0x100000    /**< Route hosted by a utility */
 #define HTTP_ROUTE_LAX_COOKIE           0x200000    /**< Session cookie is SameSite=lax */
 #define HTTP_ROUTE_STRICT_COOKIE        0x400000    /**< Session cookie is SameSite=strict */
+#define HTTP_ROUTE_WEB_SOCKETS_DEFLATE  0x800000    /**< Accept the WebSockets permessage-deflate extension */
+#define HTTP_ROUTE_SIMPLE               0x1000000   /**< Pattern is literal text and tokens. Matched without PCRE */
+#define HTTP_ROUTE_SESSION_TOKEN        0x2000000   /**< Store sessions in an encrypted cookie token */
 
 /**
     Route Control
@@ -4906,6 +5284,8 @@ typedef struct HttpRoute {
     MprList         *handlers;              /**< List of handlers for this route */
     HttpStage       *connector;             /**< Network connector to use */
     MprHash         *map;                   /**< Map of alternate extensions (gzip|minified) */
+    struct HttpCompress *compress;          /**< Response compression (null if disabled) */
+    struct HttpProxy *proxy;                /**< Reverse proxy upstreams (null if not proxying) */
     MprHash         *data;                  /**< Hash of extra data configuration */
     MprHash         *vars;                  /**< Route variables. Used to expand Path ${token} refrerences */
     MprHash         *languages;             /**< Languages supported */
@@ -4945,6 +5325,7 @@ typedef struct HttpRoute {
     MprList         *updates;               /**< Route and request updates */
 
     void            *patternCompiled;       /**< Compiled pattern regular expression (not alloced) */
+    void            *patternStudy;          /**< Study data for the compiled pattern (not alloced) */
     cchar           *source;                /**< Final source for route target */
     cchar           *sourceName;            /**< Source name for route target */
     MprList         *tokens;                /**< Tokens in pattern, {name} */
@@ -4967,6 +5348,7 @@ typedef struct HttpRouteOp {
     char            *var;                   /**< Var to set */
     char            *value;                 /**< Value to assign to var */
     void            *mdata;                 /**< pcre_ data (unmanaged) */
+    void            *mextra;                /**< pcre_ study data for mdata (unmanaged) */
     int             flags;                  /**< Route flags to control freeing mdata */
 } HttpRouteOp;
 
@@ -5242,6 +5624,23 @@ PUBLIC int httpAddRouteLanguageSuffix(HttpRoute *route, cchar *language, cchar *
  */
 PUBLIC void httpAddRouteMapping(HttpRoute *route, cchar *extensions, cchar *mappings);
 
+/**
+    Compress responses for the route
+    @description Responses are compressed on the fly with gzip or deflate as selected by the Accept-Encoding request
+        header. Only successful responses of a compressible mime type and at least the minimum size are compressed.
+        Requires ME_HTTP_COMPRESS.
+    @param route Route to modify
+    @param level Zlib compression level from 1 (fastest) to 9 (smallest). Set to zero to disable compression.
+    @param minSize Minimum response size to compress. Set to -1 for the default of HTTP_COMPRESS_MIN_SIZE.
+    @param types Comma separated list of mime types to compress. Types may end with "/ *" to match any subtype.
+        Set to null for the default text, JSON, JavaScript, XML and SVG types.
+    @param flags Set to HTTP_COMPRESS_CACHE to save compressed variants of responses that have an ETag in the
+        host response cache so that unchanged content is not compressed again.
+    @ingroup HttpRoute
+    @stability Prototype
+ */
+PUBLIC void httpSetRouteCompress(HttpRoute *route, int level, ssize minSize, cchar *types, int flags);
+
 /**
     Add HTTP methods for the route
     @description This defines additional HTTP methods for requests to match this route
@@ -5341,6 +5740,18 @@ PUBLIC HttpRoute *httpAddWebSocketsRoute(HttpRoute *route, cchar *action);
  */
 PUBLIC void httpClearRouteStages(HttpRoute *route, int direction);
 
+/**
+    Compile the host routes into a dispatch trie
+    @description Routes are indexed by the literal and {token} segments that start their patterns. Request routing
+        then only tests the routes whose leading segments can match the request path, in their original order.
+        Routes with leading regular expressions are always tested. This is called when the host is started.
+        Adding a route to the host afterwards discards the trie until the routes are compiled again.
+    @param host HttpHost object owning the routes
+    @ingroup HttpRoute
+    @stability Evolving
+ */
+PUBLIC void httpCompileRoutes(struct HttpHost *host);
+
 /**
     Create a route suitable for use as an alias
     @description The parent supplies the owning host for the route. A route is not added to its owning host until it
@@ -5949,6 +6360,17 @@ PUBLIC void httpSetRoutePrefix(HttpRoute *route, cchar *prefix);
  */
 PUBLIC void httpSetRoutePreserveFrames(HttpRoute *route, bool on);
 
+/**
+    Set the route to accept the WebSockets permessage-deflate extension
+    @description When enabled, a client offer of RFC 7692 permessage-deflate is accepted and messages are compressed.
+        The zlib window sizes are reduced to fit the limits->webSocketsDeflate memory limit. Requires ME_HTTP_COMPRESS.
+    @param route Route to modify
+    @param on Set to true to accept permessage-deflate
+    @ingroup HttpRoute
+    @stability Prototype
+ */
+PUBLIC void httpSetRouteWebSocketsDeflate(HttpRoute *route, bool on);
+
 /**
     Control the renaming of uploaded filenames
     @param route Route to modify
@@ -5971,6 +6393,20 @@ PUBLIC void httpSetRouteRenameUploads(HttpRoute *route, bool enable);
  */
 PUBLIC void httpSetRouteScript(HttpRoute *route, cchar *script, cchar *scriptPath);
 
+/**
+    Select the session store for a route
+    @description By default, session state is kept in the server session cache and the client cookie holds only
+        the session ID. The "token" store keeps the session state in the cookie, encrypted and authenticated
+        with the current key from #httpAddSessionKey. The server then holds no session memory and any server
+        sharing the keys can serve the session.
+    @param route Route to modify
+    @param store Set to "cache" or "token"
+    @return Zero if successful, otherwise a negative MPR error code.
+    @ingroup HttpRoute
+    @stability Prototype
+  */
+PUBLIC int httpSetRouteSessionStore(HttpRoute *route, cchar *store);
+
 /**
     Make session cookies that are visible to javascript.
     @description If not visible, cookies will be created with httponly. This helps reduce the XSS risk as
@@ -6217,7 +6653,7 @@ PUBLIC char *httpExpandVars(HttpStream *stream, cchar *str);
 /**
     Session state object
     @defgroup HttpSession HttpSession
-    @see httpAllocSession httpCreateSession httpDestroySession httpGetSession httpGetSessionObj
+    @see httpAddSessionKey httpAllocSession httpCreateSession httpDestroySession httpGetSession httpGetSessionObj
         httpRemoveSessionVar httpGetSessionID httpSetSessionObj httpSetSessionVar
     @stability Internal
  */
@@ -6226,10 +6662,24 @@ typedef struct HttpSession {
     MprCache        *cache;                     /**< Cache store reference */
     MprTicks        lifespan;                   /**< Session inactivity timeout (msecs) */
     MprHash         *data;                      /**< Intermediate session data before writing to cache */
+    MprTime         expires;                    /**< Time the session token expires */
     int             dirty;                      /**< Session updated and needs saving */
     int             seqno;                      /**< Unique sequence number */
+    int             token;                      /**< Session is stored in an encrypted cookie token */
 } HttpSession;
 
+/**
+    Add a session token key
+    @description The key is derived from the secret and becomes the current key used to encrypt session tokens.
+        Prior keys are retained to decrypt existing tokens (ME_MAX_SESSION_KEYS in total), so keys can be rotated
+        without ending sessions. All servers sharing sessions must add the same secrets in the same order.
+    @param secret Secret text. This should be long and random.
+    @return Zero if successful, otherwise a negative MPR error code.
+    @ingroup HttpSession
+    @stability Prototype
+ */
+PUBLIC int httpAddSessionKey(cchar *secret);
+
 /**
     Allocate a new session state object.
     @param stream Http stream object
@@ -6460,6 +6910,102 @@ typedef struct HttpUploadFile {
 #define HTTP_CHUNK_DATA       2             /**< Start of chunk data */
 #define HTTP_CHUNK_EOF        3             /**< End of last chunk */
 
+/*
+    Known header ids. See httpLookupHeaderId.
+ */
+#define HTTP_HEADER_UNKNOWN                     0       /**< Header is not a known header */
+#define HTTP_HEADER_ACCEPT                      1       /**< Accept */
+#define HTTP_HEADER_ACCEPT_CHARSET              2       /**< Accept-Charset */
+#define HTTP_HEADER_ACCEPT_ENCODING             3       /**< Accept-Encoding */
+#define HTTP_HEADER_ACCEPT_LANGUAGE             4       /**< Accept-Language */
+#define HTTP_HEADER_ACCEPT_RANGES               5       /**< Accept-Ranges */
+#define HTTP_HEADER_AUTHORIZATION               6       /**< Authorization */
+#define HTTP_HEADER_CACHE_CONTROL               7       /**< Cache-Control */
+#define HTTP_HEADER_CONNECTION                  8       /**< Connection */
+#define HTTP_HEADER_CONTENT_DISPOSITION         9       /**< Content-Disposition */
+#define HTTP_HEADER_CONTENT_ENCODING            10      /**< Content-Encoding */
+#define HTTP_HEADER_CONTENT_LANGUAGE            11      /**< Content-Language */
+#define HTTP_HEADER_CONTENT_LENGTH              12      /**< Content-Length */
+#define HTTP_HEADER_CONTENT_LOCATION            13      /**< Content-Location */
+#define HTTP_HEADER_CONTENT_RANGE               14      /**< Content-Range */
+#define HTTP_HEADER_CONTENT_TYPE                15      /**< Content-Type */
+#define HTTP_HEADER_COOKIE                      16      /**< Cookie */
+#define HTTP_HEADER_DATE                        17      /**< Date */
+#define HTTP_HEADER_DNT                         18      /**< DNT */
+#define HTTP_HEADER_ETAG                        19      /**< ETag */
+#define HTTP_HEADER_EXPECT                      20      /**< Expect */
+#define HTTP_HEADER_EXPIRES                     21      /**< Expires */
+#define HTTP_HEADER_FORWARDED                   22      /**< Forwarded */
+#define HTTP_HEADER_HOST                        23      /**< Host */
+#define HTTP_HEADER_IF_MATCH                    24      /**< If-Match */
+#define HTTP_HEADER_IF_MODIFIED_SINCE           25      /**< If-Modified-Since */
+#define HTTP_HEADER_IF_NONE_MATCH               26      /**< If-None-Match */
+#define HTTP_HEADER_IF_RANGE                    27      /**< If-Range */
+#define HTTP_HEADER_IF_UNMODIFIED_SINCE         28      /**< If-Unmodified-Since */
+#define HTTP_HEADER_KEEP_ALIVE                  29      /**< Keep-Alive */
+#define HTTP_HEADER_LAST_MODIFIED               30      /**< Last-Modified */
+#define HTTP_HEADER_LOCATION                    31      /**< Location */
+#define HTTP_HEADER_ORIGIN                      32      /**< Origin */
+#define HTTP_HEADER_PRAGMA                      33      /**< Pragma */
+#define HTTP_HEADER_PRIORITY                    34      /**< Priority */
+#define HTTP_HEADER_RANGE                       35      /**< Range */
+#define HTTP_HEADER_REFERER                     36      /**< Referer */
+#define HTTP_HEADER_SEC_CH_UA                   37      /**< Sec-CH-UA */
+#define HTTP_HEADER_SEC_CH_UA_MOBILE            38      /**< Sec-CH-UA-Mobile */
+#define HTTP_HEADER_SEC_CH_UA_PLATFORM          39      /**< Sec-CH-UA-Platform */
+#define HTTP_HEADER_SEC_FETCH_DEST              40      /**< Sec-Fetch-Dest */
+#define HTTP_HEADER_SEC_FETCH_MODE              41      /**< Sec-Fetch-Mode */
+#define HTTP_HEADER_SEC_FETCH_SITE              42      /**< Sec-Fetch-Site */
+#define HTTP_HEADER_SEC_FETCH_USER              43      /**< Sec-Fetch-User */
+#define HTTP_HEADER_SEC_WEBSOCKET_ACCEPT        44      /**< Sec-WebSocket-Accept */
+#define HTTP_HEADER_SEC_WEBSOCKET_EXTENSIONS    45      /**< Sec-WebSocket-Extensions */
+#define HTTP_HEADER_SEC_WEBSOCKET_KEY           46      /**< Sec-WebSocket-Key */
+#define HTTP_HEADER_SEC_WEBSOCKET_PROTOCOL      47      /**< Sec-WebSocket-Protocol */
+#define HTTP_HEADER_SEC_WEBSOCKET_VERSION       48      /**< Sec-WebSocket-Version */
+#define HTTP_HEADER_SERVER                      49      /**< Server */
+#define HTTP_HEADER_SET_COOKIE                  50      /**< Set-Cookie */
+#define HTTP_HEADER_TE                          51      /**< TE */
+#define HTTP_HEADER_TRANSFER_ENCODING           52      /**< Transfer-Encoding */
+#define HTTP_HEADER_UPGRADE                     53      /**< Upgrade */
+#define HTTP_HEADER_UPGRADE_INSECURE_REQUESTS   54      /**< Upgrade-Insecure-Requests */
+#define HTTP_HEADER_USER_AGENT                  55      /**< User-Agent */
+#define HTTP_HEADER_VARY                        56      /**< Vary */
+#define HTTP_HEADER_VIA                         57      /**< Via */
+#define HTTP_HEADER_WWW_AUTHENTICATE            58      /**< WWW-Authenticate */
+#define HTTP_HEADER_X_FORWARDED_FOR             59      /**< X-Forwarded-For */
+#define HTTP_HEADER_X_FORWARDED_HOST            60      /**< X-Forwarded-Host */
+#define HTTP_HEADER_X_FORWARDED_PROTO           61      /**< X-Forwarded-Proto */
+#define HTTP_HEADER_X_REQUESTED_WITH            62      /**< X-Requested-With */
+#define HTTP_HEADER_MAX                         63      /**< Number of known header ids */
+
+/**
+    Parsed header field. The key and value are slices of the scanned buffer and are not null terminated.
+    @ingroup HttpRx
+    @stability Prototype
+ */
+typedef struct HttpHeaderField {
+    cchar           *key;                   /**< Header key */
+    cchar           *value;                 /**< Header value with surrounding white space removed */
+    int             keyLen;                 /**< Length of the key */
+    int             valueLen;               /**< Length of the value */
+    int             id;                     /**< Known header id or HTTP_HEADER_UNKNOWN */
+} HttpHeaderField;
+
+/**
+    Result of scanning a HTTP/1 header block via httpScanHeaders
+    @ingroup HttpRx
+    @stability Prototype
+ */
+typedef struct HttpHeaderScan {
+    cchar           *line;                  /**< Request or status line */
+    ssize           lineLen;                /**< Length of the first line excluding the line terminator */
+    ssize           blank;                  /**< Offset of the blank line terminating the headers */
+    ssize           length;                 /**< Length of the header block including the blank line */
+    HttpHeaderField *fields;                /**< Caller supplied array of fields */
+    int             max;                    /**< Size of the fields array */
+    int             count;                  /**< Number of parsed fields */
+} HttpHeaderScan;
+
 /**
     Http Rx
     @description Most of the APIs in the rx group still take a HttpStream object as their first parameter. This is
@@ -6493,6 +7039,8 @@ typedef struct HttpRx {
     MprList         *etags;                 /**< Document etag to uniquely identify the document version */
     MprList         *files;                 /**< List of uploaded files (HttpUploadFile objects) */
     HttpPacket      *headerPacket;          /**< HTTP headers */
+    char            *authKey;               /**< Credential key of the password verified by a worker */
+    char            *headerFields;          /**< HTTP/1 header fields referenced by the headers hash */
     MprHash         *headers;               /**< Header variables */
     MprList         *inputPipeline;         /**< Input processing */
     HttpUri         *parsedUri;             /**< Parsed request uri */
@@ -6502,6 +7050,10 @@ typedef struct HttpRx {
     int             chunkState;             /**< Chunk encoding state */
     int             flags;                  /**< Rx modifiers */
 
+    bool            authAsync: 1;           /**< Passwords may be verified by a worker while routing */
+    bool            authPending: 1;         /**< Password is being verified by a worker. Routing resumes when done */
+    bool            authRejected: 1;        /**< Worker rejected the password */
+    bool            authVerified: 1;        /**< Worker verified the password */
     bool            authenticateProbed: 1;  /**< Request has been authenticated */
     bool            authenticated: 1;       /**< Request has been authenticated */
     bool            autoDelete: 1;          /**< Automatically delete uploaded files */
@@ -6516,6 +7068,7 @@ typedef struct HttpRx {
     bool            sessionProbed: 1;       /**< Session has been resolved */
     bool            streaming: 1;           /**< Stream incoming content. Forms typically buffer and dont stream */
     bool            upload: 1;              /**< Request is using file upload */
+    bool            uploadPending: 1;       /**< Uploaded data is still being written to disk */
 
     /*
         Incoming response line if a client request
@@ -6702,7 +7255,8 @@ PUBLIC cchar *httpGetHeader(HttpStream *stream, cchar *key);
 
 /**
     Get the hash table of rx Http headers
-    @description Get the internal hash table of rx headers
+    @description Get the internal hash table of rx headers. For HTTP/1, the keys and values reference the parsed
+        header fields and are not marked by the hash. Keys or values added by the caller must be retained by the caller.
     @param stream HttpStream stream object created via #httpCreateStream
     @return Hash table. See MprHash for how to access the hash table.
     @ingroup HttpRx
@@ -6710,6 +7264,44 @@ PUBLIC cchar *httpGetHeader(HttpStream *stream, cchar *key);
  */
 PUBLIC MprHash *httpGetHeaderHash(HttpStream *stream);
 
+/**
+    Get the canonical name of a known header
+    @param id Known header id. See httpLookupHeaderId.
+    @return The header name or null if the id is not a known header id.
+    @ingroup HttpRx
+    @stability Prototype
+ */
+PUBLIC cchar *httpGetHeaderName(int id);
+
+/**
+    Lookup a known header id
+    @description Known headers are resolved via a perfect hash without allocating memory. The key comparison
+        ignores case. Keys containing characters that are not valid in a header token are unknown.
+    @param key Header key. Does not need to be null terminated.
+    @param len Length of the key.
+    @return The known header id or HTTP_HEADER_UNKNOWN.
+    @ingroup HttpRx
+    @stability Prototype
+ */
+PUBLIC int httpLookupHeaderId(cchar *key, ssize len);
+
+/**
+    Scan a HTTP/1 header block
+    @description Scan the request or status line and the header fields in a single pass. Line terminators and key
+        delimiters are located using SIMD instructions where available. Keys are validated and known keys are
+        resolved to header ids. Lines must be terminated by "\r\n" and a bare carriage return or newline is
+        rejected. The buffer is not modified and the parsed fields reference the buffer.
+    @param scan Scan result. The caller must set scan->fields and scan->max before calling.
+    @param buf Buffer containing the header block. Leading blank lines should have been removed.
+    @param len Length of the buffer.
+    @return Zero if a complete header block was scanned. Returns MPR_ERR_NOT_READY if the block is not complete,
+        MPR_ERR_WONT_FIT if there are more than scan->max fields and MPR_ERR_BAD_FORMAT if a line or field is
+        malformed.
+    @ingroup HttpRx
+    @stability Prototype
+ */
+PUBLIC int httpScanHeaders(HttpHeaderScan *scan, cchar *buf, ssize len);
+
 /**
     Get all the request http headers.
     @description Get all the rx headers. The returned string formats all the headers in the form:
@@ -7046,10 +7638,11 @@ PUBLIC void httpProcessWriteEvent(HttpStream *stream);
 #define HTTP_TX_HEADERS_CREATED     0x2     /**< Response headers have been created */
 #define HTTP_TX_USE_OWN_HEADERS     0x8     /**< Skip adding default headers */
 #define HTTP_TX_NO_CHECK            0x10    /**< Do not check if the filename is inside the route documents directory */
-#define HTTP_TX_NO_LENGTH           0x20    /**< Do not emit a content length (used for TRACE) */
+#define HTTP_TX_NO_LENGTH           0x20    /**< Do not emit a content length (used for TRACE and compressed HEAD) */
 #define HTTP_TX_NO_MAP              0x40    /**< Do not map the filename to compressed or minified alternatives */
 #define HTTP_TX_PIPELINE            0x80    /**< Created Tx pipeline */
 #define HTTP_TX_HAS_FILTERS         0x100   /**< Has output filters */
+#define HTTP_TX_SENDFILE            0x200   /**< Send entity packets from the file via sendfile in the connector */
 
 /**
     Http Tx
@@ -7095,6 +7688,7 @@ typedef struct HttpTx {
     MprBuf          *cacheBuffer;           /**< Response caching buffer */
     ssize           cacheBufferLength;      /**< Current size of the cache buffer data */
     cchar           *cachedContent;         /**< Retrieved cached response to send */
+    ssize           cachedLength;           /**< Length of the cached response record */
     MprOff          entityLength;           /**< Original content length before range subsetting */
     cchar           *errorDocument;         /**< Error document to render */
     cchar           *ext;                   /**< Filename extension */
@@ -7695,6 +8289,7 @@ typedef struct HttpEndpoint {
     void            *context;               /**< Embedding context */
     HttpLimits      *limits;                /**< Alias for first host, default route resource limits */
     MprSocket       *sock;                  /**< Listening socket */
+    MprList         *listeners;             /**< Listening sockets, one per event loop (SO_REUSEPORT) */
     MprDispatcher   *dispatcher;            /**< Event dispatcher */
     HttpNotifier    notifier;               /**< Default connection notifier callback */
     MprSsl          *ssl;                   /**< SSL configurations to use */
@@ -7922,11 +8517,13 @@ typedef struct HttpHost {
     struct HttpHost *parent;                /**< Parent host to inherit aliases, dirs, routes */
     MprCache        *responseCache;         /**< Response content caching store */
     MprList         *routes;                /**< List of Route defintions */
+    struct HttpRouteTrie *routeTrie;        /**< Compiled route dispatch trie */
     HttpRoute       *defaultRoute;          /**< Default route for the host */
     HttpEndpoint    *defaultEndpoint;       /**< Default endpoint for host */
     HttpEndpoint    *secureEndpoint;        /**< Secure endpoint for host */
     MprHash         *streams;               /**< Hash of mime-types to stream record */
     void            *nameCompiled;          /**< Compiled name regular expression (not alloced) */
+    void            *nameStudy;             /**< Study data for the compiled name (not alloced) */
     int             flags;                  /**< Host flags */
 } HttpHost;
 
@@ -8136,7 +8733,8 @@ PUBLIC void httpStopHost(HttpHost *host);
     @defgroup HttpWebSocket HttpWebSocket
     @see httpGetWebSocketCloseReason httpGetWebSocketData httpGetWebSocketMessageLength httpGetWebSocketProtocol
         httpGetWebSocketState httpGetWriteQueueCount httpIsLastPacket httpSend httpSendBlock httpSendClose
-        httpSetWebSocketPreserveFrames httpSetWebSocketData httpSetWebSocketProtocols httpWebSocketOrderlyClosed
+        httpSetWebSocketPreserveFrames httpSetWebSocketData httpSetWebSocketDeflate httpSetWebSocketProtocols
+        httpWebSocketOrderlyClosed
     @stability Internal
  */
 typedef struct HttpWebSocket {
@@ -8161,6 +8759,8 @@ typedef struct HttpWebSocket {
     cchar           *errorMsg;              /**< Error message for last I/O */
     cchar           *closeReason;           /**< Reason for closure */
     void            *data;                  /**< Custom data for applications (marked) */
+    void            *deflate;               /**< Negotiated permessage-deflate state */
+    MprList         *broadcasts;            /**< Broadcast groups joined by this stream */
     uchar           dataMask[4];            /**< Mask for data */
 } HttpWebSocket;
 
@@ -8259,6 +8859,21 @@ PUBLIC char *httpGetWebSocketProtocol(HttpStream *stream);
  */
 PUBLIC ssize httpGetWebSocketState(HttpStream *stream);
 
+/**
+    Mask or unmask WebSocket frame data
+    @description XOR the data with the 4 byte frame mask. The data is processed in machine words and uses SSE2 or AVX2
+        instructions where the CPU supports them. The offset into the mask rolls across calls so a frame may be
+        processed in pieces as its packets arrive.
+    @param data Data to mask in-situ
+    @param len Length of data
+    @param mask Four byte frame mask
+    @param offset Offset into the mask for the first byte of data
+    @return The mask offset for the byte following the data
+    @ingroup HttpWebSocket
+    @stability Prototype
+ */
+PUBLIC int httpMaskWebSocketData(char *data, ssize len, cuchar *mask, int offset);
+
 /**
     Send a UTF-8 text message to the WebSocket peer
     @description This call invokes httpSend with a type of WS_MSG_TEXT and flags of HTTP_BUFFER.
@@ -8345,6 +8960,17 @@ PUBLIC ssize httpSendClose(HttpStream *stream, int status, cchar *reason);
  */
 PUBLIC void httpSetWebSocketData(HttpStream *stream, void *data);
 
+/**
+    Offer the permessage-deflate extension when connecting
+    @description Clients call this before httpConnect. If the server accepts the RFC 7692 permessage-deflate extension,
+        messages in both directions are compressed. Requires ME_HTTP_COMPRESS.
+    @param stream HttpStream stream object created via #httpCreateStream
+    @param on Set to true to offer permessage-deflate
+    @ingroup HttpWebSocket
+    @stability Prototype
+ */
+PUBLIC void httpSetWebSocketDeflate(HttpStream *stream, bool on);
+
 /**
     Preserve frames for incoming messages
     @description This routine enables user control of message framing.
@@ -8391,6 +9017,83 @@ PUBLIC int httpUpgradeWebSocket(HttpStream *stream);
  */
 PUBLIC bool httpWebSocketOrderlyClosed(HttpStream *stream);
 
+/*
+    Broadcast back-pressure policies for subscribers whose backlog exceeds the group limit
+ */
+#define HTTP_BROADCAST_DROP         0x1         /**< Drop new messages for the subscriber */
+#define HTTP_BROADCAST_COALESCE     0x2         /**< Replace undelivered messages with the latest message */
+#define HTTP_BROADCAST_DISCONNECT   0x3         /**< Disconnect the subscriber */
+
+/**
+    WebSocket broadcast group
+    @description A broadcast group sends the same message to many server-side WebSocket streams. Each message is
+        encoded once into an immutable frame that is shared by all subscriber queues, so the memory for a message
+        does not grow with the number of subscribers. Slow subscribers are managed by the group back-pressure policy.
+    @defgroup HttpBroadcast HttpBroadcast
+    @see httpBroadcast httpCreateBroadcast httpJoinBroadcast httpLeaveBroadcast
+    @stability Prototype
+ */
+typedef struct HttpBroadcast {
+    MprList         *subscribers;           /**< List of subscribers */
+    MprMutex        *mutex;                 /**< Multithread sync */
+    ssize           maxBacklog;             /**< Maximum undelivered data per subscriber before applying the policy */
+    int             policy;                 /**< Back-pressure policy */
+    int64           sent;                   /**< Messages broadcast */
+    int64           dropped;                /**< Subscriber messages dropped or coalesced */
+    int64           disconnected;           /**< Subscribers disconnected for being too slow */
+} HttpBroadcast;
+
+/**
+    Send a message to all subscribers of a broadcast group
+    @description The message is encoded once as a single WebSocket frame and queued for each subscriber. This
+        routine may be called from any MPR thread. Delivery to each subscriber runs on the subscriber's dispatcher.
+        Subscribers that have fallen behind by more than the group backlog limit are handled by the group policy.
+        Broadcast messages are sent uncompressed and must not be interleaved with fragmented messages sent via
+        httpSendBlock and HTTP_MORE.
+    @param group Broadcast group created via #httpCreateBroadcast
+    @param type Message type. Set to WS_MSG_TEXT or WS_MSG_BINARY.
+    @param buf Message data
+    @param len Length of the message. Set to -1 to use the string length of buf.
+    @return The number of subscribers the message was queued for or a negative MPR error code.
+    @ingroup HttpBroadcast
+    @stability Prototype
+ */
+PUBLIC int httpBroadcast(HttpBroadcast *group, int type, cchar *buf, ssize len);
+
+/**
+    Create a broadcast group
+    @param policy Back-pressure policy for slow subscribers. Set to HTTP_BROADCAST_DROP, HTTP_BROADCAST_COALESCE
+        or HTTP_BROADCAST_DISCONNECT.
+    @param maxBacklog Maximum undelivered data per subscriber before the policy applies. Set to zero for the
+        default of ME_MAX_WSS_BACKLOG.
+    @return The broadcast group. The caller must retain a reference to the group.
+    @ingroup HttpBroadcast
+    @stability Prototype
+ */
+PUBLIC HttpBroadcast *httpCreateBroadcast(int policy, ssize maxBacklog);
+
+/**
+    Add a WebSocket stream to a broadcast group
+    @description Only server-side streams may join as client frames must be individually masked. The stream leaves
+        the group automatically when it closes. Call this on the stream's dispatcher.
+    @param group Broadcast group created via #httpCreateBroadcast
+    @param stream Upgraded server-side WebSocket stream
+    @return Zero if successful, otherwise a negative MPR error code.
+    @ingroup HttpBroadcast
+    @stability Prototype
+ */
+PUBLIC int httpJoinBroadcast(HttpBroadcast *group, HttpStream *stream);
+
+/**
+    Remove a WebSocket stream from a broadcast group
+    @description Undelivered messages for the stream are discarded. Call this on the stream's dispatcher.
+    @param group Broadcast group created via #httpCreateBroadcast
+    @param stream Stream to remove
+    @ingroup HttpBroadcast
+    @stability Prototype
+ */
+PUBLIC void httpLeaveBroadcast(HttpBroadcast *group, HttpStream *stream);
+
 /************************************ Dir  *****************************************/
 /**
     Directory object for the DirHandler
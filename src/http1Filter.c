@@ -8,20 +8,157 @@
 
 #include    "http.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ME_HTTP_SSE2 1
+    #include    <emmintrin.h>
+#endif
+
+/*********************************** Locals ***********************************/
+/*
+    Seed for the known header hash. This was selected so that all known headers hash to unique slots.
+ */
+#define HEADER_HASH_SEED    5531
+#define HEADER_HASH_SLOTS   256
+
+/*
+    Known header names indexed by header id
+ */
+static cchar *headerNames[HTTP_HEADER_MAX] = {
+    0,
+    "Accept",
+    "Accept-Charset",
+    "Accept-Encoding",
+    "Accept-Language",
+    "Accept-Ranges",
+    "Authorization",
+    "Cache-Control",
+    "Connection",
+    "Content-Disposition",
+    "Content-Encoding",
+    "Content-Language",
+    "Content-Length",
+    "Content-Location",
+    "Content-Range",
+    "Content-Type",
+    "Cookie",
+    "Date",
+    "DNT",
+    "ETag",
+    "Expect",
+    "Expires",
+    "Forwarded",
+    "Host",
+    "If-Match",
+    "If-Modified-Since",
+    "If-None-Match",
+    "If-Range",
+    "If-Unmodified-Since",
+    "Keep-Alive",
+    "Last-Modified",
+    "Location",
+    "Origin",
+    "Pragma",
+    "Priority",
+    "Range",
+    "Referer",
+    "Sec-CH-UA",
+    "Sec-CH-UA-Mobile",
+    "Sec-CH-UA-Platform",
+    "Sec-Fetch-Dest",
+    "Sec-Fetch-Mode",
+    "Sec-Fetch-Site",
+    "Sec-Fetch-User",
+    "Sec-WebSocket-Accept",
+    "Sec-WebSocket-Extensions",
+    "Sec-WebSocket-Key",
+    "Sec-WebSocket-Protocol",
+    "Sec-WebSocket-Version",
+    "Server",
+    "Set-Cookie",
+    "TE",
+    "Transfer-Encoding",
+    "Upgrade",
+    "Upgrade-Insecure-Requests",
+    "User-Agent",
+    "Vary",
+    "Via",
+    "WWW-Authenticate",
+    "X-Forwarded-For",
+    "X-Forwarded-Host",
+    "X-Forwarded-Proto",
+    "X-Requested-With",
+};
+
+/*
+    Managed header keys indexed by header id. Used as header hash keys without allocating.
+ */
+static char *headerKeys[HTTP_HEADER_MAX];
+
+/*
+    Header id for each hash slot
+ */
+static uchar headerSlots[HEADER_HASH_SLOTS];
+
+/*
+    Known header name lengths indexed by header id
+ */
+static uchar headerLengths[HTTP_HEADER_MAX];
+
+#if ME_HTTP_SSE2
+/*
+    Header delimiter vectors. These are set once so scanning does not rebuild them for each block.
+ */
+static __m128i crVector, lfVector, colonVector;
+#endif
+
+/*
+    Valid header key characters (RFC 7230 tchar)
+ */
+static const uchar tokenChars[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0,
+};
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define getFirstBit(bits) __builtin_ctzll(bits)
+#else
+static int getFirstBit(uint64 bits)
+{
+    int     i;
+
+    for (i = 0; !(bits & 1); i++) {
+        bits >>= 1;
+    }
+    return i;
+}
+#endif
+
 /********************************** Forwards **********************************/
 
+static HttpPacket *badHeaders(HttpQueue *q, HttpPacket *packet);
+static uint64 findDelimiters(cchar *block, cchar *end);
 static HttpStream *findStream(HttpQueue *q);
-static char *getToken(HttpPacket *packet, cchar *delim);
-static bool gotHeaders(HttpQueue *q, HttpPacket *packet);
+static int findHeaderId(cchar *key, ssize len, uint hash);
+static cchar *getWord(cchar **pos, cchar *end, ssize *len);
+static int gotHeaders(HttpQueue *q, HttpPacket *packet, HttpHeaderScan *scan);
 static void incomingHttp1(HttpQueue *q, HttpPacket *packet);
+static void initHeaderIds(HttpStage *filter);
 static bool monitorActiveRequests(HttpStream *stream);
 static void outgoingHttp1(HttpQueue *q, HttpPacket *packet);
 static void outgoingHttp1Service(HttpQueue *q);
-static HttpPacket *parseFields(HttpQueue *q, HttpPacket *packet);
+static HttpPacket *parseFields(HttpQueue *q, HttpPacket *packet, HttpHeaderScan *scan);
 static HttpPacket *parseHeaders(HttpQueue *q, HttpPacket *packet);
-static void parseRequestLine(HttpQueue *q, HttpPacket *packet);
-static void parseResponseLine(HttpQueue *q, HttpPacket *packet);
+static void parseRequestLine(HttpQueue *q, HttpHeaderScan *scan);
+static void parseResponseLine(HttpQueue *q, HttpHeaderScan *scan);
 static void logPacket(HttpQueue *q, HttpPacket *packet);
+static int scanLine(HttpHeaderScan *scan, cchar *buf, cchar *line, cchar *colon, cchar *eol);
+static char *upperToken(MprArena *arena, cchar *token, ssize len);
 
 /*********************************** Code *************************************/
 /*
@@ -38,10 +175,43 @@ PUBLIC int httpOpenHttp1Filter()
     filter->incoming = incomingHttp1;
     filter->outgoing = outgoingHttp1;
     filter->outgoingService = outgoingHttp1Service;
+    initHeaderIds(filter);
     return 0;
 }
 
 
+/*
+    Build the known header hash table and the managed header keys. The keys are retained by the filter.
+ */
+static void initHeaderIds(HttpStage *filter)
+{
+    MprList     *keys;
+    cchar       *name;
+    uint        hash;
+    int         id;
+
+    keys = mprCreateList(HTTP_HEADER_MAX, MPR_LIST_STABLE);
+    for (id = 1; id < HTTP_HEADER_MAX; id++) {
+        name = headerNames[id];
+        for (hash = HEADER_HASH_SEED; *name; name++) {
+            hash = (hash ^ ((uchar) *name | 0x20)) * 0x01000193;
+        }
+        hash = (hash ^ (hash >> 16)) & (HEADER_HASH_SLOTS - 1);
+        assert(headerSlots[hash] == 0);
+        headerSlots[hash] = (uchar) id;
+        headerLengths[id] = (uchar) slen(headerNames[id]);
+        headerKeys[id] = sclone(headerNames[id]);
+        mprAddItem(keys, headerKeys[id]);
+    }
+    filter->stageData = keys;
+#if ME_HTTP_SSE2
+    crVector = _mm_set1_epi8('\r');
+    lfVector = _mm_set1_epi8('\n');
+    colonVector = _mm_set1_epi8(':');
+#endif
+}
+
+
 /*
     The queue is the net->inputq == netHttp-rx
  */
@@ -70,6 +240,13 @@ static void incomingHttp1(HttpQueue *q, HttpPacket *packet)
             }
         }
         if (packet) {
+            if (httpServerStream(stream) && stream->rx->eof) {
+                /*
+                    The next request was received before this request completed. Retain until the stream is reset.
+                 */
+                httpPutBackPacket(q, packet);
+                break;
+            }
             httpPutPacket(stream->inputq, packet);
         }
     }
@@ -107,28 +284,31 @@ static void logPacket(HttpQueue *q, HttpPacket *packet)
 {
     HttpNet     *net;
     cchar       *type;
-    ssize       len;
+    MprOff      len;
 
     net = q->net;
     type = (packet->type & HTTP_PACKET_HEADER) ? "headers" : "data";
-    len = httpGetPacketLength(packet) + mprGetBufLength(packet->prefix);
+    len = httpGetPacketEntityLength(packet) + mprGetBufLength(packet->prefix);
     if (httpTracing(net) && !net->skipTrace) {
         if (net->bytesWritten >= net->trace->maxContent) {
             httpLog(net->trace, "http1.tx", "packet", "msg: 'Abbreviating packet trace'");
             net->skipTrace = 1;
         } else {
-            httpLogPacket(net->trace, "http1.tx", "packet", HTTP_TRACE_HEX, packet, "type=%s, length=%zd,", type, len);
+            httpLogPacket(net->trace, "http1.tx", "packet", HTTP_TRACE_HEX, packet, "type=%s, length=%lld,", type, len);
         }
     } else {
-        httpLog(net->trace, "http1.tx", "packet", "type=%s, length=%zd,", type, len);
+        httpLog(net->trace, "http1.tx", "packet", "type=%s, length=%lld,", type, len);
     }
 }
 
 
 static HttpPacket *parseHeaders(HttpQueue *q, HttpPacket *packet)
 {
-    HttpStream  *stream;
-    HttpRx      *rx;
+    HttpStream      *stream;
+    HttpRx          *rx;
+    HttpHeaderScan  scan;
+    HttpHeaderField fields[ME_MAX_NUM_HEADERS];
+    int             rc;
 
     stream = q->stream;
     assert(stream->rx);
@@ -138,18 +318,37 @@ static HttpPacket *parseHeaders(HttpQueue *q, HttpPacket *packet)
     if (!monitorActiveRequests(stream)) {
         return 0;
     }
-    if (!gotHeaders(q, packet)) {
-        /* Don't yet have a complete header */
-        return packet;
-    }
-    rx->headerPacket = packet;
+    scan.max = stream->limits->headerMax;
+    scan.fields = (scan.max <= ME_MAX_NUM_HEADERS) ? fields : mprAlloc(scan.max * sizeof(HttpHeaderField));
 
-    if (httpServerStream(stream)) {
-        parseRequestLine(q, packet);
-    } else {
-        parseResponseLine(q, packet);
+    while (1) {
+        if ((rc = gotHeaders(q, packet, &scan)) != 0 && rc != MPR_ERR_BAD_FORMAT) {
+            /* Don't yet have a complete header */
+            return packet;
+        }
+        rx->headerPacket = packet;
+
+        if (rc == MPR_ERR_BAD_FORMAT && !scan.line) {
+            return badHeaders(q, packet);
+        }
+        if (httpServerStream(stream)) {
+            parseRequestLine(q, &scan);
+        } else {
+            parseResponseLine(q, &scan);
+        }
+        if (stream->error) {
+            return 0;
+        }
+        if (rc == MPR_ERR_BAD_FORMAT) {
+            return badHeaders(q, packet);
+        }
+        if (rx->status != HTTP_CODE_CONTINUE || httpServerStream(stream)) {
+            break;
+        }
+        /* Eat the interim response and wait for the real response */
+        mprAdjustBufStart(packet->content, scan.length);
     }
-    return parseFields(q, packet);
+    return parseFields(q, packet, &scan);
 }
 
 
@@ -192,56 +391,91 @@ static cchar *eatBlankLines(HttpPacket *packet)
 }
 
 
-static bool gotHeaders(HttpQueue *q, HttpPacket *packet)
+/*
+    Scan the buffered header block. Return zero if a complete and valid block has been scanned. Return
+    MPR_ERR_BAD_FORMAT if a request header block is malformed so that a 400 response can be sent. Otherwise return
+    a negative MPR error code if the block is incomplete or an error has been raised.
+ */
+static int gotHeaders(HttpQueue *q, HttpPacket *packet, HttpHeaderScan *scan)
 {
     HttpStream  *stream;
     HttpLimits  *limits;
-    cchar       *end, *start;
+    cchar       *start;
     ssize       len;
+    int         rc;
 
     stream = q->stream;
     limits = stream->limits;
     start = eatBlankLines(packet);
     len = httpGetPacketLength(packet);
 
-    if ((end = sncontains(start, "\r\n\r\n", len)) != 0 || (end = sncontains(start, "\n\n", len)) != 0) {
-        len = end - start;
+    if ((rc = httpScanHeaders(scan, start, len)) == 0) {
+        len = scan->blank;
     }
     if (len >= limits->headerSize || len >= q->max) {
         httpLimitError(stream, HTTP_ABORT | HTTP_CODE_REQUEST_TOO_LARGE,
             "Header too big. Length %zd vs limit %d", len, limits->headerSize);
-        return 0;
+        return MPR_ERR_WONT_FIT;
     }
-    if (!end) {
-        return 0;
+    if (rc == MPR_ERR_WONT_FIT) {
+        httpLimitError(stream, HTTP_ABORT | HTTP_CODE_BAD_REQUEST, "Too many headers");
+    } else if (rc == MPR_ERR_BAD_FORMAT && !httpServerStream(stream)) {
+        httpBadRequestError(stream, HTTP_ABORT | HTTP_CODE_BAD_REQUEST, "Bad header format");
+        return MPR_ERR_BAD_STATE;
     }
-    return 1;
+    return rc;
+}
+
+
+/*
+    Respond to a request with a malformed request line or header fields with a 400 status. If the request line
+    cannot be parsed, the error is routed as a request for "/". The header fields and any following input are
+    discarded and the connection is closed.
+ */
+static HttpPacket *badHeaders(HttpQueue *q, HttpPacket *packet)
+{
+    HttpStream  *stream;
+    HttpRx      *rx;
+
+    stream = q->stream;
+    rx = stream->rx;
+    if (!rx->uri) {
+        rx->originalMethod = rx->method = mprArenaClone(stream->arena, "GET", 3);
+        httpParseMethod(stream);
+        rx->originalUri = rx->uri = mprArenaClone(stream->arena, "/", 1);
+    }
+    httpBadRequestError(stream, HTTP_CLOSE | HTTP_CODE_BAD_REQUEST, "Bad header format");
+    rx->remainingContent = 0;
+    mprFlushBuf(packet->content);
+    httpSetState(stream, HTTP_STATE_PARSED);
+    return 0;
 }
 
 
 /*
-    Parse the first line of a http request. Return true if the first line parsed. This is only called once all the headers
-    have been read and buffered. Requests look like: METHOD URL HTTP/1.X.
+    Parse the first line of a http request. This is only called once all the headers have been read and buffered.
+    Requests look like: METHOD URL HTTP/1.X.
  */
-static void parseRequestLine(HttpQueue *q, HttpPacket *packet)
+static void parseRequestLine(HttpQueue *q, HttpHeaderScan *scan)
 {
     HttpStream  *stream;
     HttpRx      *rx;
     HttpLimits  *limits;
-    char        *method, *uri, *protocol;
+    cchar       *cp, *end, *method, *uri, *protocol;
     ssize       len;
 
     stream = q->stream;
     rx = stream->rx;
     limits = stream->limits;
+    cp = scan->line;
+    end = &scan->line[scan->lineLen];
 
-    method = getToken(packet, NULL);
-    rx->originalMethod = rx->method = supper(method);
+    method = getWord(&cp, end, &len);
+    rx->originalMethod = rx->method = upperToken(stream->arena, method, len);
     httpParseMethod(stream);
 
-    uri = getToken(packet, NULL);
-    len = slen(uri);
-    if (*uri == '\0') {
+    uri = getWord(&cp, end, &len);
+    if (len == 0) {
         httpBadRequestError(stream, HTTP_ABORT | HTTP_CODE_BAD_REQUEST, "Bad HTTP request. Empty URI");
         return;
     } else if (len >= limits->uriSize) {
@@ -249,19 +483,18 @@ static void parseRequestLine(HttpQueue *q, HttpPacket *packet)
             "Bad request. URI too long. Length %zd vs limit %d", len, limits->uriSize);
         return;
     }
-    rx->uri = sclone(uri);
+    rx->uri = mprArenaClone(stream->arena, uri, len);
     if (!rx->originalUri) {
         rx->originalUri = rx->uri;
     }
-    protocol = getToken(packet, "\r\n");
-    protocol = supper(protocol);
-    if (smatch(protocol, "HTTP/1.0") || *protocol == 0) {
+    protocol = getWord(&cp, end, &len);
+    if (len == 0 || (len == 8 && sncaselesscmp(protocol, "HTTP/1.0", 8) == 0)) {
         if (rx->flags & (HTTP_POST|HTTP_PUT)) {
             rx->remainingContent = HTTP_UNLIMITED;
             rx->needInputPipeline = 1;
         }
         stream->net->protocol = 0;
-    } else if (strcmp(protocol, "HTTP/1.1") != 0) {
+    } else if (len != 8 || sncaselesscmp(protocol, "HTTP/1.1", 8) != 0 || getWord(&cp, end, &len) != end) {
         httpBadRequestError(stream, HTTP_ABORT | HTTP_CODE_NOT_ACCEPTABLE, "Unsupported HTTP protocol");
         return;
     } else {
@@ -272,107 +505,117 @@ static void parseRequestLine(HttpQueue *q, HttpPacket *packet)
 
 
 /*
-    Parse the first line of a http response. Return true if the first line parsed. This is only called once all the headers
-    have been read and buffered. Response status lines look like: HTTP/1.X CODE Message
+    Parse the first line of a http response. This is only called once all the headers have been read and buffered.
+    Response status lines look like: HTTP/1.X CODE Message
  */
-static void parseResponseLine(HttpQueue *q, HttpPacket *packet)
+static void parseResponseLine(HttpQueue *q, HttpHeaderScan *scan)
 {
     HttpNet     *net;
     HttpStream  *stream;
     HttpRx      *rx;
     HttpTx      *tx;
-    char        *protocol, *status;
+    cchar       *cp, *end, *protocol, *status;
     ssize       len;
 
     net = q->net;
     stream = q->stream;
     rx = stream->rx;
     tx = stream->tx;
+    cp = scan->line;
+    end = &scan->line[scan->lineLen];
 
-    protocol = supper(getToken(packet, NULL));
-    if (strcmp(protocol, "HTTP/1.0") == 0) {
+    protocol = getWord(&cp, end, &len);
+    if (len == 8 && sncaselesscmp(protocol, "HTTP/1.0", 8) == 0) {
         net->protocol = 0;
         if (!scaselessmatch(tx->method, "HEAD")) {
             rx->remainingContent = HTTP_UNLIMITED;
         }
-    } else if (strcmp(protocol, "HTTP/1.1") != 0) {
+    } else if (len != 8 || sncaselesscmp(protocol, "HTTP/1.1", 8) != 0) {
         httpBadRequestError(stream, HTTP_ABORT | HTTP_CODE_NOT_ACCEPTABLE, "Unsupported HTTP protocol");
         return;
     }
-    status = getToken(packet, NULL);
-    if (*status == '\0') {
+    status = getWord(&cp, end, &len);
+    if (len == 0) {
         httpBadRequestError(stream, HTTP_ABORT | HTTP_CODE_NOT_ACCEPTABLE, "Bad response status code");
         return;
     }
+    /* The status is terminated by white space or the line terminator */
     rx->status = atoi(status);
-    rx->statusMessage = sclone(getToken(packet, "\r\n"));
 
-    len = slen(rx->statusMessage);
+    /* The status message is the rest of the line */
+    while (cp < end && (*cp == ' ' || *cp == '\t')) {
+        cp++;
+    }
+    len = end - cp;
     if (len >= stream->limits->uriSize) {
         httpLimitError(stream, HTTP_CLOSE | HTTP_CODE_REQUEST_URL_TOO_LARGE,
             "Bad response. Status message too long. Length %zd vs limit %d", len, stream->limits->uriSize);
         return;
     }
-    if (rx->status == HTTP_CODE_CONTINUE) {
-        /* Eat the blank line and wait for the real response */
-        mprAdjustBufStart(packet->content, 2);
-        return;
-    }
+    rx->statusMessage = snclone(cp, len);
 }
 
 
 /*
-    Parse the header fields and return a following body packet if present.
-    Return zero on errors.
+    Add the scanned header fields to the rx headers and return a following body packet if present.
+    The header fields are copied once into the stream arena and the keys and values are terminated in place, so the
+    headers hash references slices of the copy. Known header keys are shared. Return zero on errors.
  */
-static HttpPacket *parseFields(HttpQueue *q, HttpPacket *packet)
+static HttpPacket *parseFields(HttpQueue *q, HttpPacket *packet, HttpHeaderScan *scan)
 {
-    HttpStream  *stream;
-    HttpRx      *rx;
-    HttpLimits  *limits;
-    char        *key, *value;
-    int         count;
+    HttpStream      *stream;
+    HttpRx          *rx;
+    HttpHeaderField *field;
+    cchar           *start;
+    char            *fields, *key, *value;
+    ssize           len;
+    bool            chunked;
+    int             i;
 
     stream = q->stream;
     rx = stream->rx;
-
-    limits = stream->limits;
-
-    for (count = 0; packet->content->start[0] != '\r' && !stream->error; count++) {
-        if (count >= limits->headerMax) {
-            httpLimitError(stream, HTTP_ABORT | HTTP_CODE_BAD_REQUEST, "Too many headers");
-            return 0;
-        }
-        if ((key = getToken(packet, ":")) == 0 || *key == '\0') {
-            httpBadRequestError(stream, HTTP_ABORT | HTTP_CODE_BAD_REQUEST, "Bad header format");
+    chunked = 0;
+    start = 0;
+    fields = 0;
+
+    if (scan->count > 0) {
+        start = scan->fields[0].key;
+        len = scan->blank - (start - mprGetBufStart(packet->content));
+        if ((fields = mprArenaAllocMem(stream->arena, len, 0)) == 0) {
+            httpMemoryError(stream);
             return 0;
         }
-        value = getToken(packet, "\r\n");
-        while (isspace((uchar) *value)) {
-            value++;
-        }
-        if (strspn(key, "%<>/\\") > 0) {
-            httpBadRequestError(stream, HTTP_ABORT | HTTP_CODE_BAD_REQUEST, "Bad header key value");
-            return 0;
+        memcpy(fields, start, len);
+        rx->headerFields = fields;
+    }
+    for (i = 0; i < scan->count; i++) {
+        field = &scan->fields[i];
+        if (field->id) {
+            key = headerKeys[field->id];
+        } else {
+            key = &fields[field->key - start];
+            key[field->keyLen] = '\0';
         }
-        if (scaselessmatch(key, "set-cookie")) {
-            mprAddDuplicateKey(rx->headers, key, sclone(value));
+        value = &fields[field->value - start];
+        value[field->valueLen] = '\0';
+        if (field->id == HTTP_HEADER_SET_COOKIE) {
+            mprAddDuplicateKey(rx->headers, key, value);
         } else {
-            mprAddKey(rx->headers, key, sclone(value));
+            if (field->id == HTTP_HEADER_TRANSFER_ENCODING) {
+                chunked = smatch(value, "chunked");
+            }
+            mprAddKey(rx->headers, key, value);
         }
     }
     /*
         Split the headers and retain the data for later. Step over "\r\n" after headers except if chunked
         so chunking can parse a single chunk delimiter of "\r\nSIZE ...\r\n"
      */
-    if (smatch(httpGetHeader(stream, "transfer-encoding"), "chunked")) {
+    if (chunked) {
+        mprAdjustBufStart(packet->content, scan->blank);
         httpInitChunking(stream);
     } else {
-        if (mprGetBufLength(packet->content) < 2) {
-            httpBadRequestError(stream, HTTP_ABORT | HTTP_CODE_BAD_REQUEST, "Bad header format");
-            return 0;
-        }
-        mprAdjustBufStart(packet->content, 2);
+        mprAdjustBufStart(packet->content, scan->length);
     }
     httpSetState(stream, HTTP_STATE_PARSED);
     /*
@@ -383,37 +626,200 @@ static HttpPacket *parseFields(HttpQueue *q, HttpPacket *packet)
 
 
 /*
-    Get the next input token. The content buffer is advanced to the next token. This routine always returns a
-    non-null token. The empty string means the delimiter was not found. The delimiter is a string to match and not
-    a set of characters. If null, it means use white space (space or tab) as a delimiter.
+    Get the next white space delimited word of a line. Returns the word and sets *len to its length. The length is
+    zero if there are no more words.
  */
-static char *getToken(HttpPacket *packet, cchar *delim)
+static cchar *getWord(cchar **pos, cchar *end, ssize *len)
 {
-    MprBuf  *buf;
-    char    *token, *endToken, *nextToken;
+    cchar   *cp, *start;
 
-    buf = packet->content;
-    nextToken = mprGetBufEnd(buf);
+    for (cp = *pos; cp < end && (*cp == ' ' || *cp == '\t'); cp++) {}
+    for (start = cp; cp < end && *cp != ' ' && *cp != '\t'; cp++) {}
+    *len = cp - start;
+    *pos = cp;
+    return start;
+}
 
-    for (token = mprGetBufStart(buf); (*token == ' ' || *token == '\t') && token < nextToken; token++) {}
-    if (token >= nextToken) {
-        return "";
+
+static char *upperToken(MprArena *arena, cchar *token, ssize len)
+{
+    char    *result, *cp;
+
+    result = mprArenaClone(arena, token, len);
+    for (cp = result; *cp; cp++) {
+        *cp = (char) toupper((uchar) *cp);
     }
-    if (delim == 0) {
-        delim = " \t";
-        if ((endToken = strpbrk(token, delim)) != 0) {
-            nextToken = endToken + strspn(endToken, delim);
-            *endToken = '\0';
+    return result;
+}
+
+
+/*
+    Scan the request or status line and the header fields in one pass. Each 64 byte block is searched for carriage
+    returns, newlines and colons. The first colon on each header line delimits the key. Lines must be terminated by
+    "\r\n". A bare "\r" or "\n" is rejected so that a header cannot be hidden from an intermediary that splits
+    lines differently.
+ */
+PUBLIC int httpScanHeaders(HttpHeaderScan *scan, cchar *buf, ssize len)
+{
+    cchar   *block, *end, *line, *colon, *cp;
+    uint64  bits;
+    int     rc;
+
+    scan->line = 0;
+    scan->lineLen = scan->blank = scan->length = 0;
+    scan->count = 0;
+    line = buf;
+    colon = 0;
+    end = &buf[len];
+
+    for (block = buf; block < end; block += 64) {
+        for (bits = findDelimiters(block, end); bits; bits &= bits - 1) {
+            cp = &block[getFirstBit(bits)];
+            if (*cp == ':') {
+                if (!colon) {
+                    colon = cp;
+                }
+            } else if (*cp == '\r') {
+                if (&cp[1] >= end) {
+                    return MPR_ERR_NOT_READY;
+                } else if (cp[1] != '\n') {
+                    return MPR_ERR_BAD_FORMAT;
+                }
+            } else {
+                if (cp == buf || cp[-1] != '\r') {
+                    return MPR_ERR_BAD_FORMAT;
+                }
+                if ((rc = scanLine(scan, buf, line, colon, cp)) != 0) {
+                    return rc < 0 ? rc : 0;
+                }
+                line = cp + 1;
+                colon = 0;
+            }
         }
-    } else {
-        if ((endToken = strstr(token, delim)) != 0) {
-            *endToken = '\0';
-            /* Only eat one occurence of the delimiter */
-            nextToken = endToken + strlen(delim);
+    }
+    return MPR_ERR_NOT_READY;
+}
+
+
+/*
+    Return a bit mask of the carriage return, newline and colon characters in a 64 byte block
+ */
+static uint64 findDelimiters(cchar *block, cchar *end)
+{
+    uint64  bits;
+    char    c;
+    int     i, count;
+
+    count = (int) min(end - block, 64);
+    bits = 0;
+    i = 0;
+#if ME_HTTP_SSE2
+    for (; i + 16 <= count; i += 16) {
+        __m128i data = _mm_loadu_si128((const __m128i*) &block[i]);
+        bits |= (uint64) (uint) _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(data, lfVector),
+            _mm_cmpeq_epi8(data, crVector)), _mm_cmpeq_epi8(data, colonVector))) << i;
+    }
+#endif
+    for (; i < count; i++) {
+        c = block[i];
+        if (c == '\n' || c == '\r' || c == ':') {
+            bits |= (uint64) 1 << i;
         }
     }
-    buf->start = nextToken;
-    return token;
+    return bits;
+}
+
+
+/*
+    Process a line terminated by the "\r\n" ending at eol. The key is validated and hashed in a single pass.
+    Return zero to continue, 1 at the end of the headers or a negative MPR error code.
+ */
+static int scanLine(HttpHeaderScan *scan, cchar *buf, cchar *line, cchar *colon, cchar *eol)
+{
+    HttpHeaderField *field;
+    cchar           *cp, *end, *value;
+    uint            hash;
+    uchar           c;
+
+    end = eol - 1;
+    if (scan->line == 0) {
+        scan->line = line;
+        scan->lineLen = end - line;
+        return 0;
+    }
+    if (end == line) {
+        scan->blank = line - buf;
+        scan->length = eol + 1 - buf;
+        return 1;
+    }
+    if (colon == 0 || colon == line) {
+        return MPR_ERR_BAD_FORMAT;
+    }
+    for (hash = HEADER_HASH_SEED, cp = line; cp < colon; cp++) {
+        c = (uchar) *cp;
+        if (!tokenChars[c]) {
+            return MPR_ERR_BAD_FORMAT;
+        }
+        hash = (hash ^ (c | 0x20)) * 0x01000193;
+    }
+    if (scan->count >= scan->max) {
+        return MPR_ERR_WONT_FIT;
+    }
+    for (value = colon + 1; value < end && (*value == ' ' || *value == '\t'); value++) {}
+    while (end > value && (end[-1] == ' ' || end[-1] == '\t')) {
+        end--;
+    }
+    field = &scan->fields[scan->count++];
+    field->key = line;
+    field->keyLen = (int) (colon - line);
+    field->value = value;
+    field->valueLen = (int) (end - value);
+    field->id = findHeaderId(line, colon - line, hash);
+    return 0;
+}
+
+
+/*
+    Find the id of a validated header key given its hash. As key characters are tokens, setting the 0x20 bit is
+    sufficient to compare letters without case.
+ */
+static int findHeaderId(cchar *key, ssize len, uint hash)
+{
+    cchar   *name;
+    ssize   i;
+    int     id;
+
+    if ((id = headerSlots[(hash ^ (hash >> 16)) & (HEADER_HASH_SLOTS - 1)]) == 0 || headerLengths[id] != len) {
+        return HTTP_HEADER_UNKNOWN;
+    }
+    name = headerNames[id];
+    for (i = 0; i < len; i++) {
+        if (((uchar) key[i] | 0x20) != ((uchar) name[i] | 0x20)) {
+            return HTTP_HEADER_UNKNOWN;
+        }
+    }
+    return id;
+}
+
+
+PUBLIC int httpLookupHeaderId(cchar *key, ssize len)
+{
+    uint    hash;
+    ssize   i;
+
+    for (hash = HEADER_HASH_SEED, i = 0; i < len; i++) {
+        if (!tokenChars[(uchar) key[i]]) {
+            return HTTP_HEADER_UNKNOWN;
+        }
+        hash = (hash ^ ((uchar) key[i] | 0x20)) * 0x01000193;
+    }
+    return findHeaderId(key, len, hash);
+}
+
+
+PUBLIC cchar *httpGetHeaderName(int id)
+{
+    return (id > 0 && id < HTTP_HEADER_MAX) ? headerNames[id] : 0;
 }
 
 
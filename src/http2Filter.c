@@ -33,7 +33,9 @@ static void encodeHeader(HttpStream *stream, HttpPacket *packet, cchar *key, cch
 static void encodeInt(HttpPacket *packet, uint prefix, uint bits, uint value);
 static void encodeString(HttpPacket *packet, cchar *src, uint lower);
 static HttpStream *findStreamObj(HttpNet *net, int stream);
+static bool dependsOn(HttpNet *net, HttpStream *stream, int streamID, int mark);
 static int getFrameFlags(HttpQueue *q, HttpPacket *packet);
+static HttpPacket *getNextStreamPacket(HttpQueue *q, HttpStream *stream);
 static HttpStream *getStream(HttpQueue *q, HttpPacket *packet);
 static void incomingHttp2(HttpQueue *q, HttpPacket *packet);
 static void outgoingHttp2(HttpQueue *q, HttpPacket *packet);
@@ -47,6 +49,7 @@ static cchar *parseHeaderField(HttpQueue *q, HttpStream *stream, HttpPacket *pac
 static bool parseHeader(HttpQueue *q, HttpStream *stream, HttpPacket *packet);
 static void parseHeaderFrames(HttpQueue *q, HttpStream *stream);
 static void parsePriorityFrame(HttpQueue *q, HttpPacket *packet);
+static bool preferStream(HttpStream *s1, HttpStream *s2);
 static void parsePushFrame(HttpQueue *q, HttpPacket *packet);
 static void parsePingFrame(HttpQueue *q, HttpPacket *packet);
 static void parseResetFrame(HttpQueue *q, HttpPacket *packet);
@@ -54,6 +57,7 @@ static void parseSettingsFrame(HttpQueue *q, HttpPacket *packet);
 static void parseWindowFrame(HttpQueue *q, HttpPacket *packet);
 static void processDataFrame(HttpQueue *q, HttpPacket *packet);
 static void resetStream(HttpStream *stream, cchar *msg, int error);
+static void resumeStreams(HttpNet *net);
 static ssize resizePacket(HttpQueue *q, ssize max, HttpPacket *packet);
 static void sendFrame(HttpQueue *q, HttpPacket *packet);
 static void sendGoAway(HttpQueue *q, int status, cchar *fmt, ...);
@@ -61,6 +65,7 @@ static void sendPreface(HttpQueue *q);
 static void sendReset(HttpQueue *q, HttpStream *stream, int status, cchar *fmt, ...);
 static void sendSettings(HttpQueue *q);
 static void sendWindowFrame(HttpQueue *q, int stream, ssize size);
+static void setPriority(HttpQueue *q, HttpStream *stream, int dependency, bool exclusive, int weight);
 static bool validateHeader(cchar *key, cchar *value);
 
 /*
@@ -111,6 +116,7 @@ PUBLIC int httpOpenHttp2Filter()
     filter->outgoing = outgoingHttp2;
     filter->outgoingService = outgoingHttp2Service;
     httpCreatePackedHeaders();
+    httpCreateHuffTables();
     return 0;
 }
 
@@ -189,7 +195,7 @@ static void outgoingHttp2(HttpQueue *q, HttpPacket *packet)
 
 
 /*
-    Service the outgoing queue of packets
+    Service the outgoing queue of packets. Packets from different streams are interleaved by the stream scheduler.
  */
 static void outgoingHttp2Service(HttpQueue *q)
 {
@@ -201,7 +207,7 @@ static void outgoingHttp2Service(HttpQueue *q)
 
     net = q->net;
 
-    for (packet = httpGetPacket(q); packet && !net->error; packet = httpGetPacket(q)) {
+    for (packet = httpSelectHttp2Packet(q); packet && !net->error; packet = httpSelectHttp2Packet(q)) {
         net->lastActivity = net->http->now;
         if (net->outputq->window <= 0) {
             /*
@@ -212,6 +218,15 @@ static void outgoingHttp2Service(HttpQueue *q)
             httpPutBackPacket(q, packet);
             break;
         }
+        if (net->socketq->count >= net->socketq->max) {
+            /*
+                Wait for the socket queue to drain so that the scheduler can order the data yet to be sent.
+                The socketq resumes this queue when it falls below its low water mark.
+             */
+            httpSuspendQueue(q);
+            httpPutBackPacket(q, packet);
+            break;
+        }
         stream = packet->stream;
 
         /*
@@ -245,9 +260,10 @@ static void outgoingHttp2Service(HttpQueue *q)
                     sendReset(q, stream, HTTP2_FLOW_CONTROL_ERROR, "Internal flow control error");
                     return;
                 }
+                httpUpdatePriorityTime(net, stream, len);
             } else if (packet->flags & HTTP_PACKET_END && tx->endData) {
                 httpPutPacket(q->net->socketq, packet);
-                break;
+                continue;
             }
             /*
                 Create and send a HTTP/2 frame
@@ -255,9 +271,11 @@ static void outgoingHttp2Service(HttpQueue *q)
             sendFrame(q, defineFrame(q, packet, packet->type, getFrameFlags(q, packet), stream->streamID));
 
             /*
-                Resume upstream if there is now room
+                Resume upstream if there is now room. All streams are resumed so the scheduler can choose amongst them.
              */
-            if (q->count <= q->low && (stream->outputq->flags & HTTP_QUEUE_SUSPENDED)) {
+            if (q->count <= q->low) {
+                resumeStreams(net);
+            } else if ((stream->outputq->flags & HTTP_QUEUE_SUSPENDED) && !getNextStreamPacket(q, stream)) {
                 httpResumeQueue(stream->outputq);
             }
         }
@@ -270,6 +288,163 @@ static void outgoingHttp2Service(HttpQueue *q)
 }
 
 
+/*
+    Select the next packet to send. Packets for a stream are always sent in order, so only the first queued packet
+    of each stream is a candidate. Header packets go first to minimize the time to first byte. Thereafter, data is
+    scheduled by urgency (RFC 9218) and then by weighted fair share (RFC 7540) amongst streams that are not
+    waiting on a parent stream with queued data.
+ */
+PUBLIC HttpPacket *httpSelectHttp2Packet(HttpQueue *q)
+{
+    HttpNet     *net;
+    HttpStream  *stream;
+    HttpPacket  *packet, *prev, *best, *bestPrev, *first, *firstPrev;
+    int         mark;
+
+    net = q->net;
+    if (!q->first || !q->first->next) {
+        return httpGetPacket(q);
+    }
+    /*
+        Mark streams with queued packets. Send header and non-stream packets immediately.
+     */
+    mark = net->scheduleMark + 1;
+    net->scheduleMark += 2;
+    for (prev = 0, packet = q->first; packet; prev = packet, packet = packet->next) {
+        stream = packet->stream;
+        if (!stream || ((packet->flags & HTTP_PACKET_HEADER) && stream->scheduleMark != mark)) {
+            if (!prev) {
+                return httpGetPacket(q);
+            }
+            httpRemovePacket(q, prev, packet);
+            return packet;
+        }
+        stream->scheduleMark = mark;
+    }
+    best = bestPrev = first = firstPrev = 0;
+    for (prev = 0, packet = q->first; packet; prev = packet, packet = packet->next) {
+        stream = packet->stream;
+        if (stream->scheduleMark != mark) {
+            /* Not the first packet for this stream */
+            continue;
+        }
+        stream->scheduleMark = mark + 1;
+        if (!first) {
+            first = packet;
+            firstPrev = prev;
+        }
+        if (stream->dependency && dependsOn(net, stream, 0, mark)) {
+            /* A parent stream has data to send */
+            continue;
+        }
+        if (!best || preferStream(stream, best->stream)) {
+            best = packet;
+            bestPrev = prev;
+        }
+    }
+    if (!best) {
+        /* Cyclic dependencies, so ignore them */
+        best = first;
+        bestPrev = firstPrev;
+    }
+    if (!bestPrev) {
+        return httpGetPacket(q);
+    }
+    httpRemovePacket(q, bestPrev, best);
+    return best;
+}
+
+
+/*
+    Resume all suspended stream output queues
+ */
+static void resumeStreams(HttpNet *net)
+{
+    HttpStream  *stream;
+    int         next;
+
+    for (ITERATE_ITEMS(net->streams, stream, next)) {
+        if (!stream->destroyed && stream->outputq && (stream->outputq->flags & HTTP_QUEUE_SUSPENDED)) {
+            httpResumeQueue(stream->outputq);
+        }
+    }
+}
+
+
+/*
+    Return true if s1 should be scheduled before s2
+ */
+static bool preferStream(HttpStream *s1, HttpStream *s2)
+{
+    if (s1->urgency != s2->urgency) {
+        return s1->urgency < s2->urgency;
+    }
+    if (s1->incremental != s2->incremental) {
+        /* Non-incremental responses of equal urgency are sent first, one at a time */
+        return !s1->incremental;
+    }
+    if (!s1->incremental) {
+        return s1->streamID < s2->streamID;
+    }
+    return s1->priorityTime < s2->priorityTime;
+}
+
+
+/*
+    Advance the stream's virtual time by the data sent scaled by the inverse of its weight. A stream that has been
+    idle starts from the current scheduler time so it cannot claim credit for the time it had nothing to send.
+ */
+PUBLIC void httpUpdatePriorityTime(HttpNet *net, HttpStream *stream, ssize len)
+{
+    if (stream->priorityTime < net->priorityTime) {
+        stream->priorityTime = net->priorityTime;
+    }
+    net->priorityTime = stream->priorityTime;
+    stream->priorityTime += (uint64) len * HTTP2_MAX_WEIGHT / stream->weight;
+}
+
+
+/*
+    Test if a stream depends directly or indirectly on the given stream ID. If mark is set, test instead if any
+    ancestor has queued packets (scheduleMark of mark or mark + 1).
+ */
+static bool dependsOn(HttpNet *net, HttpStream *stream, int streamID, int mark)
+{
+    HttpStream  *parent;
+    int         depth, id;
+
+    depth = mprGetListLength(net->streams);
+    for (id = stream->dependency; id && depth-- > 0; id = parent->dependency) {
+        if (id == streamID) {
+            return 1;
+        }
+        if ((parent = findStreamObj(net, id)) == 0) {
+            break;
+        }
+        if (mark && (parent->scheduleMark == mark || parent->scheduleMark == mark + 1)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/*
+    Get the next queued packet for a stream
+ */
+static HttpPacket *getNextStreamPacket(HttpQueue *q, HttpStream *stream)
+{
+    HttpPacket  *packet;
+
+    for (packet = q->first; packet; packet = packet->next) {
+        if (packet->stream == stream) {
+            return packet;
+        }
+    }
+    return 0;
+}
+
+
 /*
     Get the HTTP/2 frame flags for this packet
  */
@@ -283,7 +458,7 @@ static int getFrameFlags(HttpQueue *q, HttpPacket *packet)
     stream = packet->stream;
     tx = stream->tx;
     flags = 0;
-    first = q->first;
+    first = getNextStreamPacket(q, stream);
 
     if (packet->flags & HTTP_PACKET_HEADER && !tx->endHeaders) {
         if (!(first && first->flags & HTTP_PACKET_HEADER)) {
@@ -557,7 +732,8 @@ static void parseHeaderFrame(HttpQueue *q, HttpPacket *packet)
     MprBuf      *buf;
     bool        padded, priority;
     ssize       size, frameLen;
-    int         padLen;
+    uint32      dword;
+    int         padLen, weight;
 
     net = q->net;
     buf = packet->content;
@@ -570,7 +746,6 @@ static void parseHeaderFrame(HttpQueue *q, HttpPacket *packet)
         size++;
     }
     if (priority) {
-        /* dependency + weight are ignored */
         size += sizeof(uint32) + 1;
     }
     frameLen = mprGetBufLength(buf);
@@ -586,24 +761,24 @@ static void parseHeaderFrame(HttpQueue *q, HttpPacket *packet)
         }
         mprAdjustBufEnd(buf, -padLen);
     }
-#if FUTURE
-    int weight = HTTP2_DEFAULT_WEIGHT;
-#endif
+    dword = 0;
+    weight = HTTP2_DEFAULT_WEIGHT;
     if (priority) {
-        /* Priorities and weights are not yet implemented */
-        // dword = mprGetUint32FromBuf(buf);
-        // depend = dword & 0x7fffffff;
-        // excl = dword >> 31;
-        // weight = mprGetCharFromBuf(buf) + 1;
-        mprGetUint32FromBuf(buf);
-        mprGetCharFromBuf(buf);
+        dword = mprGetUint32FromBuf(buf);
+        weight = mprGetCharFromBuf(buf) + 1;
     }
     if ((frame->streamID % 2) != 1 || (net->lastStreamID && frame->streamID <= net->lastStreamID)) {
         sendGoAway(q, HTTP2_PROTOCOL_ERROR, "Bad sesssion");
         return;
     }
     if ((stream = getStream(q, packet)) != 0) {
-         if (frame->flags & HTTP2_END_HEADERS_FLAG) {
+        if (priority) {
+            setPriority(q, stream, dword & HTTP_STREAM_MASK, dword >> 31, weight);
+            if (stream->streamReset) {
+                return;
+            }
+        }
+        if (frame->flags & HTTP2_END_HEADERS_FLAG) {
             parseHeaderFrames(q, stream);
         }
         /*
@@ -662,12 +837,6 @@ static HttpStream *getStream(HttpQueue *q, HttpPacket *packet)
             return 0;
         }
     }
-#if FUTURE
-    if (depend == frame->streamID) {
-        sendReset(q, stream, HTTP2_PROTOCOL_ERROR, "Bad stream dependency");
-        return 0;
-    }
-#endif
     if (frame->type == HTTP2_CONT_FRAME && (!stream->rx || !stream->rx->headerPacket)) {
         if (!frame->stream) {
             sendReset(q, stream, HTTP2_REFUSED_STREAM, "Invalid continuation frame");
@@ -695,20 +864,94 @@ static HttpStream *getStream(HttpQueue *q, HttpPacket *packet)
 
 
 /*
-    Priority frames are not yet implemented. They are parsed but not validated or implemented.
+    Parse a priority frame to revise the dependency and weight of a stream.
+    Priorities for idle and closed streams are ignored.
  */
 static void parsePriorityFrame(HttpQueue *q, HttpPacket *packet)
 {
-#if FUTURE
-    MprBuf  *buf;
-    int     dep, exclusive, weight;
+    HttpFrame   *frame;
+    MprBuf      *buf;
+    uint32      dword;
+    int         weight;
 
+    frame = packet->data;
     buf = packet->content;
-    dep = mprGetUint32FromBuf(buf);
-    exclusive = dep & (1 << 31);
-    dep &= (1U << 31) - 1;
-    weight = mprGetCharFromBuf(buf);
-#endif
+
+    if (frame->streamID == 0) {
+        sendGoAway(q, HTTP2_PROTOCOL_ERROR, "Bad priority frame stream");
+        return;
+    }
+    if (mprGetBufLength(buf) != HTTP2_PRIORITY_SIZE) {
+        if (frame->stream) {
+            sendReset(q, frame->stream, HTTP2_FRAME_SIZE_ERROR, "Bad priority frame size");
+        }
+        return;
+    }
+    dword = mprGetUint32FromBuf(buf);
+    weight = mprGetCharFromBuf(buf) + 1;
+    if (frame->stream) {
+        setPriority(q, frame->stream, dword & HTTP_STREAM_MASK, dword >> 31, weight);
+    }
+}
+
+
+/*
+    Set the stream dependency and weight (RFC 7540 5.3). An exclusive dependency makes the stream the sole child
+    of its parent. If the new parent depends on this stream, the parent is first moved to the stream's former place.
+ */
+static void setPriority(HttpQueue *q, HttpStream *stream, int dependency, bool exclusive, int weight)
+{
+    HttpNet     *net;
+    HttpStream  *sp;
+    int         next;
+
+    net = q->net;
+    if (dependency == stream->streamID) {
+        sendReset(q, stream, HTTP2_PROTOCOL_ERROR, "Bad stream dependency");
+        return;
+    }
+    for (ITERATE_ITEMS(net->streams, sp, next)) {
+        if (sp == stream) {
+            continue;
+        }
+        if (sp->streamID == dependency && dependsOn(net, sp, stream->streamID, 0)) {
+            sp->dependency = stream->dependency;
+        } else if (exclusive && sp->dependency == dependency) {
+            sp->dependency = stream->streamID;
+        }
+    }
+    stream->dependency = dependency;
+    stream->weight = weight;
+}
+
+
+/*
+    Parse the RFC 9218 priority header. This is a dictionary of "u=N" urgency and "i" incremental members.
+    Member parameters, unknown members and out of range or malformed values are ignored.
+ */
+PUBLIC void httpParsePriorityHeader(HttpStream *stream, cchar *value)
+{
+    char    *item, *params, *tok;
+    int64   urgency;
+
+    stream->incremental = 0;
+    for (item = stok(sclone(value), ",", &tok); item; item = stok(NULL, ",", &tok)) {
+        if ((params = schr(item, ';')) != 0) {
+            *params = '\0';
+        }
+        item = strim(item, " \t", MPR_TRIM_BOTH);
+        if (item[0] == 'u' && item[1] == '=' && isdigit((uchar) item[2]) && snumber(&item[2]) && slen(item) <= 17) {
+            /* Structured field integers are decimal with at most 15 digits */
+            urgency = stoiradix(&item[2], 10, NULL);
+            if (urgency <= HTTP2_MAX_URGENCY) {
+                stream->urgency = (int) urgency;
+            }
+        } else if (smatch(item, "i") || smatch(item, "i=?1")) {
+            stream->incremental = 1;
+        } else if (smatch(item, "i=?0")) {
+            stream->incremental = 0;
+        }
+    }
 }
 
 
@@ -957,6 +1200,8 @@ static cchar *parseHeaderField(HttpQueue *q, HttpStream *stream, HttpPacket *pac
 {
     MprBuf      *buf;
     cchar       *value;
+    char        scratch[HTTP2_HUFF_SCRATCH];
+    ssize       size;
     int         huff, len;
 
     buf = packet->content;
@@ -969,9 +1214,15 @@ static cchar *parseHeaderField(HttpQueue *q, HttpStream *stream, HttpPacket *pac
     }
     if (huff) {
         /*
-            Huffman encoded
+            Huffman encoded. Decode typical fields on the stack and clone only the decoded length.
          */
-        if ((value = httpHuffDecode((uchar*) mprGetBufStart(buf), len)) == 0) {
+        if (HTTP2_HUFF_DECODED_MAX(len) <= sizeof(scratch)) {
+            size = httpHuffDecodeBuf((cuchar*) mprGetBufStart(buf), len, scratch, sizeof(scratch));
+            value = (size >= 0) ? snclone(scratch, size) : 0;
+        } else {
+            value = httpHuffDecode((cuchar*) mprGetBufStart(buf), len);
+        }
+        if (value == 0) {
             sendGoAway(q, HTTP2_PROTOCOL_ERROR, "Invalid encoded header field");
             return 0;
         }
@@ -1017,7 +1268,7 @@ static void addHeader(HttpStream *stream, cchar *key, cchar *value)
                     "Bad request. URI too long. Length %zd vs limit %d", len, limits->uriSize);
                 return;
             }
-            rx->uri = sclone(value);
+            rx->uri = mprArenaClone(stream->arena, value, -1);
             if (!rx->originalUri) {
                 rx->originalUri = rx->uri;
             }
@@ -1030,6 +1281,9 @@ static void addHeader(HttpStream *stream, cchar *key, cchar *value)
             }
         }
     } else {
+        if (key[0] == 'p' && smatch(key, "priority")) {
+            httpParsePriorityHeader(stream, value);
+        }
         if (scaselessmatch(key, "set-cookie")) {
             mprAddDuplicateKey(rx->headers, key, value);
         } else {
@@ -1592,31 +1846,24 @@ static void encodeString(HttpPacket *packet, cchar *src, uint lower)
 {
     MprBuf      *buf;
     cchar       *cp;
-    char        *dp, *encoded;
+    char        *dp;
     ssize       len, hlen, extra;
 
     buf = packet->content;
     len = slen(src);
 
     /*
-        Encode the string in the buffer. Allow some extra space incase the huff encoding is bigger then src and
-        some room after the end of the buffer for an encoded integer length.
+        Allow room for the string and its encoded integer length. Huffman output is only used if shorter.
      */
     extra = 16;
     if (mprGetBufSpace(buf) < (len + extra)) {
         mprGrowBuf(buf, (len + extra) - mprGetBufSpace(buf));
     }
-    /*
-        Leave room at the end of the buffer for an encoded integer.
-     */
-    encoded = mprGetBufEnd(buf) + (extra / 2);
-    hlen = httpHuffEncode(src, slen(src), encoded, lower);
-    assert((encoded + hlen) < buf->endbuf);
-    assert(hlen < len);
+    hlen = httpHuffEncodedLength(src, len, lower);
 
-    if (hlen > 0) {
+    if (hlen < len) {
         encodeInt(packet, HTTP2_ENCODE_HUFF, 7, (uint) hlen);
-        memmove(mprGetBufEnd(buf), encoded, hlen);
+        httpHuffEncode(src, len, mprGetBufEnd(buf), lower);
         mprAdjustBufEnd(buf, hlen);
     } else {
         encodeInt(packet, 0, 7, (uint) len);
@@ -1654,9 +1901,6 @@ static HttpPacket *defineFrame(HttpQueue *q, HttpPacket *packet, int type, uchar
     }
     length = httpGetPacketLength(packet);
 
-    /*
-        Not yet supporting priority or weight
-     */
     mprPutUint32ToBuf(buf, (((uint32) length) << 8 | type));
     mprPutCharToBuf(buf, flags);
     mprPutUint32ToBuf(buf, stream);
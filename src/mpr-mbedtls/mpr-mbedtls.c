@@ -51,6 +51,8 @@ static int                      mbedLogLevel;   /* MPR log level to start SSL tr
 /***************************** Forward Declarations ***************************/
 
 static void     closeMbed(MprSocket *sp, bool gracefully);
+static int      cryptMbed(bool encrypt, cuchar *key, cuchar *nonce, cuchar *aad, ssize aadLen, cuchar *input, ssize len,
+                    uchar *output, uchar *tag);
 static void     disconnectMbed(MprSocket *sp);
 static void     freeMbedLock(mbedtls_threading_mutex_t *tm);
 static int      *getCipherSuite(MprSsl *ssl);
@@ -95,6 +97,7 @@ PUBLIC int mprSslInit(void *unused, MprModule *module)
     mbedProvider->readSocket = readMbed;
     mbedProvider->writeSocket = writeMbed;
     mbedProvider->socketState = getMbedState;
+    mbedProvider->cryptData = cryptMbed;
     mprSetSslProvider(mbedProvider);
 
     if ((global = mprAllocObj(MbedGlobal, manageMbedGlobal)) == 0) {
@@ -633,6 +636,33 @@ static ssize writeMbed(MprSocket *sp, cvoid *buf, ssize len)
 }
 
 
+/*
+    Authenticated encryption with AES-256-GCM. The GCM context is per-call so this is thread-safe.
+ */
+static int cryptMbed(bool encrypt, cuchar *key, cuchar *nonce, cuchar *aad, ssize aadLen, cuchar *input, ssize len,
+    uchar *output, uchar *tag)
+{
+    mbedtls_gcm_context     gcm;
+    int                     rc;
+
+    mbedtls_gcm_init(&gcm);
+    if ((rc = mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, key, MPR_AEAD_KEY * 8)) == 0) {
+        if (encrypt) {
+            rc = mbedtls_gcm_crypt_and_tag(&gcm, MBEDTLS_GCM_ENCRYPT, (size_t) len, nonce, MPR_AEAD_NONCE,
+                aad, (size_t) aadLen, input, output, MPR_AEAD_TAG, tag);
+        } else {
+            rc = mbedtls_gcm_auth_decrypt(&gcm, (size_t) len, nonce, MPR_AEAD_NONCE, aad, (size_t) aadLen,
+                tag, MPR_AEAD_TAG, input, output);
+        }
+    }
+    mbedtls_gcm_free(&gcm);
+    if (rc == MBEDTLS_ERR_GCM_AUTH_FAILED) {
+        return MPR_ERR_BAD_STATE;
+    }
+    return rc < 0 ? MPR_ERR_CANT_COMPLETE : 0;
+}
+
+
 /*
     Invoked by mbedtls in response to SNI extensions in the client hello
  */
@@ -236,6 +236,8 @@ typedef struct CRYPTO_dynlock_value DynLock;
 static void     closeOss(MprSocket *sp, bool gracefully);
 static int      checkPeerCertName(MprSocket *sp);
 static int      configOss(MprSsl *ssl, int flags, char **errorMsg);
+static int      cryptOss(bool encrypt, cuchar *key, cuchar *nonce, cuchar *aad, ssize aadLen, cuchar *input, ssize len,
+                    uchar *output, uchar *tag);
 static DH       *dhcallback(SSL *ssl, int isExport, int keyLength);
 static void     disconnectOss(MprSocket *sp);
 static ssize    flushOss(MprSocket *sp);
@@ -294,6 +296,7 @@ PUBLIC int mprSslInit(void *unused, MprModule *module)
     openProvider->disconnectSocket = disconnectOss;
     openProvider->flushSocket = flushOss;
     openProvider->socketState = getOssState;
+    openProvider->cryptData = cryptOss;
     openProvider->readSocket = readOss;
     openProvider->writeSocket = writeOss;
     mprSetSslProvider(openProvider);
@@ -1027,6 +1030,45 @@ static ssize writeOss(MprSocket *sp, cvoid *buf, ssize len)
 }
 
 
+/*
+    Authenticated encryption with AES-256-GCM. The cipher context is per-call so this is thread-safe.
+ */
+static int cryptOss(bool encrypt, cuchar *key, cuchar *nonce, cuchar *aad, ssize aadLen, cuchar *input, ssize len,
+    uchar *output, uchar *tag)
+{
+    EVP_CIPHER_CTX  *ctx;
+    int             count, ok;
+
+    if ((ctx = EVP_CIPHER_CTX_new()) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    ok = EVP_CipherInit_ex(ctx, EVP_aes_256_gcm(), NULL, NULL, NULL, encrypt) &&
+        EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_IVLEN, MPR_AEAD_NONCE, NULL) &&
+        EVP_CipherInit_ex(ctx, NULL, NULL, key, nonce, encrypt);
+    if (ok && aad && aadLen > 0) {
+        ok = EVP_CipherUpdate(ctx, NULL, &count, aad, (int) aadLen);
+    }
+    if (ok && len > 0) {
+        ok = EVP_CipherUpdate(ctx, output, &count, input, (int) len);
+    }
+    if (ok && !encrypt) {
+        ok = EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, MPR_AEAD_TAG, tag);
+    }
+    if (ok) {
+        /* Verifies the tag when decrypting */
+        if (!EVP_CipherFinal_ex(ctx, &output[len], &count)) {
+            EVP_CIPHER_CTX_free(ctx);
+            return encrypt ? MPR_ERR_CANT_COMPLETE : MPR_ERR_BAD_STATE;
+        }
+        if (encrypt) {
+            ok = EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, MPR_AEAD_TAG, tag);
+        }
+    }
+    EVP_CIPHER_CTX_free(ctx);
+    return ok ? 0 : MPR_ERR_CANT_COMPLETE;
+}
+
+
 static ssize flushOss(MprSocket *sp)
 {
     return 0;
@@ -208,6 +208,9 @@ struct  MprXml;
 #ifndef ME_MAX_EVENTS
     #define ME_MAX_EVENTS      32
 #endif
+#ifndef ME_MPR_CACHE_SHARDS
+    #define ME_MPR_CACHE_SHARDS 16      /**< Lock stripes per cache. Must be a power of 2 */
+#endif
 
 /*
     Garbage collector tuning
@@ -791,6 +794,27 @@ PUBLIC void mprAtomicAdd64(volatile int64 *target, int64 value);
     #define ME_MPR_ALLOC_REGION_SIZE (256 * 1024)       /* Memory region allocation chunk size */
 #endif
 
+#ifndef ME_MPR_GC_SYNC_TIMEOUT
+    #define ME_MPR_GC_SYNC_TIMEOUT 10                  /* Time (msec) to wait for threads to yield before abandoning GC */
+#endif
+#ifndef ME_MPR_ALLOC_THREAD_CACHE
+    #if VXWORKS
+        #define ME_MPR_ALLOC_THREAD_CACHE 0
+    #else
+        #define ME_MPR_ALLOC_THREAD_CACHE 1            /* Per-thread caches of small blocks */
+    #endif
+#endif
+#ifndef ME_MPR_ALLOC_THREAD_BATCH
+    #define ME_MPR_ALLOC_THREAD_BATCH 16               /* Blocks moved per thread cache refill */
+#endif
+
+#ifndef ME_MPR_ARENA_SIZE
+    #define ME_MPR_ARENA_SIZE (8 * 1024)               /* Default arena chunk size */
+#endif
+#ifndef ME_MPR_ARENA_SPARES
+    #define ME_MPR_ARENA_SPARES 8                      /* Released chunks retained per arena for reuse */
+#endif
+
 #ifndef ME_MPR_ALLOC_ALIGN_SHIFT
     /*
         Allocated block alignment expressed as a bit shift. The default alignment is set so that allocated memory can be used
@@ -866,6 +890,7 @@ typedef struct MprMem {
     uchar       hasManager: 1;          /**< Has manager function. Set at block init. */
     uchar       mark: 1;                /**< GC mark indicator. Toggled for each GC pass by mark() when thread yielded. */
     uchar       fullRegion: 1;          /**< Block is an entire region - never on free queues . */
+    uchar       arena: 1;               /**< Block is bump allocated inside an arena chunk. See MprArena */
 
 #if ME_MPR_ALLOC_DEBUG
     /* This increases the size of MprMem from 8 bytes to 16 bytes on 32-bit systems and 24 bytes on 64 bit systems */
@@ -1039,6 +1064,13 @@ typedef void (*MprMemNotifier)(int cause, int policy, size_t size, size_t total)
  */
 typedef void (*MprManager)(void *ptr, int flags);
 
+/*
+    GC pause histogram. Bucket N counts pauses under MPR_GC_PAUSE_LIMIT(N) usec. The last bucket counts longer pauses.
+ */
+#define MPR_GC_PAUSE_BUCKETS        10
+#define MPR_GC_PAUSE_LIMIT(n)       (100 << (n))
+#define MPR_GC_MAX_ABANDON          4       /**< Collections abandoned before waiting the full sync period */
+
 #if ME_MPR_ALLOC_DEBUG
 /*
     The location stats table tracks the source code location responsible for each allocation
@@ -1080,6 +1112,14 @@ typedef struct MprMemStats {
     uint64          warnHeap;               /**< Warn if heap size exceeds this level */
     uint64          swept;                  /**< Number of blocks swept */
     uint64          sweptBytes;             /**< Number of bytes swept */
+    uint64          cacheHits;              /**< Allocations served from per-thread caches */
+    uint64          cacheMisses;            /**< Per-thread cache refills */
+    uint64          gcPauses[MPR_GC_PAUSE_BUCKETS]; /**< Histogram of completed GC pauses */
+    uint64          gcPauseMax;             /**< Longest completed GC pause in usec */
+    uint64          gcPauseTotal;           /**< Total completed GC pause time in usec */
+    uint64          gcAbandoned;            /**< Collections abandoned because threads did not yield in time */
+    uint64          gcAbandonedMax;         /**< Longest wait in usec by an abandoned collection */
+    uint64          gcAbandonedTotal;       /**< Total wait in usec by abandoned collections */
 #if ME_MPR_ALLOC_STATS
     /*
         Extended memory stats
@@ -1109,6 +1149,29 @@ typedef struct MprMemStats {
 } MprMemStats;
 
 
+#if ME_MPR_ALLOC_THREAD_CACHE
+/*
+    Size class queues served by the per-thread caches. Covers blocks under 512 bytes with 8 byte alignment.
+ */
+#define MPR_ALLOC_CACHE_QUEUES      20
+
+/**
+    Per-thread cache of small free blocks
+    @description Each thread allocates small blocks from its own cache without locking. The cache is refilled
+        in batches from the heap free queues and idle caches are returned to the heap by the garbage collector.
+    @ingroup MprMem
+    @stability Internal.
+ */
+typedef struct MprAllocCache {
+    MprFreeMem      *blocks[MPR_ALLOC_CACHE_QUEUES];    /**< Cached blocks per size class linked via next */
+    int             count[MPR_ALLOC_CACHE_QUEUES];      /**< Number of cached blocks per size class */
+    uint64          hits;                   /**< Allocations served from the cache */
+    uint64          misses;                 /**< Allocations that required a refill */
+    uint64          flushes;                /**< Times the cache was returned to the heap */
+    int             active;                 /**< Allocated since the last collection */
+} MprAllocCache;
+#endif
+
 /**
     Memmory regions allocated from the O/S
     @ingroup MprMem
@@ -1145,6 +1208,9 @@ typedef struct MprHeap {
     int              flags;                 /**< GC operational control flags */
     int              from;                  /**< Eligible mprCollectGarbage flags */
     int              gcEnabled;             /**< GC is enabled */
+    int              gcForced;              /**< Collection was forced and must not be abandoned */
+    int              gcAbandoned;           /**< Consecutive collections abandoned over the sync timeout */
+    MprTicks         syncTimeout;           /**< Time to wait for threads to yield before abandoning a collection */
     int              gcRequested;           /**< GC has been requested */
     int              hasError;              /**< Memory allocation error */
     int              mark;                  /**< Mark version */
@@ -1154,6 +1220,8 @@ typedef struct MprHeap {
     int              pageSize;              /**< System page size */
     int              printStats;            /**< Print diagnostic heap statistics */
     uint64           priorFree;             /**< Last sweep free memory */
+    uint64           retiredHits;           /**< Cache hits of exited threads */
+    uint64           retiredMisses;         /**< Cache misses of exited threads */
     uint64           priorWorkDone;         /**< Prior workDone before last sweep */
     int              scribble;              /**< Scribble over freed memory (slow) */
     int              sweeping;              /**< Actually sweeping objects now */
@@ -1583,6 +1651,8 @@ PUBLIC void mprDestroyMemService(void);
 PUBLIC void mprStartGCService(void);
 PUBLIC void mprStopGCService(void);
 PUBLIC void *mprAllocFast(size_t usize);
+PUBLIC void mprBindAllocCache(struct MprThread *tp);
+PUBLIC void mprReleaseAllocCache(struct MprThread *tp);
 
 /******************************** Garbage Coolector ***************************/
 /**
@@ -1630,6 +1700,24 @@ PUBLIC int mprGC(int flags);
  */
 PUBLIC bool mprEnableGC(bool on);
 
+/**
+    Set the garbage collector synchronization timeout
+    @description The collector marks memory while all threads are paused. Threads that yield early wait for
+        the remaining threads. If all threads do not yield within the timeout, the collection is abandoned and the
+        yielded threads resume. The collection is retried later. After #MPR_GC_MAX_ABANDON consecutive
+        abandoned attempts, or for forced collections, the collector waits the full synchronization period.
+        This limits how long yielded threads wait for a slow thread. It does not bound the pause once all threads
+        have yielded, as the mark phase is not incremental and its duration grows with the heap.
+        Completed pauses are recorded in the MprMemStats.gcPauses histogram. Abandoned attempts are counted
+        separately in MprMemStats.gcAbandoned.
+    @param timeout Maximum time in milliseconds to wait for threads to yield. Set to zero to always wait
+        the full synchronization period.
+    @return The prior timeout.
+    @ingroup MprMem
+    @stability Evolving.
+ */
+PUBLIC MprTicks mprSetGCSyncTimeout(MprTicks timeout);
+
 
 /**
     Hold a memory block
@@ -1706,6 +1794,9 @@ PUBLIC void mprRemoveRoot(cvoid *ptr);
         if (ptr) { \
             MprMem *_mp = MPR_GET_MEM((ptr)); \
             HINC(markVisited); \
+            if (_mp->arena) { \
+                mprMarkArenaBlock(_mp); \
+            } \
             if (_mp->mark != MPR->heap->mark) { \
                 _mp->mark = MPR->heap->mark; \
                 if (_mp->hasManager) { \
@@ -1724,6 +1815,103 @@ PUBLIC void mprWakeGCService(void);
 PUBLIC void mprResumeThreads(void);
 PUBLIC int  mprSyncThreads(MprTicks timeout);
 
+/************************************ Arenas **********************************/
+/**
+    Memory arena for request lifetime allocations
+    @description An arena bump allocates blocks from large chunks obtained from the garbage collected heap. This
+        replaces many small heap allocations with a few chunk allocations that are marked and swept as single blocks.
+        Arena blocks have regular block headers and can be used and marked like any other memory block. Marking an
+        arena block retains its chunk, so blocks that outlive an arena reset remain valid. Released chunks are reused
+        only after a full collection has completed without marking any of their blocks. Arena blocks are never
+        individually freed and manager functions are not invoked with MPR_MANAGE_FREE. Do not use #mprHold on arena
+        blocks, use #mprAddRoot instead.
+    @defgroup MprArena MprArena
+    @see mprArenaAllocMem mprArenaClone mprCreateArena mprResetArena
+    @stability Prototype
+ */
+typedef struct MprArena {
+    struct MprArenaChunk *chunk;        /**< Current chunk */
+    struct MprArenaChunk *spare;        /**< Released chunks awaiting reuse. Oldest first */
+    char        *next;                  /**< Next free byte in the current chunk */
+    char        *end;                   /**< End of the current chunk */
+    size_t      chunkSize;              /**< Size of arena chunks */
+    size_t      allocated;              /**< Bytes allocated from the arena since the last reset */
+    int         chunks;                 /**< Chunks in use since the last reset */
+    int         spares;                 /**< Number of released chunks */
+} MprArena;
+
+/**
+    Arena chunk header
+    @ingroup MprArena
+    @stability Internal
+ */
+typedef struct MprArenaChunk {
+    struct MprArenaChunk *link;         /**< Prior chunk in use or next released chunk */
+    uint        sweep;                  /**< GC sweep count when the chunk was released */
+    int         referenced;             /**< Set by the collector when a block in the chunk is marked */
+} MprArenaChunk;
+
+/**
+    Create a memory arena
+    @param chunkSize Size of the chunks to allocate from the heap. Set to zero for a default size.
+    @return The arena object
+    @ingroup MprArena
+    @stability Prototype
+ */
+PUBLIC MprArena *mprCreateArena(size_t chunkSize);
+
+/**
+    Allocate a block of memory from an arena
+    @description Blocks larger than a quarter of the chunk size are allocated from the heap.
+    @param arena Arena to allocate from. If NULL, the block is allocated from the heap via #mprAllocMem.
+    @param size Size of the memory block to allocate.
+    @param flags Allocation flags. Supported flags include: MPR_ALLOC_MANAGER to reserve room for a manager callback
+        and MPR_ALLOC_ZERO to zero allocated memory.
+    @return Returns a pointer to the allocated block.
+    @ingroup MprArena
+    @stability Prototype
+ */
+PUBLIC void *mprArenaAllocMem(MprArena *arena, size_t size, int flags);
+
+/**
+    Clone a string into an arena
+    @param arena Arena to allocate from. If NULL, the string is allocated from the heap.
+    @param str String to clone. May be NULL.
+    @param len Length of the string to clone. Set to -1 to clone the entire string.
+    @return An allocated, null terminated string. Returns an empty string if str is NULL.
+    @ingroup MprArena
+    @stability Prototype
+ */
+PUBLIC char *mprArenaClone(MprArena *arena, cchar *str, ssize len);
+
+/**
+    Reset an arena
+    @description This releases all blocks in one step. Allocation continues in the remainder of the current chunk.
+        Prior chunks are retained for reuse by the arena, up to ME_MPR_ARENA_SPARES chunks. Other chunks are reclaimed
+        by the garbage collector once no blocks inside them are referenced.
+    @param arena Arena to reset. May be NULL.
+    @ingroup MprArena
+    @stability Prototype
+ */
+PUBLIC void mprResetArena(MprArena *arena);
+
+/**
+    Allocate an object from an arena
+    @param arena Arena to allocate from. May be NULL.
+    @param type Type of the object to allocate.
+    @param manage Manager function for the object.
+    @return Returns a pointer to the zeroed object.
+    @ingroup MprArena
+    @stability Prototype
+ */
+#define mprArenaAllocObj(arena, type, manage) ((type*) mprSetManager( \
+        mprArenaAllocMem(arena, sizeof(type), MPR_ALLOC_MANAGER | MPR_ALLOC_ZERO), (MprManager) manage))
+
+/*
+    Internal
+ */
+PUBLIC void mprMarkArenaBlock(MprMem *mp);
+
 /********************************** Safe Strings ******************************/
 /**
     Safe String Module
@@ -2720,6 +2908,18 @@ PUBLIC MprBuf *mprCreateBuf(ssize initialSize, ssize maxSize);
  */
 PUBLIC MprBuf *mprCloneBuf(MprBuf *orig);
 
+/**
+    Create a read-only view of a buffer
+    @description Create a buffer that shares the contents of another buffer without copying. The view has its own
+        start and end pointers so it can be consumed independently of the original and of other views. Views are
+        read-only: do not write to or flush a view, and do not modify the original while views exist.
+    @param orig Original buffer to share
+    @return Returns a newly allocated buffer view
+    @ingroup MprBuf
+    @stability Prototype
+ */
+PUBLIC MprBuf *mprCreateBufView(MprBuf *orig);
+
 /**
     Clone a buffer contents
     @param bp Buffer to copy
@@ -4216,6 +4416,7 @@ typedef struct MprHash {
     MprKey          **buckets;          /**< Hash collision bucket table */
     MprHashProc     fn;                 /**< Hash function */
     MprMutex        *mutex;             /**< GC marker sync */
+    MprArena        *arena;             /**< Optional arena for the table, buckets and keys */
 } MprHash;
 
 /*
@@ -4301,6 +4502,20 @@ PUBLIC MprHash *mprCloneHash(MprHash *table);
  */
 PUBLIC MprHash *mprCreateHash(int hashSize, int flags);
 
+/**
+    Create a hash table in an arena
+    @description Creates a hash table where the table, buckets, hash entries and duplicated keys are allocated from
+        an arena. Use this for tables that share the lifetime of the arena.
+    @param arena Arena to allocate from. If NULL, this is equivalent to #mprCreateHash.
+    @param hashSize Size of the hash table for the symbol table. Should be a prime number. Set to 0 or -1 to get
+        a default (small) hash table.
+    @param flags Table control flags. See #mprCreateHash for details.
+    @return Returns a pointer to the allocated symbol table.
+    @ingroup MprHash
+    @stability Prototype
+ */
+PUBLIC MprHash *mprCreateHashInArena(MprArena *arena, int hashSize, int flags);
+
 /**
     Create a hash of words
     @description Create a hash table of words from the given string. The hash key entry is the same as the key.
@@ -5882,6 +6097,8 @@ typedef struct MprEventService {
     int             waiting;            /**< Waiting for I/O (sleeping) */
     struct MprCond  *waitCond;          /**< Waiting sync */
     struct MprMutex *mutex;             /**< Multi-thread sync */
+    struct MprWaitService *waitService; /**< Private I/O wait service for an event loop, otherwise null */
+    struct MprThread *thread;           /**< Thread running an event loop, otherwise null */
 } MprEventService;
 
 /**
@@ -5903,6 +6120,19 @@ PUBLIC void mprClearWaiting(void);
  */
 PUBLIC MprDispatcher *mprCreateDispatcher(cchar *name, int flags);
 
+/**
+    Create a new event dispatcher on an event loop.
+    @description Dispatchers created on an event loop are serviced only by the thread running that loop and their
+        wait handlers use the loop's private I/O wait service. All work for the dispatcher stays on the one loop thread.
+    @param loop Event loop returned from #mprGetEventLoop. Set to null to use the primary event service.
+    @param name Useful name for debugging
+    @param flags Dispatcher flags.
+    @returns a Dispatcher object that can manage events and be used with mprCreateEvent
+    @ingroup MprDispatcher
+    @stability Prototype
+ */
+PUBLIC MprDispatcher *mprCreateLoopDispatcher(MprEventService *loop, cchar *name, int flags);
+
 /**
     Disable a dispatcher from service events. This removes the dispatcher from any dispatcher queues and allows
     it to be garbage collected.
@@ -5912,6 +6142,18 @@ PUBLIC MprDispatcher *mprCreateDispatcher(cchar *name, int flags);
  */
 PUBLIC void mprDestroyDispatcher(MprDispatcher *dispatcher);
 
+/**
+    Get an event loop
+    @description Event loops are additional event services, each with a private I/O wait service (epoll or kqueue
+        instance) and a dedicated thread that waits for I/O and runs the events of its dispatchers inline. Loops are
+        created on demand so that asking for loop N creates loops 0 to N as required.
+    @param index Zero based event loop index
+    @returns The event loop service or null if event loops are not supported on this platform.
+    @ingroup MprDispatcher
+    @stability Prototype
+ */
+PUBLIC MprEventService *mprGetEventLoop(int index);
+
 /**
     Get the MPR primary dispatcher
     @returns the MPR dispatcher object
@@ -6370,7 +6612,7 @@ PUBLIC void mprXmlSetParserHandler(MprXml *xp, MprXmlHandler h);
     @stability Evolving
     @see mprBlendJson mprGetJsonObj mprGetJson mprGetJsonLength mprLoadJson mprParseJson mprSetJsonError
         mprParseJsonEx mprParseJsonInto mprQueryJson mprRemoveJson mprSetJsonObj mprSetJson mprJsonToString mprLogJson
-        mprReadJson mprWriteJsonObj mprWriteJson mprWriteJsonObj
+        mprReadJson mprWriteJsonObj mprWriteJson mprWriteJsonObj mprPackHash mprPackJson mprUnpackHash mprUnpackJson
  */
 typedef struct MprJson {
     cchar           *name;              /**< Property name for this object */
@@ -6825,6 +7067,65 @@ PUBLIC int mprSaveJson(MprJson *obj, cchar *path, int flags);
  */
 PUBLIC char *mprSerialize(MprHash *hash, int flags);
 
+/*
+    Packed binary encoding. Strings are stored as a length, the bytes and a trailing null so unpacked strings
+    may reference the packed data directly.
+ */
+#define MPR_PACK_HASH       0xA1        /**< Leading byte of a packed hash */
+#define MPR_PACK_JSON       0xA2        /**< Leading byte of a packed JSON tree */
+#define MPR_PACK_REFERENCE  0x1         /**< Unpacked strings reference the packed data rather than being copied */
+
+/**
+    Pack a hash of properties into a compact binary form
+    @description This is a faster and more compact alternative to #mprSerialize. Hash values must be strings.
+        The packed data may contain nulls. Unpack with #mprUnpackHash.
+    @param buf Buffer to receive the packed data. The data is appended to any existing buffer contents.
+    @param hash Hash of properties to pack
+    @return The number of bytes appended to the buffer.
+    @ingroup MprJson
+    @stability Prototype
+ */
+PUBLIC ssize mprPackHash(MprBuf *buf, MprHash *hash);
+
+/**
+    Pack a JSON tree into a compact binary form
+    @description This is a faster and more compact alternative to #mprJsonToString. The packed data may contain nulls.
+        Unpack with #mprUnpackJson.
+    @param buf Buffer to receive the packed data. The data is appended to any existing buffer contents.
+    @param obj JSON object to pack
+    @return The number of bytes appended to the buffer.
+    @ingroup MprJson
+    @stability Prototype
+ */
+PUBLIC ssize mprPackJson(MprBuf *buf, MprJson *obj);
+
+/**
+    Unpack a hash packed by #mprPackHash
+    @description The packed data is validated and is not parsed as text.
+    @param hash Hash to receive the properties. If the MPR_PACK_REFERENCE flag is used, the hash must be created with
+        MPR_HASH_STATIC_ALL.
+    @param data Packed data
+    @param len Length of the packed data. Data following the packed hash is ignored.
+    @param flags Set to MPR_PACK_REFERENCE to reference keys and values in the packed data without copying. The caller
+        must then retain the packed data for the life of the hash.
+    @return The number of bytes of packed data used. Returns a negative MPR error code if the data is not a valid
+        packed hash.
+    @ingroup MprJson
+    @stability Prototype
+ */
+PUBLIC ssize mprUnpackHash(MprHash *hash, cchar *data, ssize len, int flags);
+
+/**
+    Unpack a JSON tree packed by #mprPackJson
+    @param data Packed data
+    @param len Length of the packed data. Data following the packed tree is ignored.
+    @param used Optional reference to receive the number of bytes of packed data used.
+    @return The JSON object. Returns null if the data is not a valid packed JSON tree.
+    @ingroup MprJson
+    @stability Prototype
+ */
+PUBLIC MprJson *mprUnpackJson(cchar *data, ssize len, ssize *used);
+
 /**
     Signal a parse error in the JSON input stream.
     @description JSON callback functions will invoke mprSetJsonError when JSON parse or data semantic errors are
@@ -6947,6 +7248,9 @@ typedef struct MprThread {
 #if ME_MPR_ALLOC_STACK
     void            *stackBase;         /**< Base of stack (approx) */
     int             peakStack;          /**< Peak stack usage */
+#endif
+#if ME_MPR_ALLOC_THREAD_CACHE
+    MprAllocCache   allocCache;         /**< Small block allocation cache */
 #endif
     bool            isWorker: 1;        /**< Is a worker thread */
     bool            isMain: 1;          /**< Is the main thread */
@@ -7149,16 +7453,19 @@ typedef struct MprWaitService {
 #endif /* EVENT_SELECT */
     MprMutex        *mutex;                 /* General multi-thread sync */
     MprSpin         *spin;                  /* Fast short locking */
+    struct MprEventService *eventService;   /* Event service that sleeps on this wait service */
 } MprWaitService;
 
 /*
     Internal
  */
 PUBLIC MprWaitService *mprCreateWaitService(void);
+PUBLIC MprWaitService *mprCreateLoopWaitService(struct MprEventService *es);
 PUBLIC void mprTermOsWait(MprWaitService *ws);
 PUBLIC void mprStopWaitService(void);
 PUBLIC void mprSetWaitServiceThread(MprWaitService *ws, MprThread *thread);
 PUBLIC void mprWakeNotifier(void);
+PUBLIC void mprWakeWaitService(MprWaitService *ws);
 #if MPR_EVENT_ASYNC
     PUBLIC void mprManageAsync(MprWaitService *ws, int flags);
 #endif
@@ -7425,6 +7732,25 @@ typedef struct MprSocketProvider {
         @stability Stable
      */
     char    *(*socketState)(struct MprSocket *socket);
+
+    /**
+        Encrypt or decrypt data with authenticated encryption (AES-256-GCM)
+        @description Optional. Providers that implement this expose the cipher used by the TLS stack to
+            #mprSealData and #mprOpenData.
+        @param encrypt Set to true to encrypt and compute the tag. Set to false to decrypt and verify the tag.
+        @param key Key of MPR_AEAD_KEY bytes
+        @param nonce Nonce of MPR_AEAD_NONCE bytes
+        @param aad Additional data to authenticate but not encrypt. May be null.
+        @param aadLen Length of the additional data
+        @param input Data to encrypt or decrypt
+        @param len Length of the input. The output is the same length.
+        @param output Buffer to receive the output
+        @param tag Authentication tag of MPR_AEAD_TAG bytes. Written when encrypting, verified when decrypting.
+        @return Zero if successful, otherwise a negative MPR error code.
+        @stability Prototype
+     */
+    int     (*cryptData)(bool encrypt, cuchar *key, cuchar *nonce, cuchar *aad, ssize aadLen, cuchar *input, ssize len,
+                uchar *output, uchar *tag);
 } MprSocketProvider;
 
 /**
@@ -7507,6 +7833,7 @@ PUBLIC int mprSetMaxSocketAccept(int max);
 #define MPR_SOCKET_DISCONNECTED     0x4000  /**< The mprDisconnectSocket has been called */
 #define MPR_SOCKET_HANDSHAKING      0x8000  /**< Doing an SSL handshake */
 #define MPR_SOCKET_CERT_ERROR       0x10000 /**< Error when validating peer certificate */
+#define MPR_SOCKET_REUSEPORT        0x20000 /**< Permit other sockets to listen on the same endpoint (SO_REUSEPORT) */
 
 /**
     Socket Service
@@ -7551,6 +7878,8 @@ typedef struct MprSocket {
     bool            secured;            /**< SSL Peer verified */
     MprMutex        *mutex;             /**< Multi-thread sync */
     void            *data;              /**< Custom user data (unmanaged) */
+    char            *writeBuf;          /**< Buffer to coalesce vectored writes into full TLS records */
+    ssize           writePending;       /**< Length of an incomplete coalesced write that must be retried */
 } MprSocket;
 
 
@@ -8014,7 +8343,9 @@ PUBLIC ssize mprWriteSocketString(MprSocket *sp, cchar *str);
 
 /**
     Write a vector to a socket
-    @description Do scatter/gather I/O by writing a vector of buffers to a socket.
+    @description Do scatter/gather I/O by writing a vector of buffers to a socket. For secure sockets, small
+        fragments are coalesced into blocks of up to ME_MPR_SSL_RECORD_SIZE bytes so that each TLS record is full sized.
+        If a write is incomplete, the caller must retry with the unwritten remainder of the same vector.
     @param sp Socket object returned from #mprCreateSocket
     @param iovec Vector of data to write before the file contents
     @param count Count of entries in beforeVect
@@ -8038,6 +8369,9 @@ PUBLIC ssize mprWriteSocketVector(MprSocket *sp, MprIOVec *iovec, int count);
 #ifndef ME_MPR_SSL_LOG_LEVEL
     #define ME_MPR_SSL_LOG_LEVEL 6
 #endif
+#ifndef ME_MPR_SSL_RECORD_SIZE
+    #define ME_MPR_SSL_RECORD_SIZE 16384        /**< Maximum TLS record payload. Vectored writes are coalesced to this */
+#endif
 #ifndef ME_MPR_SSL_RENEGOTIATE
     #define ME_MPR_SSL_RENEGOTIATE 1
 #endif
@@ -8097,6 +8431,13 @@ typedef struct MprSsl {
 #define MPR_PROTO_TLSV1    (MPR_PROTO_TLSV1_1 | MPR_PROTO_TLSV1_2 | MPR_PROTO_TLSV1_3)
 #define MPR_PROTO_ALL      0x6B             /**< All protocols */
 
+/*
+    Authenticated encryption sizes for mprSealData and mprOpenData (AES-256-GCM)
+ */
+#define MPR_AEAD_KEY       32               /**< Key length */
+#define MPR_AEAD_NONCE     12               /**< Nonce length */
+#define MPR_AEAD_TAG       16               /**< Authentication tag length */
+
 /**
     Add the ciphers to use for SSL
     @param ssl SSL instance returned from #mprCreateSsl
@@ -8129,6 +8470,44 @@ PUBLIC struct MprSsl *mprCloneSsl(MprSsl *src);
  */
 PUBLIC int mprLoadSsl(void);
 
+/**
+    Decrypt and verify data sealed by #mprSealData
+    @description Uses the authenticated encryption of the SSL provider. The SSL provider is loaded if required.
+    @param key Key of MPR_AEAD_KEY bytes
+    @param nonce Nonce of MPR_AEAD_NONCE bytes used when sealing
+    @param aad Additional authenticated data used when sealing. May be null.
+    @param aadLen Length of the additional data
+    @param input Encrypted data
+    @param len Length of the encrypted data
+    @param output Buffer of at least len bytes to receive the decrypted data
+    @param tag Authentication tag of MPR_AEAD_TAG bytes
+    @return Zero if the data is authentic and was decrypted. Returns MPR_ERR_BAD_STATE if the data has been modified
+        or MPR_ERR_NOT_READY if the SSL provider does not support authenticated encryption.
+    @ingroup MprSsl
+    @stability Prototype
+ */
+PUBLIC int mprOpenData(cuchar *key, cuchar *nonce, cuchar *aad, ssize aadLen, cuchar *input, ssize len, uchar *output,
+    cuchar *tag);
+
+/**
+    Encrypt and authenticate data
+    @description Uses the authenticated encryption (AES-256-GCM) of the SSL provider. The SSL provider is loaded
+        if required. A nonce must never be reused with the same key.
+    @param key Key of MPR_AEAD_KEY bytes
+    @param nonce Nonce of MPR_AEAD_NONCE bytes
+    @param aad Additional data to authenticate but not encrypt. May be null.
+    @param aadLen Length of the additional data
+    @param input Data to encrypt
+    @param len Length of the data
+    @param output Buffer of at least len bytes to receive the encrypted data
+    @param tag Buffer of MPR_AEAD_TAG bytes to receive the authentication tag
+    @return Zero if successful. Returns MPR_ERR_NOT_READY if the SSL provider does not support authenticated encryption.
+    @ingroup MprSsl
+    @stability Prototype
+ */
+PUBLIC int mprSealData(cuchar *key, cuchar *nonce, cuchar *aad, ssize aadLen, cuchar *input, ssize len, uchar *output,
+    uchar *tag);
+
 /**
     Initialize the SSL provider
     @ingroup MprSsl
@@ -9312,23 +9691,36 @@ PUBLIC ssize mprWriteCmdBlock(MprCmd *cmd, int channel, cchar *buf, ssize bufsiz
  */
 typedef void (*MprCacheProc)(struct MprCache *cache, cchar *key, cchar *data, int event);
 
+/**
+    Cache shard. Keys are distributed over the shards of a cache by hash and each shard has its own lock.
+    @ingroup MprCache
+    @stability Internal
+ */
+typedef struct MprCacheShard {
+    MprHash         *store;             /**< Key/value store */
+    MprMutex        *mutex;             /**< Shard lock */
+    ssize           usedMem;            /**< Memory in use for keys and data */
+} MprCacheShard;
+
 /**
     In-memory caching. The MprCache provides a fast, in-memory caching of cache items. Cache items are string key / value
     pairs. Cache items have a configurable lifespan and the Cache manager will automatically prune expired items.
     Items also have an associated version number that can be used when writing to do transactional writes.
+    @description The cache is split into ME_MPR_CACHE_SHARDS shards that are locked and pruned independently so that
+        concurrent access to different keys does not contend. The key and memory limits are divided evenly over the shards.
     @defgroup MprCache MprCache
-    @see mprCreateCache mprDestroyCache mprExpireCache mprIncCache mprReadCache mprRemoveCache mprSetCacheLimits
-        mprWriteCache
+    @see mprCreateCache mprDestroyCache mprExpireCache mprIncCache mprReadCache mprReadCacheBlock mprRemoveCache
+        mprSetCacheLimits mprWriteCache mprWriteCacheBlock
     @stability Internal
  */
 typedef struct MprCache {
-    MprHash         *store;             /**< Key/value store */
-    MprMutex        *mutex;             /**< Cache lock */
+    MprCacheShard   *shards;            /**< Key/value store shards */
+    int             numShards;          /**< Number of shards */
+    MprMutex        *mutex;             /**< Cache lock for the pruning timer */
     MprEvent        *timer;             /**< Pruning timer */
     MprTicks        lifespan;           /**< Default lifespan (msec) */
     MprCacheProc    notify;             /* Notification callback for item expiry */
     int             resolution;         /**< Frequence for pruner */
-    ssize           usedMem;            /**< Memory in use for keys and data */
     ssize           maxKeys;            /**< Max number of keys */
     ssize           maxMem;             /**< Max memory for session data */
     struct MprCache *shared;            /**< Shared common cache */
@@ -9430,6 +9822,22 @@ PUBLIC void mprPruneCache(MprCache *cache);
   */
 PUBLIC char *mprReadCache(MprCache *cache, cchar *key, MprTime *modified, int64 *version);
 
+/**
+    Read a block of data from the cache.
+    @description Use this to read items written by #mprWriteCacheBlock that may contain binary data.
+    @param cache The cache instance object returned from #mprCreateCache.
+    @param key Cache item key
+    @param len Optional reference to receive the length of the item data. Set to null if not required.
+    @param modified Optional MprTime value reference to receive the last modified time of the cache item. Set to null
+        if not required.
+    @param version Optional int64 value reference to receive the version number of the cache item. Set to null
+        if not required.
+    @return The cache item data. The data is always null terminated. Callers must not modify the data.
+    @ingroup MprCache
+    @stability Prototype
+  */
+PUBLIC char *mprReadCacheBlock(MprCache *cache, cchar *key, ssize *len, MprTime *modified, int64 *version);
+
 /**
     Remove items from the cache
     @param cache The cache instance object returned from #mprCreateCache.
@@ -9467,6 +9875,16 @@ PUBLIC void mprSetCacheNotify(MprCache *cache, MprCacheProc notify);
   */
 PUBLIC void mprSetCacheLimits(MprCache *cache, int64 keys, MprTicks lifespan, int64 memory, int resolution);
 
+/**
+    Get the linked managed memory reference for a cached item.
+    @param cache The cache instance object returned from #mprCreateCache.
+    @param key Cache item key to read
+    @return The managed memory reference set via #mprSetCacheLink or NULL if the key is not found.
+    @ingroup MprCache
+    @stability Evolving
+ */
+PUBLIC void *mprGetCacheLink(MprCache *cache, cchar *key);
+
 /**
     Set a linked managed memory reference for a cached item.
     @param cache The cache instance object returned from #mprCreateCache.
@@ -9485,7 +9903,8 @@ PUBLIC int mprSetCacheLink(MprCache *cache, cchar *key, void *link);
     @param modified Value to set for the cache last modified time. If set to zero, the current time is obtained via
         #mprGetTime.
     @param lifespan Lifespan of the item in milliseconds. The item will be removed from the cache by the Cache manager
-        when the lifetime expires unless it is rewritten to extend the lifespan.
+        when the lifetime expires unless it is rewritten to extend the lifespan. Set to -1 to use the cache default
+        lifespan for new items.
     @param version Expected version number of the item. This is used to do transactional writes to the cache item.
         First the version number is retrieved via #mprReadCache and that version number is supplied to mprWriteCache when
         the item is updated. If another caller updates the item in between the read/write, the version number will not
@@ -9504,6 +9923,27 @@ PUBLIC int mprSetCacheLink(MprCache *cache, cchar *key, void *link);
 PUBLIC ssize mprWriteCache(MprCache *cache, cchar *key, cchar *value, MprTime modified, MprTicks lifespan,
         int64 version, int options);
 
+/**
+    Write a block of data to the cache.
+    @description Same as #mprWriteCache but the value may contain binary data including nulls. A copy of the
+        value is stored with a trailing null. Use #mprReadCacheBlock to read the data and its length.
+    @param cache The cache instance object returned from #mprCreateCache.
+    @param key Cache item key to write
+    @param value Data to set for the cache item
+    @param len Length of the value data
+    @param modified Value to set for the cache last modified time. If set to zero, the current time is obtained via
+        #mprGetTime.
+    @param lifespan Lifespan of the item in milliseconds. Set to -1 to use the cache default lifespan for new items.
+    @param version Expected version number of the item. Set to zero if version checking is not required.
+    @param options Options to control how the item value is updated. See #mprWriteCache for details.
+    @return If writing the cache item was successful this call returns the number of bytes written. Otherwise a negative
+        MPR error code is returned.
+    @ingroup MprCache
+    @stability Prototype
+ */
+PUBLIC ssize mprWriteCacheBlock(MprCache *cache, cchar *key, cchar *value, ssize len, MprTime modified,
+        MprTicks lifespan, int64 version, int options);
+
 /******************************** Mime Types **********************************/
 /**
     Mime Type hash table entry (the URL extension is the key)
@@ -9683,6 +10123,7 @@ typedef struct Mpr {
 
     struct MprDispatcher    *dispatcher;    /**< Primary dispatcher */
     struct MprDispatcher    *nonBlock;      /**< Nonblocking dispatcher */
+    MprList                 *eventLoops;    /**< Additional event loop services */
 
     /*
         These are here to optimize access to these singleton service objects
@@ -58,6 +58,12 @@
 #define GET_NEXT(mp)                ((MprMem*) ((char*) mp + mp->size))
 #define GET_REGION(mp)              ((MprRegion*) (((char*) mp) - MPR_ALLOC_ALIGN(sizeof(MprRegion))))
 
+/*
+    Arena blocks are preceded by a link to their chunk so that marking an arena block retains the chunk
+ */
+#define ARENA_HEADER                MPR_ALLOC_ALIGN(sizeof(void*) + sizeof(MprMem))
+#define ARENA_CHUNK(mp)             (((void**) (mp))[-1])
+
 /*
     Memory checking and breakpoints
     ME_MPR_ALLOC_DEBUG checks that blocks are valid and keeps track of the location where memory is allocated from.
@@ -139,17 +145,32 @@ static MprHeap      *heap;
 static MprMemStats  memStats;
 static int          padding[] = { 0, MPR_MANAGER_SIZE };
 
+#if ME_MPR_ALLOC_THREAD_CACHE
+    #if ME_WIN_LIKE
+        static __declspec(thread) MprAllocCache *threadCache;
+    #else
+        static __thread MprAllocCache *threadCache;
+    #endif
+#endif
+
 /***************************** Forward Declarations ***************************/
 
 static ME_INLINE bool acquire(MprFreeQueue *freeq);
 static void allocException(int cause, size_t size);
 static MprMem *allocMem(size_t size);
+#if ME_MPR_ALLOC_THREAD_CACHE
+    static ME_INLINE MprMem *allocCached(MprAllocCache *cache, int qindex, size_t required);
+    static void flushCache(MprAllocCache *cache);
+    static void flushIdleCaches(void);
+    static bool refillCache(MprAllocCache *cache, int qindex);
+#endif
 static ME_INLINE int cas(size_t *target, size_t expected, size_t value);
 static ME_INLINE bool claim(MprMem *mp);
 static ME_INLINE void clearbitmap(size_t *bitmap, int bindex);
 static void dummyManager(void *ptr, int flags);
 static void freeBlock(MprMem *mp);
 static void getSystemInfo(void);
+static bool growArena(MprArena *arena);
 static MprMem *growHeap(size_t size);
 static void invokeAllDestructors(void);
 static ME_INLINE size_t qtosize(int qindex);
@@ -158,10 +179,18 @@ static ME_INLINE void linkSpareBlock(char *ptr, size_t size);
 static ME_INLINE void initBlock(MprMem *mp, size_t size, int first);
 static int initQueues(void);
 static void invokeDestructors(void);
+static void manageArena(MprArena *arena, int flags);
+static void manageArenaChunk(MprArenaChunk *cp, int flags);
 static void markAndSweep(void);
 static void markRoots(void);
+static uint64 pauseClock(void);
 static int pauseThreads(void);
+static void recordAbandoned(uint64 start);
+static void recordPause(uint64 start);
 static void printMemReport(void);
+#if ME_MPR_ALLOC_THREAD_CACHE
+    static void printThreadCaches(void);
+#endif
 static ME_INLINE void release(MprFreeQueue *freeq);
 static void resumeThreads(int flags);
 static ME_INLINE void setbitmap(size_t *bitmap, int bindex);
@@ -240,6 +269,7 @@ PUBLIC Mpr *mprCreateMemService(MprManager manager, int flags)
     heap->stats.cacheHeap = ME_MPR_ALLOC_CACHE;
     heap->stats.lowHeap = max(ME_MPR_ALLOC_CACHE / 8, ME_MPR_ALLOC_REGION_SIZE);
     heap->workQuota = ME_MPR_ALLOC_QUOTA;
+    heap->syncTimeout = ME_MPR_GC_SYNC_TIMEOUT;
     heap->gcEnabled = !(heap->flags & MPR_DISABLE_GC);
 
     /* Internal testing use only */
@@ -408,6 +438,170 @@ PUBLIC void *mprMemdupMem(cvoid *ptr, size_t usize)
 }
 
 
+PUBLIC MprArena *mprCreateArena(size_t chunkSize)
+{
+    MprArena    *arena;
+
+    if ((arena = mprAllocObj(MprArena, manageArena)) == 0) {
+        return 0;
+    }
+    if (chunkSize == 0) {
+        chunkSize = ME_MPR_ARENA_SIZE;
+    }
+    arena->chunkSize = max(chunkSize, 1024);
+    return arena;
+}
+
+
+static void manageArena(MprArena *arena, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(arena->chunk);
+        mprMark(arena->spare);
+    }
+}
+
+
+static void manageArenaChunk(MprArenaChunk *cp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(cp->link);
+    }
+}
+
+
+/*
+    Get a chunk for the arena. The oldest released chunk is reused once a full mark phase has started and completed
+    since its release without marking any of its blocks. That requires two completed sweeps as a sweep may have been
+    in progress at the time of release. Released chunks with referenced blocks are dropped and left to the collector.
+ */
+static bool growArena(MprArena *arena)
+{
+    MprArenaChunk   *cp, *reuse;
+
+    for (reuse = 0; (cp = arena->spare) != 0; ) {
+        if (!cp->referenced && (heap->stats.sweeps - cp->sweep) < 2) {
+            break;
+        }
+        arena->spare = cp->link;
+        arena->spares--;
+        cp->link = 0;
+        if (!cp->referenced) {
+            reuse = cp;
+            break;
+        }
+    }
+    if ((cp = reuse) == 0) {
+        if ((cp = mprAllocMem(arena->chunkSize, MPR_ALLOC_MANAGER)) == 0) {
+            return 0;
+        }
+        mprSetManager(cp, (MprManager) manageArenaChunk);
+    }
+    cp->referenced = 0;
+    cp->link = arena->chunk;
+    arena->chunk = cp;
+    arena->next = (char*) cp + MPR_ALLOC_ALIGN(sizeof(MprArenaChunk));
+    arena->end = (char*) cp + GET_USIZE(GET_MEM(cp));
+    arena->chunks++;
+    return 1;
+}
+
+
+/*
+    Bump allocate a block from the current arena chunk. The block has a regular block header so it can be marked,
+    sized and reallocated like heap blocks. The sweeper never visits it as it walks over the enclosing chunk.
+ */
+PUBLIC void *mprArenaAllocMem(MprArena *arena, size_t usize, int flags)
+{
+    MprMem      *mp;
+    size_t      size;
+    int         padWords;
+
+    if (arena == 0 || usize > (arena->chunkSize / 4)) {
+        return mprAllocMem(usize, flags);
+    }
+    padWords = padding[flags & MPR_ALLOC_PAD_MASK];
+    size = ARENA_HEADER + MPR_ALLOC_ALIGN(usize + (padWords * sizeof(void*)));
+    if ((size_t) (arena->end - arena->next) < size && !growArena(arena)) {
+        return 0;
+    }
+    mp = (MprMem*) (arena->next + ARENA_HEADER - sizeof(MprMem));
+    initBlock(mp, size - (ARENA_HEADER - sizeof(MprMem)), 0);
+    mp->arena = 1;
+    mp->hasManager = (flags & MPR_ALLOC_MANAGER) ? 1 : 0;
+    ARENA_CHUNK(mp) = arena->chunk;
+    if (flags & MPR_ALLOC_ZERO) {
+        memset(GET_PTR(mp), 0, GET_USIZE(mp));
+    }
+    arena->next += size;
+    arena->allocated += size;
+    return GET_PTR(mp);
+}
+
+
+PUBLIC char *mprArenaClone(MprArena *arena, cchar *str, ssize len)
+{
+    char    *ptr, *end;
+
+    if (str == 0) {
+        str = "";
+    }
+    if (len < 0) {
+        len = slen(str);
+    } else if ((end = memchr(str, 0, len)) != 0) {
+        len = end - str;
+    }
+    if ((ptr = mprArenaAllocMem(arena, len + 1, 0)) != 0) {
+        memcpy(ptr, str, len);
+        ptr[len] = '\0';
+    }
+    return ptr;
+}
+
+
+/*
+    Release all blocks. Allocation continues in the remainder of the current chunk so partly used chunks are not
+    wasted. Prior chunks are released: up to ME_MPR_ARENA_SPARES are retained for reuse and the rest are left to the
+    collector.
+ */
+PUBLIC void mprResetArena(MprArena *arena)
+{
+    MprArenaChunk   *cp, *prior, **tail;
+
+    if (arena == 0 || arena->chunk == 0) {
+        return;
+    }
+    for (tail = &arena->spare; *tail; tail = &(*tail)->link) { }
+    for (cp = arena->chunk->link; cp; cp = prior) {
+        prior = cp->link;
+        cp->link = 0;
+        if (arena->spares < ME_MPR_ARENA_SPARES) {
+            cp->sweep = heap->stats.sweeps;
+            cp->referenced = 0;
+            *tail = cp;
+            tail = &cp->link;
+            arena->spares++;
+        }
+    }
+    arena->chunk->link = 0;
+    arena->allocated = 0;
+    arena->chunks = 1;
+}
+
+
+/*
+    Called by mprMark for arena blocks. This records that the chunk has a referenced block so it will not be reused.
+ */
+PUBLIC void mprMarkArenaBlock(MprMem *mp)
+{
+    MprArenaChunk   *cp;
+
+    cp = ARENA_CHUNK(mp);
+    cp->referenced = 1;
+    mprMark(cp);
+}
+
+
 PUBLIC int mprMemcmp(cvoid *s1, size_t s1Len, cvoid *s2, size_t s2Len)
 {
     int         rc;
@@ -506,6 +700,13 @@ static MprMem *allocMem(size_t required)
     }
     baseQindex = qindex;
 
+#if ME_MPR_ALLOC_THREAD_CACHE
+    if (qindex >= 0 && qindex < MPR_ALLOC_CACHE_QUEUES && threadCache) {
+        if ((mp = allocCached(threadCache, qindex, required)) != 0) {
+            return mp;
+        }
+    }
+#endif
     if (qindex >= 0) {
         heap->workDone += required;
     retry:
@@ -603,6 +804,191 @@ static MprMem *allocMem(size_t required)
 }
 
 
+#if ME_MPR_ALLOC_THREAD_CACHE
+/*
+    Allocate a small block from the calling thread's cache without locking. Cached blocks are unqueued and eternal
+    so the sweeper ignores them until they are allocated or flushed. GC work is accounted when the cache is refilled.
+ */
+static ME_INLINE MprMem *allocCached(MprAllocCache *cache, int qindex, size_t required)
+{
+    MprFreeMem  *fp;
+    MprMem      *mp;
+
+    if ((fp = cache->blocks[qindex]) == 0) {
+        cache->misses++;
+        if (!refillCache(cache, qindex)) {
+            return 0;
+        }
+        fp = cache->blocks[qindex];
+    } else {
+        cache->hits++;
+    }
+    cache->blocks[qindex] = fp->next;
+    cache->count[qindex]--;
+    cache->active = 1;
+
+    mp = (MprMem*) fp;
+    mp->mark = heap->mark;
+    assert(mp->size >= required);
+
+    if (!heap->gcRequested && heap->workDone > heap->workQuota) {
+        triggerGC(0);
+    }
+    return mp;
+}
+
+
+/*
+    Refill a size class of a thread cache. Take a batch of blocks from the shared free queue with one acquisition.
+    If the queue is empty, carve the batch from one larger block.
+ */
+static bool refillCache(MprAllocCache *cache, int qindex)
+{
+    MprFreeQueue    *freeq;
+    MprFreeMem      *fp, *head;
+    MprMem          *mp, *bp;
+    size_t          bytes, size, total;
+    int             count, i;
+
+    freeq = &heap->freeq[qindex];
+    count = 0;
+    bytes = 0;
+    if (freeq->count > 0 && acquire(freeq)) {
+        /*
+            The queue links are updated via MprFreeMem below, so read the head via the same type. Otherwise the
+            compiler may assume the stores do not alias the head and reuse a stale value.
+         */
+        head = (MprFreeMem*) freeq;
+        while (count < ME_MPR_ALLOC_THREAD_BATCH && (fp = head->next) != head) {
+            fp->prev->next = fp->next;
+            fp->next->prev = fp->prev;
+            fp->blk.qindex = 0;
+            fp->blk.mark = heap->mark;
+            fp->blk.free = 0;
+            fp->blk.eternal = 1;
+            freeq->count--;
+            bytes += fp->blk.size;
+            fp->next = cache->blocks[qindex];
+            cache->blocks[qindex] = fp;
+            count++;
+        }
+        if (freeq->count == 0) {
+            clearbitmap(&heap->bitmap[qindex / MPR_ALLOC_BITMAP_BITS], qindex % MPR_ALLOC_BITMAP_BITS);
+        }
+        release(freeq);
+        if (count > 0) {
+            mprAtomicAdd64((int64*) &heap->stats.bytesFree, -(int64) bytes);
+            heap->workDone += bytes;
+            cache->count[qindex] += count;
+            return 1;
+        }
+    }
+    /*
+        Carve a batch of blocks from one block. The batch is large enough to come from an uncached queue.
+        Initialize the trailing blocks before shrinking the first so the sweeper never walks into an uninitialized header.
+     */
+    size = qtosize(qindex);
+    total = max(size * ME_MPR_ALLOC_THREAD_BATCH, qtosize(MPR_ALLOC_CACHE_QUEUES));
+    if ((mp = allocMem(total)) == 0) {
+        return 0;
+    }
+    count = (int) (mp->size / size);
+    for (i = count - 1; i > 0; i--) {
+        bp = (MprMem*) ((char*) mp + (i * size));
+        initBlock(bp, (i == count - 1) ? mp->size - (i * size) : size, 0);
+        bp->eternal = 1;
+        fp = (MprFreeMem*) bp;
+        fp->next = cache->blocks[qindex];
+        cache->blocks[qindex] = fp;
+    }
+    mp->size = (MprMemSize) size;
+    mp->fullRegion = 0;
+    fp = (MprFreeMem*) mp;
+    fp->next = cache->blocks[qindex];
+    cache->blocks[qindex] = fp;
+    cache->count[qindex] += count;
+    return 1;
+}
+
+
+/*
+    Return all cached blocks to the heap. The blocks are made unmarked and non-eternal so the sweeper reclaims them.
+ */
+static void flushCache(MprAllocCache *cache)
+{
+    MprFreeMem  *fp, *next;
+    int         qindex;
+
+    for (qindex = 0; qindex < MPR_ALLOC_CACHE_QUEUES; qindex++) {
+        for (fp = cache->blocks[qindex]; fp; fp = next) {
+            next = fp->next;
+            fp->blk.mark = !heap->mark;
+            fp->blk.eternal = 0;
+        }
+        cache->blocks[qindex] = 0;
+        cache->count[qindex] = 0;
+    }
+    cache->flushes++;
+}
+
+
+/*
+    Flush the caches of threads that have not allocated since the last collection. Called while marking with all
+    threads yielded.
+ */
+static void flushIdleCaches()
+{
+    MprThreadService    *ts;
+    MprThread           *tp;
+    int                 i;
+
+    if ((ts = MPR->threadService) == 0 || !ts->threads) {
+        return;
+    }
+    lock(ts->threads);
+    for (i = 0; i < ts->threads->length; i++) {
+        tp = (MprThread*) mprGetItem(ts->threads, i);
+        if (!tp->allocCache.active) {
+            flushCache(&tp->allocCache);
+        }
+        tp->allocCache.active = 0;
+    }
+    unlock(ts->threads);
+}
+#endif
+
+
+/*
+    Bind the thread's allocation cache to the calling O/S thread
+ */
+PUBLIC void mprBindAllocCache(MprThread *tp)
+{
+#if ME_MPR_ALLOC_THREAD_CACHE
+    threadCache = &tp->allocCache;
+#endif
+}
+
+
+/*
+    Return the thread's cached blocks to the heap when the thread exits
+ */
+PUBLIC void mprReleaseAllocCache(MprThread *tp)
+{
+#if ME_MPR_ALLOC_THREAD_CACHE
+    MprThreadService    *ts;
+
+    ts = MPR->threadService;
+    lock(ts->threads);
+    threadCache = 0;
+    flushCache(&tp->allocCache);
+    heap->retiredHits += tp->allocCache.hits;
+    heap->retiredMisses += tp->allocCache.misses;
+    tp->allocCache.hits = tp->allocCache.misses = 0;
+    unlock(ts->threads);
+#endif
+}
+
+
 /*
     Grow the heap and return a block of the required size (unqueued)
  */
@@ -958,6 +1344,9 @@ PUBLIC void mprWakeGCService()
 static ME_INLINE void triggerGC(int always)
 {
     if (always || (!heap->gcRequested && heap->gcEnabled)) {
+        if (always) {
+            heap->gcForced = 1;
+        }
         heap->gcRequested = 1;
         heap->mustYield = 1;
         mprSignalCond(heap->gcCond);
@@ -1113,10 +1502,14 @@ static int pauseThreads()
     int                 i, allYielded, timeout, noyield;
 
     /*
-        Short timeout wait for all threads to yield. Typically set to 1/10 sec
+        Short timeout wait for all threads to yield. Typically set to 1/10 sec. Unless forced or repeatedly
+        abandoned, limit the wait to the sync timeout so yielded threads are not held waiting on a slow thread.
      */
     heap->mustYield = 1;
     timeout = MPR_TIMEOUT_GC_SYNC;
+    if (heap->syncTimeout > 0 && !heap->gcForced && heap->gcAbandoned < MPR_GC_MAX_ABANDON) {
+        timeout = min(timeout, (int) heap->syncTimeout);
+    }
     if ((ts = MPR->threadService) == 0 || !ts->threads) {
         return 0;
     }
@@ -1148,7 +1541,7 @@ static int pauseThreads()
             /* Do not wait for paused threads if shutting down */
             break;
         }
-        mprWaitForCond(ts->pauseThreads, 20);
+        mprWaitForCond(ts->pauseThreads, min(20, max(1, timeout - (int) mprGetElapsedTicks(start))));
 
     } while (mprGetElapsedTicks(start) < timeout);
 
@@ -1221,6 +1614,9 @@ static void sweeperThread(void *unused, MprThread *tp)
  */
 static void markAndSweep()
 {
+    uint64      start;
+
+    start = pauseClock();
     if (!pauseThreads()) {
 #if ME_MPR_ALLOC_STATS && ME_MPR_ALLOC_DEBUG && MPR_ALLOC_TRACE
         static int warnOnce = 0;
@@ -1231,14 +1627,23 @@ static void markAndSweep()
         }
 #endif
         resumeThreads(YIELDED_THREADS | WAITING_THREADS);
+        if (mprGetState() < MPR_DESTROYING) {
+            heap->gcAbandoned++;
+            recordAbandoned(start);
+        }
         return;
     }
+    heap->gcAbandoned = 0;
+    heap->gcForced = 0;
 
     /*
         Mark used memory. Toggle the in-use heap->mark for each collection.
      */
     heap->mark = !heap->mark;
     markRoots();
+#if ME_MPR_ALLOC_THREAD_CACHE
+    flushIdleCaches();
+#endif
 
     heap->marking = 0;
     heap->priorWorkDone = heap->workDone;
@@ -1249,6 +1654,7 @@ static void markAndSweep()
      */
     heap->sweeping = 1;
     resumeThreads(YIELDED_THREADS);
+    recordPause(start);
     sweep();
     heap->sweeping = 0;
 
@@ -1259,6 +1665,57 @@ static void markAndSweep()
 }
 
 
+/*
+    Monotonic time in usec for measuring GC pauses
+ */
+static uint64 pauseClock()
+{
+#if ME_UNIX_LIKE
+    struct timespec     ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+    return (uint64) mprGetTicks() * 1000;
+#endif
+}
+
+
+/*
+    Add the pause since start to the pause histogram. Only the sweeper thread updates the histogram.
+    Only completed collections are recorded. See recordAbandoned.
+ */
+static void recordPause(uint64 start)
+{
+    uint64      pause;
+    int         bucket;
+
+    pause = pauseClock() - start;
+    for (bucket = 0; bucket < MPR_GC_PAUSE_BUCKETS - 1 && pause >= MPR_GC_PAUSE_LIMIT(bucket); bucket++) { }
+    heap->stats.gcPauses[bucket]++;
+    heap->stats.gcPauseTotal += pause;
+    if (pause > heap->stats.gcPauseMax) {
+        heap->stats.gcPauseMax = pause;
+    }
+}
+
+
+/*
+    Record the time yielded threads waited for a collection that was abandoned
+ */
+static void recordAbandoned(uint64 start)
+{
+    uint64      wait;
+
+    wait = pauseClock() - start;
+    heap->stats.gcAbandoned++;
+    heap->stats.gcAbandonedTotal += wait;
+    if (wait > heap->stats.gcAbandonedMax) {
+        heap->stats.gcAbandonedMax = wait;
+    }
+}
+
+
 static void markRoots()
 {
 #if ME_MPR_ALLOC_STATS
@@ -1625,6 +2082,16 @@ PUBLIC bool mprEnableGC(bool on)
 }
 
 
+PUBLIC MprTicks mprSetGCSyncTimeout(MprTicks timeout)
+{
+    MprTicks    old;
+
+    old = heap->syncTimeout;
+    heap->syncTimeout = max(timeout, 0);
+    return old;
+}
+
+
 PUBLIC void mprAddRoot(cvoid *root)
 {
     if (root) {
@@ -1780,6 +2247,37 @@ PUBLIC void mprPrintMem(cchar *msg, int flags)
 }
 
 
+#if ME_MPR_ALLOC_THREAD_CACHE
+static void printThreadCaches()
+{
+    MprMemStats         *ap;
+    MprThreadService    *ts;
+    MprThread           *tp;
+    MprAllocCache       *cache;
+    uint64              total;
+    int                 i;
+
+    ap = &heap->stats;
+    total = ap->cacheHits + ap->cacheMisses;
+    printf("Thread Caches:\n");
+    printf("  Hit rate        %12.2f %% (%lld / %lld)\n", total ? ap->cacheHits * 100.0 / total : 0.0,
+        (int64) ap->cacheHits, (int64) total);
+    if ((ts = MPR->threadService) != 0 && ts->threads) {
+        lock(ts->threads);
+        for (i = 0; i < ts->threads->length; i++) {
+            tp = (MprThread*) mprGetItem(ts->threads, i);
+            cache = &tp->allocCache;
+            total = cache->hits + cache->misses;
+            printf("  %-15s %12.2f %% (%lld / %lld, flushes %d)\n", tp->name,
+                total ? cache->hits * 100.0 / total : 0.0, (int64) cache->hits, (int64) total, (int) cache->flushes);
+        }
+        unlock(ts->threads);
+    }
+    printf("\n");
+}
+#endif
+
+
 static void printMemReport()
 {
     MprMemStats     *ap;
@@ -1806,6 +2304,9 @@ static void printMemReport()
     printf("  Errors          %12d\n", (int) ap->errors);
     printf("  CPU cores       %12d\n", (int) ap->cpuCores);
     printf("\n");
+#if ME_MPR_ALLOC_THREAD_CACHE
+    printThreadCaches();
+#endif
 
 #if ME_MPR_ALLOC_STATS
     printf("Allocator Stats:\n");
@@ -2171,6 +2672,25 @@ PUBLIC MprMemStats *mprGetMemStats()
 #endif
     heap->stats.rss = mprGetMem();
     heap->stats.cpuUsage = mprGetCPU();
+#if ME_MPR_ALLOC_THREAD_CACHE
+{
+    MprThreadService    *ts;
+    MprThread           *tp;
+    int                 i;
+
+    heap->stats.cacheHits = heap->retiredHits;
+    heap->stats.cacheMisses = heap->retiredMisses;
+    if ((ts = MPR->threadService) != 0 && ts->threads) {
+        lock(ts->threads);
+        for (i = 0; i < ts->threads->length; i++) {
+            tp = (MprThread*) mprGetItem(ts->threads, i);
+            heap->stats.cacheHits += tp->allocCache.hits;
+            heap->stats.cacheMisses += tp->allocCache.misses;
+        }
+        unlock(ts->threads);
+    }
+}
+#endif
     return &heap->stats;
 }
 
@@ -2680,6 +3200,7 @@ static void manageMpr(Mpr *mpr, int flags)
         mprMark(mpr->serverName);
         mprMark(mpr->cmdService);
         mprMark(mpr->eventService);
+        mprMark(mpr->eventLoops);
         mprMark(mpr->fileSystems);
         mprMark(mpr->moduleService);
         mprMark(mpr->osService);
@@ -3757,11 +4278,8 @@ PUBLIC void mprServiceWinIO(MprWaitService *ws, int sockFd, int winMask)
 /*
     Wake the wait service. WARNING: This routine must not require locking. MprEvents in scheduleDispatcher depends on this.
  */
-PUBLIC void mprWakeNotifier()
+PUBLIC void mprWakeWaitService(MprWaitService *ws)
 {
-    MprWaitService  *ws;
-
-    ws = MPR->waitService;
     if (!ws->wakeRequested && ws->hwnd) {
         ws->wakeRequested = 1;
         PostMessage(ws->hwnd, WM_NULL, 0, 0L);
@@ -4176,6 +4694,24 @@ PUBLIC MprBuf *mprCloneBuf(MprBuf *orig)
 }
 
 
+PUBLIC MprBuf *mprCreateBufView(MprBuf *orig)
+{
+    MprBuf      *bp;
+
+    if ((bp = mprAllocObj(MprBuf, manageBuf)) == 0) {
+        return 0;
+    }
+    bp->data = orig->data;
+    bp->start = orig->start;
+    bp->end = orig->end;
+    bp->endbuf = orig->end;
+    bp->buflen = orig->end - orig->data;
+    bp->maxsize = -1;
+    bp->growBy = ME_BUFSIZE;
+    return bp;
+}
+
+
 PUBLIC char *mprCloneBufMem(MprBuf *bp)
 {
     char    *result;
@@ -4861,6 +5397,7 @@ typedef struct CacheItem
 {
     char            *key;               /* Original key */
     char            *data;              /* Cache data */
+    ssize           length;             /* Length of data. Data may be binary and is always null terminated. */
     void            *link;              /* Linked managed reference */
     MprTicks        lifespan;           /* Lifespan after each access to key (msec) */
     MprTicks        lastAccessed;       /* Last accessed time */
@@ -4871,14 +5408,17 @@ typedef struct CacheItem
 
 #define CACHE_TIMER_PERIOD      (60 * TPS)
 #define CACHE_LIFESPAN          (86400 * TPS)
-#define CACHE_HASH_SIZE         257
+#define CACHE_HASH_SIZE         31
 
 /*********************************** Forwards *********************************/
 
+static MprCacheShard *getShard(MprCache *cache, cchar *key);
 static void manageCache(MprCache *cache, int flags);
 static void manageCacheItem(CacheItem *item, int flags);
 static void pruneCache(MprCache *cache, MprEvent *event);
-static void removeItem(MprCache *cache, CacheItem *item);
+static void pruneShard(MprCache *cache, MprCacheShard *shard, MprTicks when);
+static void removeItem(MprCache *cache, MprCacheShard *shard, CacheItem *item);
+static void startPruner(MprCache *cache);
 
 /************************************* Code ***********************************/
 
@@ -4891,8 +5431,9 @@ PUBLIC int mprCreateCacheService()
 
 PUBLIC MprCache *mprCreateCache(int options)
 {
-    MprCache    *cache;
-    int         wantShared;
+    MprCache        *cache;
+    MprCacheShard   *shard;
+    int             wantShared;
 
     if ((cache = mprAllocObj(MprCache, manageCache)) == 0) {
         return 0;
@@ -4902,7 +5443,14 @@ PUBLIC MprCache *mprCreateCache(int options)
         cache->shared = shared;
     } else {
         cache->mutex = mprCreateLock();
-        cache->store = mprCreateHash(CACHE_HASH_SIZE, 0);
+        cache->numShards = ME_MPR_CACHE_SHARDS;
+        if ((cache->shards = mprAllocZeroed(sizeof(MprCacheShard) * cache->numShards)) == 0) {
+            return 0;
+        }
+        for (shard = cache->shards; shard < &cache->shards[cache->numShards]; shard++) {
+            shard->mutex = mprCreateLock();
+            shard->store = mprCreateHash(CACHE_HASH_SIZE, 0);
+        }
         cache->maxMem = MAXSSIZE;
         cache->maxKeys = MAXSSIZE;
         cache->resolution = CACHE_TIMER_PERIOD;
@@ -4930,12 +5478,22 @@ PUBLIC void *mprDestroyCache(MprCache *cache)
 }
 
 
+/*
+    Select the shard for a key
+ */
+static MprCacheShard *getShard(MprCache *cache, cchar *key)
+{
+    return &cache->shards[shash(key, slen(key)) & (cache->numShards - 1)];
+}
+
+
 /*
     Set expires to zero to remove
  */
 PUBLIC int mprExpireCacheItem(MprCache *cache, cchar *key, MprTicks expires)
 {
-    CacheItem   *item;
+    MprCacheShard   *shard;
+    CacheItem       *item;
 
     assert(cache);
     assert(key && *key);
@@ -4944,25 +5502,28 @@ PUBLIC int mprExpireCacheItem(MprCache *cache, cchar *key, MprTicks expires)
         cache = cache->shared;
         assert(cache == shared);
     }
-    lock(cache);
-    if ((item = mprLookupKey(cache->store, key)) == 0) {
-        unlock(cache);
+    shard = getShard(cache, key);
+    lock(shard);
+    if ((item = mprLookupKey(shard->store, key)) == 0) {
+        unlock(shard);
         return MPR_ERR_CANT_FIND;
     }
     if (expires == 0) {
-        removeItem(cache, item);
+        removeItem(cache, shard, item);
     } else {
         item->expires = expires;
     }
-    unlock(cache);
+    unlock(shard);
     return 0;
 }
 
 
 PUBLIC int64 mprIncCache(MprCache *cache, cchar *key, int64 amount)
 {
-    CacheItem   *item;
-    int64       value;
+    MprCacheShard   *shard;
+    CacheItem       *item;
+    int64           value;
+    bool            created;
 
     assert(cache);
     assert(key && *key);
@@ -4972,32 +5533,46 @@ PUBLIC int64 mprIncCache(MprCache *cache, cchar *key, int64 amount)
         assert(cache == shared);
     }
     value = amount;
+    created = 0;
+    shard = getShard(cache, key);
 
-    lock(cache);
-    if ((item = mprLookupKey(cache->store, key)) == 0) {
+    lock(shard);
+    if ((item = mprLookupKey(shard->store, key)) == 0) {
         if ((item = mprAllocObj(CacheItem, manageCacheItem)) == 0) {
+            unlock(shard);
             return 0;
         }
+        item->key = sclone(key);
+        item->lifespan = cache->lifespan;
+        mprAddKey(shard->store, key, item);
+        shard->usedMem += slen(item->key);
+        created = 1;
     } else {
         value += stoi(item->data);
     }
     if (item->data) {
-        cache->usedMem -= slen(item->data);
+        shard->usedMem -= item->length;
     }
     item->data = itos(value);
-    cache->usedMem += slen(item->data);
+    item->length = slen(item->data);
+    shard->usedMem += item->length;
     item->version++;
     item->lastAccessed = mprGetTicks();
     item->expires = item->lastAccessed + item->lifespan;
-    unlock(cache);
+    unlock(shard);
+
+    if (created) {
+        startPruner(cache);
+    }
     return value;
 }
 
 
 PUBLIC char *mprLookupCache(MprCache *cache, cchar *key, MprTime *modified, int64 *version)
 {
-    CacheItem   *item;
-    char        *result;
+    MprCacheShard   *shard;
+    CacheItem       *item;
+    char            *result;
 
     assert(cache);
     assert(key);
@@ -5006,13 +5581,14 @@ PUBLIC char *mprLookupCache(MprCache *cache, cchar *key, MprTime *modified, int6
         cache = cache->shared;
         assert(cache == shared);
     }
-    lock(cache);
-    if ((item = mprLookupKey(cache->store, key)) == 0) {
-        unlock(cache);
+    shard = getShard(cache, key);
+    lock(shard);
+    if ((item = mprLookupKey(shard->store, key)) == 0) {
+        unlock(shard);
         return 0;
     }
     if (item->expires && item->expires <= mprGetTicks()) {
-        unlock(cache);
+        unlock(shard);
         return 0;
     }
     if (version) {
@@ -5022,15 +5598,22 @@ PUBLIC char *mprLookupCache(MprCache *cache, cchar *key, MprTime *modified, int6
         *modified = item->lastModified;
     }
     result = item->data;
-    unlock(cache);
+    unlock(shard);
     return result;
 }
 
 
 PUBLIC char *mprReadCache(MprCache *cache, cchar *key, MprTime *modified, int64 *version)
 {
-    CacheItem   *item;
-    char        *result;
+    return mprReadCacheBlock(cache, key, NULL, modified, version);
+}
+
+
+PUBLIC char *mprReadCacheBlock(MprCache *cache, cchar *key, ssize *len, MprTime *modified, int64 *version)
+{
+    MprCacheShard   *shard;
+    CacheItem       *item;
+    char            *result;
 
     assert(cache);
     assert(key);
@@ -5039,14 +5622,15 @@ PUBLIC char *mprReadCache(MprCache *cache, cchar *key, MprTime *modified, int64
         cache = cache->shared;
         assert(cache == shared);
     }
-    lock(cache);
-    if ((item = mprLookupKey(cache->store, key)) == 0) {
-        unlock(cache);
+    shard = getShard(cache, key);
+    lock(shard);
+    if ((item = mprLookupKey(shard->store, key)) == 0) {
+        unlock(shard);
         return 0;
     }
     if (item->expires && item->expires <= mprGetTicks()) {
-        removeItem(cache, item);
-        unlock(cache);
+        removeItem(cache, shard, item);
+        unlock(shard);
         return 0;
     }
     if (version) {
@@ -5055,43 +5639,55 @@ PUBLIC char *mprReadCache(MprCache *cache, cchar *key, MprTime *modified, int64
     if (modified) {
         *modified = item->lastModified;
     }
+    if (len) {
+        *len = item->length;
+    }
     item->lastAccessed = mprGetTicks();
     item->expires = item->lastAccessed + item->lifespan;
     result = item->data;
-    unlock(cache);
+    unlock(shard);
     return result;
 }
 
 
 PUBLIC bool mprRemoveCache(MprCache *cache, cchar *key)
 {
-    CacheItem   *item;
-    bool        result;
+    MprCacheShard   *shard;
+    CacheItem       *item;
+    bool            result;
 
     assert(cache);
-    assert(key && *key);
+    assert(key == 0 || *key);
 
     if (cache->shared) {
         cache = cache->shared;
         assert(cache == shared);
     }
-    lock(cache);
     if (key) {
-        if ((item = mprLookupKey(cache->store, key)) != 0) {
-            cache->usedMem -= (slen(key) + slen(item->data));
-            mprRemoveKey(cache->store, key);
+        shard = getShard(cache, key);
+        lock(shard);
+        if ((item = mprLookupKey(shard->store, key)) != 0) {
+            shard->usedMem -= (slen(key) + item->length);
+            mprRemoveKey(shard->store, key);
             result = 1;
         } else {
             result = 0;
         }
+        unlock(shard);
 
     } else {
         /* Remove all keys */
-        result = mprGetHashLength(cache->store) ? 1 : 0;
-        cache->store = mprCreateHash(CACHE_HASH_SIZE, 0);
-        cache->usedMem = 0;
+        result = 0;
+        for (shard = cache->shards; shard < &cache->shards[cache->numShards]; shard++) {
+            lock(shard);
+            if (mprGetHashLength(shard->store)) {
+                result = 1;
+            }
+            shard->store = mprCreateHash(CACHE_HASH_SIZE, 0);
+            shard->usedMem = 0;
+            unlock(shard);
+        }
     }
-    unlock(cache);
     return result;
 }
 
@@ -5143,14 +5739,45 @@ PUBLIC void mprSetCacheLimits(MprCache *cache, int64 keys, MprTicks lifespan, in
 PUBLIC ssize mprWriteCache(MprCache *cache, cchar *key, cchar *value, MprTime modified, MprTicks lifespan,
     int64 version, int options)
 {
-    CacheItem   *item;
-    MprKey      *kp;
-    ssize       len, oldLen;
-    int         exists, add, set, prepend, append, throw, event;
+    assert(value);
+    return mprWriteCacheBlock(cache, key, value, slen(value), modified, lifespan, version, options);
+}
+
+
+/*
+    Join two blocks into a null terminated block
+ */
+static char *joinBlocks(cchar *first, ssize firstLen, cchar *second, ssize secondLen)
+{
+    char    *result;
+
+    if ((result = mprAlloc(firstLen + secondLen + 1)) == 0) {
+        return 0;
+    }
+    if (firstLen > 0) {
+        memcpy(result, first, firstLen);
+    }
+    if (secondLen > 0) {
+        memcpy(&result[firstLen], second, secondLen);
+    }
+    result[firstLen + secondLen] = '\0';
+    return result;
+}
+
+
+PUBLIC ssize mprWriteCacheBlock(MprCache *cache, cchar *key, cchar *value, ssize size, MprTime modified,
+    MprTicks lifespan, int64 version, int options)
+{
+    MprCacheShard   *shard;
+    CacheItem       *item;
+    MprKey          *kp;
+    ssize           len, oldLen;
+    int             exists, add, set, prepend, append, throw, event;
 
     assert(cache);
     assert(key && *key);
     assert(value);
+    assert(size >= 0);
 
     if (cache->shared) {
         cache = cache->shared;
@@ -5164,37 +5791,44 @@ PUBLIC ssize mprWriteCache(MprCache *cache, cchar *key, cchar *value, MprTime mo
     if ((add + append + prepend) == 0) {
         set = 1;
     }
-    lock(cache);
-    if ((kp = mprLookupKeyEntry(cache->store, key)) != 0) {
+    shard = getShard(cache, key);
+    lock(shard);
+    if ((kp = mprLookupKeyEntry(shard->store, key)) != 0) {
         exists++;
         item = (CacheItem*) kp->data;
         if (version) {
             if (item->version != version) {
-                unlock(cache);
+                unlock(shard);
                 return MPR_ERR_BAD_STATE;
             }
         }
     } else {
         if ((item = mprAllocObj(CacheItem, manageCacheItem)) == 0) {
-            unlock(cache);
+            unlock(shard);
             return 0;
         }
-        mprAddKey(cache->store, key, item);
+        mprAddKey(shard->store, key, item);
         item->key = sclone(key);
+        item->lifespan = cache->lifespan;
         set = 1;
     }
-    oldLen = (item->data) ? (slen(item->key) + slen(item->data)) : 0;
+    oldLen = (item->data) ? (slen(item->key) + item->length) : 0;
     if (set) {
-        item->data = sclone(value);
+        item->data = joinBlocks(value, size, NULL, 0);
+        item->length = size;
     } else if (add) {
         if (exists) {
+            unlock(shard);
             return 0;
         }
-        item->data = sclone(value);
+        item->data = joinBlocks(value, size, NULL, 0);
+        item->length = size;
     } else if (append) {
-        item->data = sjoin(item->data, value, NULL);
+        item->data = joinBlocks(item->data, item->length, value, size);
+        item->length += size;
     } else if (prepend) {
-        item->data = sjoin(value, item->data, NULL);
+        item->data = joinBlocks(value, size, item->data, item->length);
+        item->length += size;
     }
     if (lifespan >= 0) {
         item->lifespan = lifespan;
@@ -5203,13 +5837,9 @@ PUBLIC ssize mprWriteCache(MprCache *cache, cchar *key, cchar *value, MprTime mo
     item->lastAccessed = mprGetTicks();
     item->expires = item->lastAccessed + item->lifespan;
     item->version++;
-    len = slen(item->key) + slen(item->data);
-    cache->usedMem += (len - oldLen);
+    len = slen(item->key) + item->length;
+    shard->usedMem += (len - oldLen);
 
-    if (cache->timer == 0) {
-        cache->timer = mprCreateTimerEvent(MPR->dispatcher, "localCacheTimer", cache->resolution, pruneCache, cache,
-            MPR_EVENT_STATIC_DATA);
-    }
     if (cache->notify) {
         if (exists) {
             event = MPR_CACHE_NOTIFY_CREATE;
@@ -5218,16 +5848,21 @@ PUBLIC ssize mprWriteCache(MprCache *cache, cchar *key, cchar *value, MprTime mo
         }
         (cache->notify)(cache, item->key, item->data, event);
     }
-    unlock(cache);
+    unlock(shard);
+
+    if (!exists) {
+        startPruner(cache);
+    }
     return len;
 }
 
 
 PUBLIC void *mprGetCacheLink(MprCache *cache, cchar *key)
 {
-    CacheItem   *item;
-    MprKey      *kp;
-    void        *result;
+    MprCacheShard   *shard;
+    CacheItem       *item;
+    MprKey          *kp;
+    void            *result;
 
     assert(cache);
     assert(key && *key);
@@ -5237,20 +5872,22 @@ PUBLIC void *mprGetCacheLink(MprCache *cache, cchar *key)
         assert(cache == shared);
     }
     result = 0;
-    lock(cache);
-    if ((kp = mprLookupKeyEntry(cache->store, key)) != 0) {
+    shard = getShard(cache, key);
+    lock(shard);
+    if ((kp = mprLookupKeyEntry(shard->store, key)) != 0) {
         item = (CacheItem*) kp->data;
         result = item->link;
     }
-    unlock(cache);
+    unlock(shard);
     return result;
 }
 
 
 PUBLIC int mprSetCacheLink(MprCache *cache, cchar *key, void *link)
 {
-    CacheItem   *item;
-    MprKey      *kp;
+    MprCacheShard   *shard;
+    CacheItem       *item;
+    MprKey          *kp;
 
     assert(cache);
     assert(key && *key);
@@ -5259,43 +5896,66 @@ PUBLIC int mprSetCacheLink(MprCache *cache, cchar *key, void *link)
         cache = cache->shared;
         assert(cache == shared);
     }
-    lock(cache);
-    if ((kp = mprLookupKeyEntry(cache->store, key)) != 0) {
+    shard = getShard(cache, key);
+    lock(shard);
+    if ((kp = mprLookupKeyEntry(shard->store, key)) != 0) {
         item = (CacheItem*) kp->data;
         item->link = link;
     }
-    unlock(cache);
+    unlock(shard);
     return kp ? 0 : MPR_ERR_CANT_FIND;
 }
 
 
-static void removeItem(MprCache *cache, CacheItem *item)
+/*
+    Must be called with the shard locked
+ */
+static void removeItem(MprCache *cache, MprCacheShard *shard, CacheItem *item)
 {
     assert(cache);
     assert(item);
 
-    lock(cache);
     if (cache->notify) {
         (cache->notify)(cache, item->key, item->data, MPR_CACHE_NOTIFY_REMOVE);
     }
-    mprRemoveKey(cache->store, item->key);
-    cache->usedMem -= (slen(item->key) + slen(item->data));
-    unlock(cache);
+    mprRemoveKey(shard->store, item->key);
+    shard->usedMem -= (slen(item->key) + item->length);
+}
+
+
+/*
+    Start the pruner after adding a key. The pruner runs while any shard has keys.
+    Called after the shard is unlocked so the pruner can never miss a new key when it stops.
+ */
+static void startPruner(MprCache *cache)
+{
+    if (cache->timer == 0) {
+        lock(cache);
+        if (cache->timer == 0) {
+            cache->timer = mprCreateTimerEvent(MPR->dispatcher, "localCacheTimer", cache->resolution, pruneCache, cache,
+                MPR_EVENT_STATIC_DATA);
+        }
+        unlock(cache);
+    }
 }
 
 
+/*
+    Prune each shard in turn so that only one shard is locked at a time
+ */
 static void pruneCache(MprCache *cache, MprEvent *event)
 {
-    MprTicks        when, factor;
-    MprKey          *kp;
-    CacheItem       *item;
-    ssize           excessKeys;
+    MprCacheShard   *shard;
+    MprTicks        when;
+    ssize           count;
 
     if (!cache) {
         cache = shared;
         if (!cache) {
             return;
         }
+    } else if (cache->shared) {
+        cache = cache->shared;
     }
     if (event) {
         when = mprGetTicks();
@@ -5303,56 +5963,83 @@ static void pruneCache(MprCache *cache, MprEvent *event)
         /* Expire all items by setting event to NULL */
         when = MPR_MAX_TIMEOUT;
     }
-    if (mprTryLock(cache->mutex)) {
+    for (shard = cache->shards; shard < &cache->shards[cache->numShards]; shard++) {
+        if (mprTryLock(shard->mutex)) {
+            pruneShard(cache, shard, when);
+            unlock(shard);
+        }
+    }
+    if (event) {
         /*
-            Check for expired items
+            Writers add keys before starting the pruner under the cache lock, so a new key cannot be missed here
          */
-        for (kp = 0; (kp = mprGetNextKey(cache->store, kp)) != 0; ) {
-            item = (CacheItem*) kp->data;
-            if (item->expires && item->expires <= when) {
-                mprDebug("debug mpr cache", 5, "Prune expired key %s", kp->key);
-                removeItem(cache, item);
-            }
+        lock(cache);
+        count = 0;
+        for (shard = cache->shards; shard < &cache->shards[cache->numShards]; shard++) {
+            count += mprGetHashLength(shard->store);
         }
-        assert(cache->usedMem >= 0);
+        if (count == 0 && cache->timer) {
+            mprRemoveEvent(event);
+            cache->timer = 0;
+        }
+        unlock(cache);
+    }
+}
 
+
+/*
+    Prune expired items in a shard. The key and memory limits are divided evenly over the shards.
+    Must be called with the shard locked.
+ */
+static void pruneShard(MprCache *cache, MprCacheShard *shard, MprTicks when)
+{
+    MprTicks        factor;
+    MprKey          *kp;
+    CacheItem       *item;
+    ssize           excessKeys, maxKeys, maxMem;
+
+    /*
+        Check for expired items
+     */
+    for (kp = 0; (kp = mprGetNextKey(shard->store, kp)) != 0; ) {
+        item = (CacheItem*) kp->data;
+        if (item->expires && item->expires <= when) {
+            mprDebug("debug mpr cache", 5, "Prune expired key %s", kp->key);
+            removeItem(cache, shard, item);
+        }
+    }
+    assert(shard->usedMem >= 0);
+
+    /*
+        If too many keys or too much memory used, prune keys that expire soonest.
+     */
+    if (cache->maxKeys < MAXSSIZE || cache->maxMem < MAXSSIZE) {
+        maxKeys = (cache->maxKeys < MAXSSIZE) ? ((cache->maxKeys + cache->numShards - 1) / cache->numShards) : MAXSSIZE;
+        maxMem = (cache->maxMem < MAXSSIZE) ? ((cache->maxMem + cache->numShards - 1) / cache->numShards) : MAXSSIZE;
         /*
-            If too many keys or too much memory used, prune keys that expire soonest.
+            Look for those expiring in the next 5 minutes, then 20 mins, then 80 ...
          */
-        if (cache->maxKeys < MAXSSIZE || cache->maxMem < MAXSSIZE) {
-            /*
-                Look for those expiring in the next 5 minutes, then 20 mins, then 80 ...
-             */
-            excessKeys = mprGetHashLength(cache->store) - cache->maxKeys;
-            if (excessKeys < 0) {
-                excessKeys = 0;
-            }
-            factor = 5 * 60 * TPS;
-            when += factor;
-            while (excessKeys > 0 || cache->usedMem > cache->maxMem) {
-                for (kp = 0; (kp = mprGetNextKey(cache->store, kp)) != 0; ) {
-                    item = (CacheItem*) kp->data;
-                    if (item->expires && item->expires <= when) {
-                        mprDebug("debug mpr cache", 3, "Cache too big, execess keys %zd, mem %zd, prune key %s",
-                            excessKeys, (cache->maxMem - cache->usedMem), kp->key);
-                        removeItem(cache, item);
-                        excessKeys--;
-                    }
+        excessKeys = mprGetHashLength(shard->store) - maxKeys;
+        if (excessKeys < 0) {
+            excessKeys = 0;
+        }
+        factor = 5 * 60 * TPS;
+        when += factor;
+        while (excessKeys > 0 || shard->usedMem > maxMem) {
+            for (kp = 0; (kp = mprGetNextKey(shard->store, kp)) != 0; ) {
+                item = (CacheItem*) kp->data;
+                if (item->expires && item->expires <= when) {
+                    mprDebug("debug mpr cache", 3, "Cache too big, execess keys %zd, mem %zd, prune key %s",
+                        excessKeys, (maxMem - shard->usedMem), kp->key);
+                    removeItem(cache, shard, item);
+                    excessKeys--;
                 }
-                factor *= 4;
-                when += factor;
-            }
-        }
-        assert(cache->usedMem >= 0);
-
-        if (mprGetHashLength(cache->store) == 0) {
-            if (event) {
-                mprRemoveEvent(event);
-                cache->timer = 0;
             }
+            factor *= 4;
+            when += factor;
         }
-        unlock(cache);
     }
+    assert(shard->usedMem >= 0);
 }
 
 
@@ -5364,8 +6051,16 @@ PUBLIC void mprPruneCache(MprCache *cache)
 
 static void manageCache(MprCache *cache, int flags)
 {
+    MprCacheShard   *shard;
+
     if (flags & MPR_MANAGE_MARK) {
-        mprMark(cache->store);
+        if (cache->shards) {
+            mprMark(cache->shards);
+            for (shard = cache->shards; shard < &cache->shards[cache->numShards]; shard++) {
+                mprMark(shard->store);
+                mprMark(shard->mutex);
+            }
+        }
         mprMark(cache->mutex);
         mprMark(cache->timer);
         mprMark(cache->shared);
@@ -5390,11 +6085,22 @@ static void manageCacheItem(CacheItem *item, int flags)
 
 PUBLIC void mprGetCacheStats(MprCache *cache, int *numKeys, ssize *mem)
 {
+    MprCacheShard   *shard;
+    ssize           keys, used;
+
+    if (cache->shared) {
+        cache = cache->shared;
+    }
+    keys = used = 0;
+    for (shard = cache->shards; shard < &cache->shards[cache->numShards]; shard++) {
+        keys += mprGetHashLength(shard->store);
+        used += shard->usedMem;
+    }
     if (numKeys) {
-        *numKeys = mprGetHashLength(cache->store);
+        *numKeys = (int) keys;
     }
     if (mem) {
-        *mem = cache->usedMem;
+        *mem = used;
     }
 }
 
@@ -9486,10 +10192,12 @@ static int cygOpen(MprFileSystem *fs, cchar *path, int omode, int perms)
 
 /***************************** Forward Declarations ***************************/
 
-static MprDispatcher *createQhead(cchar *name);
+static MprEventService *createEventService(void);
+static MprDispatcher *createQhead(MprEventService *es, cchar *name);
 static void dequeueDispatcher(MprDispatcher *dispatcher);
 static int dispatchEvents(MprDispatcher *dispatcher);
 static void dispatchEventsWorker(MprDispatcher *dispatcher);
+static void eventLoopMain(MprEventService *es, MprThread *tp);
 static MprTicks getDispatcherIdleTicks(MprDispatcher *dispatcher, MprTicks timeout);
 static MprTicks getIdleTicks(MprEventService *es, MprTicks timeout);
 static MprDispatcher *getNextReadyDispatcher(MprEventService *es);
@@ -9497,6 +10205,7 @@ static void initDispatcher(MprDispatcher *q);
 static void manageDispatcher(MprDispatcher *dispatcher, int flags);
 static void manageEventService(MprEventService *es, int flags);
 static void queueDispatcher(MprDispatcher *prior, MprDispatcher *dispatcher);
+static void wakeEventService(MprEventService *es);
 
 #define isIdle(dispatcher) (dispatcher->parent == dispatcher->service->idleQ)
 #define isRunning(dispatcher) (dispatcher->parent == dispatcher->service->runQ)
@@ -9512,19 +10221,76 @@ PUBLIC MprEventService *mprCreateEventService()
 {
     MprEventService     *es;
 
-    if ((es = mprAllocObj(MprEventService, manageEventService)) == 0) {
+    if ((es = createEventService()) == 0) {
         return 0;
     }
     MPR->eventService = es;
+    return es;
+}
+
+
+static MprEventService *createEventService()
+{
+    MprEventService     *es;
+
+    if ((es = mprAllocObj(MprEventService, manageEventService)) == 0) {
+        return 0;
+    }
     es->now = mprGetTicks();
     es->mutex = mprCreateLock();
     es->waitCond = mprCreateCond();
-    es->runQ = createQhead("running");
-    es->readyQ = createQhead("ready");
-    es->idleQ = createQhead("idle");
-    es->pendingQ = createQhead("pending");
-    es->waitQ = createQhead("waiting");
+    es->runQ = createQhead(es, "running");
+    es->readyQ = createQhead(es, "ready");
+    es->idleQ = createQhead(es, "idle");
+    es->pendingQ = createQhead(es, "pending");
+    es->waitQ = createQhead(es, "waiting");
+    return es;
+}
+
+
+/*
+    Get (and create if required) an event loop. An event loop is an event service with a private wait service and a
+    dedicated thread that services both. Dispatchers created on the loop are only ever run by the loop thread.
+ */
+PUBLIC MprEventService *mprGetEventLoop(int index)
+{
+#if ME_EVENT_NOTIFIER == MPR_EVENT_ASYNC
+    return 0;
+#else
+    MprEventService     *es;
+    MprWaitService      *ws;
+    MprThread           *tp;
+    char                name[16];
+
+    if (index < 0) {
+        return 0;
+    }
+    mprGlobalLock();
+    if (MPR->eventLoops == 0) {
+        MPR->eventLoops = mprCreateList(0, 0);
+    }
+    while (mprGetListLength(MPR->eventLoops) <= index) {
+        if ((es = createEventService()) == 0 || (ws = mprCreateLoopWaitService(es)) == 0) {
+            mprGlobalUnlock();
+            return 0;
+        }
+        es->waitService = ws;
+        fmt(name, sizeof(name), "loop.%d", mprGetListLength(MPR->eventLoops));
+        if ((tp = mprCreateThread(name, eventLoopMain, es, 0)) == 0) {
+            mprGlobalUnlock();
+            return 0;
+        }
+        es->thread = tp;
+        mprAddItem(MPR->eventLoops, es);
+        if (mprStartThread(tp) < 0) {
+            mprGlobalUnlock();
+            return 0;
+        }
+    }
+    es = mprGetItem(MPR->eventLoops, index);
+    mprGlobalUnlock();
     return es;
+#endif
 }
 
 
@@ -9540,6 +10306,8 @@ static void manageEventService(MprEventService *es, int flags)
         mprMark(es->pendingQ);
         mprMark(es->waitCond);
         mprMark(es->mutex);
+        mprMark(es->waitService);
+        mprMark(es->thread);
 
         /*
             Special case: must lock because mprCreateEvent may queue events while marking
@@ -9582,7 +10350,20 @@ static void destroyDispatcherQueue(MprDispatcher *q)
 PUBLIC void mprStopEventService()
 {
     MprEventService     *es;
+    MprTicks            mark;
+    int                 next;
 
+    /*
+        Event loop threads exit once the MPR is destroying. Wake them and give them a moment to finish.
+     */
+    for (ITERATE_ITEMS(MPR->eventLoops, es, next)) {
+        mprWakeWaitService(es->waitService);
+    }
+    for (ITERATE_ITEMS(MPR->eventLoops, es, next)) {
+        for (mark = mprGetTicks(); es->serviceThread && mprGetElapsedTicks(mark) < MPR_TIMEOUT_NO_BUSY; ) {
+            mprNap(1);
+        }
+    }
     es = MPR->eventService;
     destroyDispatcherQueue(es->runQ);
     destroyDispatcherQueue(es->readyQ);
@@ -9599,14 +10380,14 @@ PUBLIC void mprSetDispatcherImmediate(MprDispatcher *dispatcher)
 }
 
 
-static MprDispatcher *createQhead(cchar *name)
+static MprDispatcher *createQhead(MprEventService *es, cchar *name)
 {
     MprDispatcher       *dispatcher;
 
     if ((dispatcher = mprAllocObj(MprDispatcher, manageDispatcher)) == 0) {
         return 0;
     }
-    dispatcher->service = MPR->eventService;
+    dispatcher->service = es;
     dispatcher->name = name;
     initDispatcher(dispatcher);
     return dispatcher;
@@ -9615,10 +10396,17 @@ static MprDispatcher *createQhead(cchar *name)
 
 PUBLIC MprDispatcher *mprCreateDispatcher(cchar *name, int flags)
 {
-    MprEventService     *es;
+    return mprCreateLoopDispatcher(NULL, name, flags);
+}
+
+
+PUBLIC MprDispatcher *mprCreateLoopDispatcher(MprEventService *es, cchar *name, int flags)
+{
     MprDispatcher       *dispatcher;
 
-    es = MPR->eventService;
+    if (es == 0) {
+        es = MPR->eventService;
+    }
     if ((dispatcher = mprAllocObj(MprDispatcher, manageDispatcher)) == 0) {
         return 0;
     }
@@ -9640,9 +10428,7 @@ PUBLIC void mprDestroyDispatcher(MprDispatcher *dispatcher)
 
     if (dispatcher) {
         es = dispatcher->service;
-        assert(es == MPR->eventService);
         lock(es);
-        assert(dispatcher->service == MPR->eventService);
         q = dispatcher->eventQ;
         if (q) {
             for (event = q->next; event != q; event = next) {
@@ -9770,6 +10556,39 @@ PUBLIC int mprServiceEvents(MprTicks timeout, int flags)
 }
 
 
+/*
+    Event loop thread. This services only the dispatchers created on this loop and runs their events inline on this
+    thread so a connection is never handed between threads. I/O is waited for on the loop's private wait service.
+ */
+static void eventLoopMain(MprEventService *es, MprThread *tp)
+{
+    MprDispatcher   *dp;
+    MprTicks        delay;
+    int             eventCount;
+
+    es->serviceThread = mprGetCurrentOsThread();
+    while (!mprIsDestroying()) {
+        es->now = mprGetTicks();
+        eventCount = es->eventCount;
+
+        while ((dp = getNextReadyDispatcher(es)) != NULL) {
+            assert(!isRunning(dp));
+            queueDispatcher(es->runQ, dp);
+            dispatchEventsWorker(dp);
+        }
+        if (es->eventCount == eventCount) {
+            lock(es);
+            delay = getIdleTicks(es, MPR_MAX_TIMEOUT);
+            es->willAwake = es->now + delay;
+            es->waiting = 1;
+            unlock(es);
+            mprWaitForIO(es->waitService, delay);
+        }
+    }
+    es->serviceThread = 0;
+}
+
+
 PUBLIC void mprSuspendThread(MprTicks timeout)
 {
     mprWaitForMultiCond(MPR->stopCond, timeout);
@@ -9814,7 +10633,7 @@ PUBLIC int mprWaitForEvent(MprDispatcher *dispatcher, MprTicks timeout, int64 ma
             return 0;
         }
     }
-    es = MPR->eventService;
+    es = dispatcher->service;
     es->now = mprGetTicks();
     expires = timeout < 0 ? MPR_MAX_TIMEOUT : (es->now + timeout);
     if (expires < 0) {
@@ -9893,8 +10712,14 @@ PUBLIC void mprClearWaiting()
 
 PUBLIC void mprWakeEventService()
 {
-    if (MPR->eventService->waiting) {
-        mprWakeNotifier();
+    wakeEventService(MPR->eventService);
+}
+
+
+static void wakeEventService(MprEventService *es)
+{
+    if (es->waiting) {
+        mprWakeWaitService(es->waitService ? es->waitService : MPR->waitService);
     }
 }
 
@@ -10016,7 +10841,7 @@ PUBLIC void mprScheduleDispatcher(MprDispatcher *dispatcher)
         mprSignalDispatcher(dispatcher);
     }
     if (mustWakeWaitService) {
-        mprWakeEventService();
+        wakeEventService(es);
     }
 }
 
@@ -10258,7 +11083,7 @@ static void initDispatcher(MprDispatcher *dispatcher)
 
 static void queueDispatcher(MprDispatcher *prior, MprDispatcher *dispatcher)
 {
-    assert(dispatcher->service == MPR->eventService);
+    assert(dispatcher->service == prior->service);
     lock(dispatcher->service);
 
     if (dispatcher->parent) {
@@ -10898,7 +11723,7 @@ PUBLIC void mprWaitForIO(MprWaitService *ws, MprTicks timeout)
             mprLog("error mpr event", 0, "epoll returned %d, errno %d", nevents, mprGetOsError());
         }
     }
-    mprClearWaiting();
+    ws->eventService->waiting = 0;
     mprResetYield();
 
     if (nevents > 0) {
@@ -10960,11 +11785,8 @@ static void serviceIO(MprWaitService *ws, struct epoll_event *events, int count)
     Wake the wait service. WARNING: This routine must not require locking. MprEvents in scheduleDispatcher depends on this.
     Must be async-safe.
  */
-PUBLIC void mprWakeNotifier()
+PUBLIC void mprWakeWaitService(MprWaitService *ws)
 {
-    MprWaitService  *ws;
-
-    ws = MPR->waitService;
     if (!ws->wakeRequested) {
         /*
             This code works for both eventfds and for pipes. We must write a value of 0x1 for eventfds.
@@ -12159,18 +12981,26 @@ static void manageHashTable(MprHash *hash, int flags);
     Can use hashSize -1, 0 to get a default hash.
  */
 PUBLIC MprHash *mprCreateHash(int hashSize, int flags)
+{
+    return mprCreateHashInArena(NULL, hashSize, flags);
+}
+
+
+PUBLIC MprHash *mprCreateHashInArena(MprArena *arena, int hashSize, int flags)
 {
     MprHash     *hash;
 
-    if ((hash = mprAllocObjNoZero(MprHash, manageHashTable)) == 0) {
+    if ((hash = mprArenaAllocMem(arena, sizeof(MprHash), MPR_ALLOC_MANAGER)) == 0) {
         return 0;
     }
+    mprSetManager(hash, (MprManager) manageHashTable);
     if (hashSize < ME_MAX_HASH) {
         hashSize = ME_MAX_HASH;
     }
-    if ((hash->buckets = mprAllocZeroed(sizeof(MprKey*) * hashSize)) == 0) {
+    if ((hash->buckets = mprArenaAllocMem(arena, sizeof(MprKey*) * hashSize, MPR_ALLOC_ZERO)) == 0) {
         return NULL;
     }
+    hash->arena = arena;
     hash->flags = flags | MPR_OBJ_HASH;
     hash->size = hashSize;
     hash->length = 0;
@@ -12207,6 +13037,7 @@ static void manageHashTable(MprHash *hash, int flags)
     if (flags & MPR_MANAGE_MARK) {
         mprMark(hash->mutex);
         mprMark(hash->buckets);
+        mprMark(hash->arena);
         lock(hash);
         for (i = 0; i < hash->size; i++) {
             for (sp = (MprKey*) hash->buckets[i]; sp; sp = sp->next) {
@@ -12259,7 +13090,7 @@ PUBLIC MprKey *mprAddKey(MprHash *hash, cvoid *key, cvoid *ptr)
     /*
         Hash entries are managed by manageHashTable
      */
-    if ((sp = mprAllocStructNoZero(MprKey)) == 0) {
+    if ((sp = mprArenaAllocMem(hash->arena, sizeof(MprKey), 0)) == 0) {
         unlock(hash);
         return 0;
     }
@@ -12315,7 +13146,7 @@ PUBLIC MprKey *mprAddDuplicateKey(MprHash *hash, cvoid *key, cvoid *ptr)
     assert(hash);
     assert(key);
 
-    if ((sp = mprAllocStructNoZero(MprKey)) == 0) {
+    if ((sp = mprArenaAllocMem(hash->arena, sizeof(MprKey), 0)) == 0) {
         return 0;
     }
     sp->type = 0;
@@ -12452,7 +13283,7 @@ static MprKey *lookupHash(int *bucketIndex, MprKey **prevSp, MprHash *hash, cvoi
     if (hash->length > hash->size) {
         hashSize = getHashSize(hash->length * 4 / 3);
         if (hash->size < hashSize) {
-            if ((buckets = mprAllocZeroed(sizeof(MprKey*) * hashSize)) != 0) {
+            if ((buckets = mprArenaAllocMem(hash->arena, sizeof(MprKey*) * hashSize, MPR_ALLOC_ZERO)) != 0) {
                 hash->length = 0;
                 for (i = 0; i < hash->size; i++) {
                     for (sp = hash->buckets[i]; sp; sp = next) {
@@ -12573,7 +13404,7 @@ static void *dupKey(MprHash *hash, cvoid *key)
         return wclone((wchar*) key);
     } else
 #endif
-        return sclone(key);
+        return mprArenaClone(hash->arena, key, -1);
 }
 
 
@@ -12677,7 +13508,12 @@ PUBLIC char *mprHashKeysToString(MprHash *hash, cchar *join)
 /*
     Remove matching properties
  */
-#define JSON_REMOVE     0x1
+#define JSON_REMOVE     0x1
+
+/*
+    Maximum nesting of packed JSON trees accepted by mprUnpackJson
+ */
+#define JSON_PACK_DEPTH 64
 
 /****************************** Forward Declarations **************************/
 
@@ -12688,6 +13524,9 @@ static int checkBlockCallback(MprJsonParser *parser, cchar *name, bool leave);
 static int gettok(MprJsonParser *parser);
 static MprJson *jsonParse(MprJsonParser *parser, MprJson *obj);
 static void jsonErrorCallback(MprJsonParser *parser, cchar *msg);
+static void packJson(MprBuf *buf, MprJson *obj);
+static void packNumber(MprBuf *buf, ssize value);
+static void packString(MprBuf *buf, cchar *str);
 static int peektok(MprJsonParser *parser);
 static void puttok(MprJsonParser *parser);
 static MprJson *queryCore(MprJson *obj, cchar *key, MprJson *value, int flags);
@@ -12696,6 +13535,9 @@ static MprJson *setProperty(MprJson *obj, cchar *name, MprJson *child);
 static void setValue(MprJson *obj, cchar *value, int type);
 static int setValueCallback(MprJsonParser *parser, MprJson *obj, cchar *name, MprJson *child);
 static void spaces(MprBuf *buf, int count);
+static MprJson *unpackJson(cchar **pos, cchar *end, int depth);
+static bool unpackNumber(cchar **pos, cchar *end, ssize *value);
+static bool unpackString(cchar **pos, cchar *end, cchar **str, ssize *len);
 
 /************************************ Code ************************************/
 
@@ -14440,6 +15282,237 @@ PUBLIC MprHash *mprJsonToHash(MprJson *json)
 }
 
 
+/*
+    Packed numbers are stored least significant first in 7-bit groups. The top bit is set on all but the last byte.
+ */
+static void packNumber(MprBuf *buf, ssize value)
+{
+    while (value >= 0x80) {
+        mprPutCharToBuf(buf, (int) ((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    mprPutCharToBuf(buf, (int) value);
+}
+
+
+/*
+    Packed strings are stored as the length plus one, the bytes and a trailing null. A zero length is a null string.
+ */
+static void packString(MprBuf *buf, cchar *str)
+{
+    ssize   len;
+
+    if (str == 0) {
+        mprPutCharToBuf(buf, 0);
+        return;
+    }
+    len = slen(str) + 1;
+    packNumber(buf, len);
+    mprPutBlockToBuf(buf, str, len);
+}
+
+
+static bool unpackNumber(cchar **pos, cchar *end, ssize *value)
+{
+    cuchar  *cp;
+    ssize   result;
+    int     shift;
+
+    result = 0;
+    for (cp = (cuchar*) *pos, shift = 0; cp < (cuchar*) end && shift < 35; cp++, shift += 7) {
+        result |= ((ssize) (*cp & 0x7f)) << shift;
+        if (!(*cp & 0x80)) {
+            *pos = (cchar*) cp + 1;
+            *value = result;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/*
+    Return a reference to a packed string. The length excludes the trailing null.
+ */
+static bool unpackString(cchar **pos, cchar *end, cchar **str, ssize *len)
+{
+    ssize   size;
+
+    if (!unpackNumber(pos, end, &size)) {
+        return 0;
+    }
+    if (size == 0) {
+        *str = 0;
+        *len = 0;
+        return 1;
+    }
+    if (size > (end - *pos) || (*pos)[size - 1] != '\0') {
+        return 0;
+    }
+    *str = *pos;
+    *len = size - 1;
+    *pos += size;
+    return 1;
+}
+
+
+PUBLIC ssize mprPackHash(MprBuf *buf, MprHash *hash)
+{
+    MprKey  *kp;
+    ssize   start;
+
+    assert(buf);
+
+    start = mprGetBufLength(buf);
+    mprPutCharToBuf(buf, MPR_PACK_HASH);
+    packNumber(buf, mprGetHashLength(hash));
+    for (ITERATE_KEYS(hash, kp)) {
+        packString(buf, kp->key);
+        packString(buf, kp->data);
+    }
+    return mprGetBufLength(buf) - start;
+}
+
+
+PUBLIC ssize mprUnpackHash(MprHash *hash, cchar *data, ssize len, int flags)
+{
+    cchar   *pos, *end, *key, *value;
+    ssize   count, keyLen, valueLen;
+
+    assert(hash);
+    assert(!(flags & MPR_PACK_REFERENCE) || (hash->flags & MPR_HASH_STATIC_ALL) == MPR_HASH_STATIC_ALL);
+
+    if (data == 0 || len < 2 || (uchar) data[0] != MPR_PACK_HASH) {
+        return MPR_ERR_BAD_FORMAT;
+    }
+    pos = &data[1];
+    end = &data[len];
+    /*
+        Each key and value requires at least two bytes
+     */
+    if (!unpackNumber(&pos, end, &count) || count > (end - pos) / 2) {
+        return MPR_ERR_BAD_FORMAT;
+    }
+    while (count-- > 0) {
+        if (!unpackString(&pos, end, &key, &keyLen) || key == 0 || !unpackString(&pos, end, &value, &valueLen)) {
+            return MPR_ERR_BAD_FORMAT;
+        }
+        if (!(flags & MPR_PACK_REFERENCE)) {
+            if (hash->flags & MPR_HASH_MANAGED_KEYS) {
+                key = mprMemdup(key, keyLen + 1);
+            }
+            if (value) {
+                value = mprMemdup(value, valueLen + 1);
+            }
+        }
+        if (mprAddKey(hash, key, value) == 0) {
+            return MPR_ERR_MEMORY;
+        }
+    }
+    return pos - data;
+}
+
+
+static void packJson(MprBuf *buf, MprJson *obj)
+{
+    MprJson     *child;
+    int         index;
+
+    packNumber(buf, obj->type);
+    packString(buf, obj->name);
+    if (obj->type & MPR_JSON_VALUE) {
+        packString(buf, obj->value);
+    } else {
+        packNumber(buf, obj->length);
+        for (ITERATE_JSON(obj, child, index)) {
+            packJson(buf, child);
+        }
+    }
+}
+
+
+PUBLIC ssize mprPackJson(MprBuf *buf, MprJson *obj)
+{
+    ssize   start;
+
+    assert(buf);
+    assert(obj);
+
+    start = mprGetBufLength(buf);
+    mprPutCharToBuf(buf, MPR_PACK_JSON);
+    packJson(buf, obj);
+    return mprGetBufLength(buf) - start;
+}
+
+
+/*
+    Children are linked directly rather than via setProperty as packed trees have no duplicate properties
+ */
+static MprJson *unpackJson(cchar **pos, cchar *end, int depth)
+{
+    MprJson     *obj, *child;
+    cchar       *name, *value;
+    ssize       type, count, len;
+
+    if (depth > JSON_PACK_DEPTH || !unpackNumber(pos, end, &type) || !unpackString(pos, end, &name, &len)) {
+        return 0;
+    }
+    if ((obj = mprAllocObj(MprJson, manageJson)) == 0) {
+        return 0;
+    }
+    obj->type = (int) type;
+    obj->name = name ? mprMemdup(name, len + 1) : 0;
+    if (type & MPR_JSON_VALUE) {
+        if (!unpackString(pos, end, &value, &len)) {
+            return 0;
+        }
+        obj->value = value ? mprMemdup(value, len + 1) : 0;
+    } else {
+        /*
+            Each child requires at least three bytes
+         */
+        if (!unpackNumber(pos, end, &count) || count > (end - *pos) / 3) {
+            return 0;
+        }
+        while (count-- > 0) {
+            if ((child = unpackJson(pos, end, depth + 1)) == 0) {
+                return 0;
+            }
+            if (obj->children) {
+                child->prev = obj->children->prev;
+                child->next = obj->children;
+                obj->children->prev->next = child;
+                obj->children->prev = child;
+            } else {
+                child->next = child->prev = child;
+                obj->children = child;
+            }
+            obj->length++;
+        }
+    }
+    return obj;
+}
+
+
+PUBLIC MprJson *mprUnpackJson(cchar *data, ssize len, ssize *used)
+{
+    MprJson     *obj;
+    cchar       *pos;
+
+    if (data == 0 || len < 2 || (uchar) data[0] != MPR_PACK_JSON) {
+        return 0;
+    }
+    pos = &data[1];
+    if ((obj = unpackJson(&pos, &data[len], 0)) == 0) {
+        return 0;
+    }
+    if (used) {
+        *used = pos - data;
+    }
+    return obj;
+}
+
+
 PUBLIC int mprWriteJson(MprJson *obj, cchar *key, cchar *value, int type)
 {
     if (setProperty(obj, sclone(key), mprCreateJsonValue(value, type)) == 0) {
@@ -14657,7 +15730,7 @@ PUBLIC void mprWaitForIO(MprWaitService *ws, MprTicks timeout)
             mprLog("error mpr event", 0, "Kevent returned %d, errno %d", nevents, mprGetOsError());
         }
     }
-    mprClearWaiting();
+    ws->eventService->waiting = 0;
     mprResetYield();
 
     if (nevents > 0) {
@@ -14735,12 +15808,10 @@ static void serviceIO(MprWaitService *ws, struct kevent *events, int count)
     Wake the wait service. WARNING: This routine must not require locking. MprEvents in scheduleDispatcher depends on this.
     Must be async-safe.
  */
-PUBLIC void mprWakeNotifier()
+PUBLIC void mprWakeWaitService(MprWaitService *ws)
 {
-    MprWaitService  *ws;
     struct kevent   ev;
 
-    ws = MPR->waitService;
     if (!ws->wakeRequested) {
         ws->wakeRequested = 1;
         EV_SET(&ev, 0, EVFILT_USER, 0, NOTE_TRIGGER, 0, NULL);
@@ -21189,7 +22260,9 @@ PUBLIC int mprNotifyOn(MprWaitHandler *wp, int mask)
             ws->highestFd = hd;
         }
     }
-    mprWakeEventService();
+    if (ws->eventService->waiting) {
+        mprWakeWaitService(ws);
+    }
     unlock(ws);
     return 0;
 }
@@ -21275,7 +22348,7 @@ PUBLIC void mprWaitForIO(MprWaitService *ws, MprTicks timeout)
 
     mprYield(MPR_YIELD_STICKY);
     rc = select(maxfd, &readMask, &writeMask, NULL, &tval);
-    mprClearWaiting();
+    ws->eventService->waiting = 0;
     mprResetYield();
 
     if (rc > 0) {
@@ -21331,13 +22404,11 @@ static void serviceIO(MprWaitService *ws, fd_set *readMask, fd_set *writeMask, i
     Wake the wait service. WARNING: This routine must not require locking. MprEvents in scheduleDispatcher depends on this.
     Must be async-safe.
  */
-PUBLIC void mprWakeNotifier()
+PUBLIC void mprWakeWaitService(MprWaitService *ws)
 {
-    MprWaitService  *ws;
     ssize           rc;
     int             c;
 
-    ws = MPR->waitService;
     if (!ws->wakeRequested) {
         ws->wakeRequested = 1;
         c = 0;
@@ -21798,6 +22869,7 @@ static void manageSsl(MprSsl *ssl, int flags);
 static ssize readSocket(MprSocket *sp, void *buf, ssize bufsize);
 static char *socketState(MprSocket *sp);
 static ssize writeSocket(MprSocket *sp, cvoid *buf, ssize bufsize);
+static ssize writeSocketVector(MprSocket *sp, MprIOVec *iovec, int count);
 
 /************************************ Code ************************************/
 /*
@@ -21953,6 +23025,8 @@ PUBLIC MprSocket *mprCloneSocket(MprSocket *sp)
     newsp->listenSock = sp->listenSock;
     newsp->sslSocket = sp->sslSocket;
     newsp->ssl = sp->ssl;
+    newsp->writeBuf = sp->writeBuf;
+    newsp->writePending = sp->writePending;
     newsp->mutex = mprCreateLock();
     return newsp;
 }
@@ -21976,6 +23050,7 @@ static void manageSocket(MprSocket *sp, int flags)
         mprMark(sp->sslSocket);
         mprMark(sp->service);
         mprMark(sp->session);
+        mprMark(sp->writeBuf);
 
     } else if (flags & MPR_MANAGE_FREE) {
         if (sp->fd != INVALID_SOCKET) {
@@ -22051,7 +23126,7 @@ PUBLIC Socket mprListenOnSocket(MprSocket *sp, cchar *ip, int port, int flags)
     sp->fd = INVALID_SOCKET;
     sp->port = port;
     sp->flags = (flags & (MPR_SOCKET_BROADCAST | MPR_SOCKET_DATAGRAM | MPR_SOCKET_BLOCK |
-         MPR_SOCKET_NOREUSE | MPR_SOCKET_NODELAY | MPR_SOCKET_THREAD));
+         MPR_SOCKET_NOREUSE | MPR_SOCKET_NODELAY | MPR_SOCKET_THREAD | MPR_SOCKET_REUSEPORT));
     datagram = sp->flags & MPR_SOCKET_DATAGRAM;
 
     /*
@@ -22083,12 +23158,17 @@ PUBLIC Socket mprListenOnSocket(MprSocket *sp, cchar *ip, int port, int flags)
         if (setsockopt(sp->fd, SOL_SOCKET, SO_REUSEADDR, (char*) &enable, sizeof(enable)) != 0) {
             mprLog("error mpr socket", 3, "Cannot set reuseaddr, errno %d", errno);
         }
-#if defined(SO_REUSEPORT) && MULTIPLE_SERVERS
+#if defined(SO_REUSEPORT)
+#if MULTIPLE_SERVERS
+        sp->flags |= MPR_SOCKET_REUSEPORT;
+#endif
         /*
-            This permits multiple servers listening on the same endpoint
+            This permits multiple sockets (servers or event loops) listening on the same endpoint
          */
-        if (setsockopt(sp->fd, SOL_SOCKET, SO_REUSEPORT, (char*) &enable, sizeof(enable)) != 0) {
-            mprLog("error mpr socket", 3, "Cannot set reuseport, errno %d", errno);
+        if (sp->flags & MPR_SOCKET_REUSEPORT) {
+            if (setsockopt(sp->fd, SOL_SOCKET, SO_REUSEPORT, (char*) &enable, sizeof(enable)) != 0) {
+                mprLog("error mpr socket", 3, "Cannot set reuseport, errno %d", errno);
+            }
         }
 #endif
 #elif ME_WIN_LIKE && defined(SO_EXCLUSIVEADDRUSE)
@@ -22734,46 +23814,78 @@ PUBLIC ssize mprWriteSocketString(MprSocket *sp, cchar *str)
 
 PUBLIC ssize mprWriteSocketVector(MprSocket *sp, MprIOVec *iovec, int count)
 {
-    char        *start;
-    ssize       total, len, written;
-    int         i;
-
 #if ME_UNIX_LIKE
     if (sp->sslSocket == 0) {
         return writev(sp->fd, (const struct iovec*) iovec, (int) count);
-    } else
+    }
 #endif
-    {
-        //  OPT - better to buffer and have fewer raw writes
-        if (count <= 0) {
-            return 0;
-        }
-        start = iovec[0].start;
-        len = (int) iovec[0].len;
-        assert(len > 0);
+    return writeSocketVector(sp, iovec, count);
+}
 
-        for (total = i = 0; i < count; ) {
-            written = mprWriteSocket(sp, start, len);
-            if (written < 0) {
-                if (total > 0) {
-                    break;
-                }
-                return written;
-            } else if (written == 0) {
+
+/*
+    Write a vector via the socket provider. Used for secure sockets where each provider write creates one or more
+    TLS records. Small fragments are coalesced into a per-socket buffer so each write emits a full sized record.
+    Each block is written with one provider write. If the block is not fully written, the TLS stack requires the
+    retry to use the same data. So the remaining block length is saved and the next call rebuilds exactly that
+    block from the (unchanged) head of the vector.
+ */
+static ssize writeSocketVector(MprSocket *sp, MprIOVec *iovec, int count)
+{
+    char        *block;
+    ssize       total, len, want, written, offset, skip, n;
+    int         i, j;
+
+    total = 0;
+    offset = 0;
+
+    for (i = 0; i < count; ) {
+        if (offset >= iovec[i].len) {
+            i++;
+            offset = 0;
+            continue;
+        }
+        want = sp->writePending ? sp->writePending : ME_MPR_SSL_RECORD_SIZE;
+        len = iovec[i].len - offset;
+        if (len >= want) {
+            /* Enough data in this fragment to write a full block without copying */
+            block = &iovec[i].start[offset];
+            len = want;
+        } else {
+            if (sp->writeBuf == 0 && (sp->writeBuf = mprAlloc(ME_MPR_SSL_RECORD_SIZE)) == 0) {
+                return MPR_ERR_MEMORY;
+            }
+            block = sp->writeBuf;
+            for (len = 0, j = i; j < count && len < want; j++) {
+                skip = (j == i) ? offset : 0;
+                n = min(iovec[j].len - skip, want - len);
+                memcpy(&block[len], &iovec[j].start[skip], n);
+                len += n;
+            }
+        }
+        sp->writePending = 0;
+        written = mprWriteSocket(sp, block, len);
+        if (written < len) {
+            sp->writePending = len - max(written, 0);
+        }
+        if (written <= 0) {
+            if (total > 0 || written == 0) {
                 break;
-            } else {
-                len -= written;
-                start += written;
-                total += written;
-                if (len <= 0) {
-                    i++;
-                    start = iovec[i].start;
-                    len = (int) iovec[i].len;
-                }
             }
+            return written;
+        }
+        total += written;
+        /*
+            Advance past the written data
+         */
+        for (offset += written; i < count && offset >= iovec[i].len; i++) {
+            offset -= iovec[i].len;
+        }
+        if (written < len) {
+            break;
         }
-        return total;
     }
+    return total;
 }
 
 
@@ -23596,6 +24708,51 @@ PUBLIC int mprLoadSsl()
 }
 
 
+static MprSocketProvider *getCryptProvider()
+{
+    MprSocketService    *ss;
+
+    ss = MPR->socketService;
+    if (!ss->loaded && mprLoadSsl() < 0) {
+        return 0;
+    }
+    if (!ss->sslProvider || !ss->sslProvider->cryptData) {
+        return 0;
+    }
+    return ss->sslProvider;
+}
+
+
+PUBLIC int mprSealData(cuchar *key, cuchar *nonce, cuchar *aad, ssize aadLen, cuchar *input, ssize len, uchar *output,
+    uchar *tag)
+{
+    MprSocketProvider   *provider;
+
+    assert(key && nonce && tag);
+    assert(len >= 0);
+
+    if ((provider = getCryptProvider()) == 0) {
+        return MPR_ERR_NOT_READY;
+    }
+    return provider->cryptData(1, key, nonce, aad, aadLen, input, len, output, tag);
+}
+
+
+PUBLIC int mprOpenData(cuchar *key, cuchar *nonce, cuchar *aad, ssize aadLen, cuchar *input, ssize len, uchar *output,
+    cuchar *tag)
+{
+    MprSocketProvider   *provider;
+
+    assert(key && nonce && tag);
+    assert(len >= 0);
+
+    if ((provider = getCryptProvider()) == 0) {
+        return MPR_ERR_NOT_READY;
+    }
+    return provider->cryptData(0, key, nonce, aad, aadLen, input, len, output, (uchar*) tag);
+}
+
+
 PUBLIC int mprUpgradeSocket(MprSocket *sp, MprSsl *ssl, cchar *peerName)
 {
     MprSocketService    *ss;
@@ -24968,6 +26125,7 @@ PUBLIC MprThreadService *mprCreateThreadService()
     }
     ts->mainThread->isMain = 1;
     ts->mainThread->osThread = mprGetCurrentOsThread();
+    mprBindAllocCache(ts->mainThread);
     return ts;
 }
 
@@ -25142,7 +26300,9 @@ static void threadProc(MprThread *tp)
 #else
     tp->pid = getpid();
 #endif
+    mprBindAllocCache(tp);
     (tp->entry)(tp->data, tp);
+    mprReleaseAllocCache(tp);
     mprRemoveItem(MPR->threadService->threads, tp);
     tp->pid = 0;
 }
@@ -28069,6 +29229,7 @@ void vxworksDummy() {}
 
 /***************************** Forward Declarations ***************************/
 
+static MprWaitService *createWaitService(MprEventService *es);
 static void ioEvent(void *data, MprEvent *event);
 static void manageWaitService(MprWaitService *ws, int flags);
 static void manageWaitHandler(MprWaitHandler *wp, int flags);
@@ -28081,15 +29242,44 @@ PUBLIC MprWaitService *mprCreateWaitService()
 {
     MprWaitService  *ws;
 
+    if ((ws = createWaitService(MPR->eventService)) == 0) {
+        return 0;
+    }
+    MPR->waitService = ws;
+    mprCreateNotifierService(ws);
+    return ws;
+}
+
+
+/*
+    Create a private wait service for an event loop
+ */
+PUBLIC MprWaitService *mprCreateLoopWaitService(MprEventService *es)
+{
+    MprWaitService  *ws;
+
+    if ((ws = createWaitService(es)) == 0) {
+        return 0;
+    }
+    if (mprCreateNotifierService(ws) < 0) {
+        return 0;
+    }
+    return ws;
+}
+
+
+static MprWaitService *createWaitService(MprEventService *es)
+{
+    MprWaitService  *ws;
+
     ws = mprAllocObj(MprWaitService, manageWaitService);
     if (ws == 0) {
         return 0;
     }
-    MPR->waitService = ws;
+    ws->eventService = es;
     ws->handlers = mprCreateList(-1, 0);
     ws->mutex = mprCreateLock();
     ws->spin = mprCreateSpinLock();
-    mprCreateNotifierService(ws);
     return ws;
 }
 
@@ -28101,6 +29291,7 @@ static void manageWaitService(MprWaitService *ws, int flags)
         mprMark(ws->handlerMap);
         mprMark(ws->mutex);
         mprMark(ws->spin);
+        mprMark(ws->eventService);
     }
 #if ME_EVENT_NOTIFIER == MPR_EVENT_ASYNC
     mprManageAsync(ws, flags);
@@ -28138,7 +29329,14 @@ static MprWaitHandler *initWaitHandler(MprWaitHandler *wp, int fd, int mask, Mpr
     MprWaitService  *ws;
 
     assert(fd >= 0);
-    ws = MPR->waitService;
+    /*
+        Handlers for dispatchers on an event loop use the loop's private wait service
+     */
+    if (dispatcher && dispatcher->service->waitService) {
+        ws = dispatcher->service->waitService;
+    } else {
+        ws = MPR->waitService;
+    }
 
 #if ME_DEBUG
     {
@@ -28253,7 +29451,7 @@ PUBLIC void mprQueueIOEvent(MprWaitHandler *wp)
     MprEvent        *event;
 
     if (wp->flags & MPR_WAIT_NEW_DISPATCHER) {
-        dispatcher = mprCreateDispatcher("IO", MPR_DISPATCHER_AUTO);
+        dispatcher = mprCreateLoopDispatcher(wp->service->eventService, "IO", MPR_DISPATCHER_AUTO);
     } else if (wp->dispatcher) {
         dispatcher = wp->dispatcher;
     } else {
@@ -28326,18 +29524,33 @@ PUBLIC void mprRecallWaitHandler(MprWaitHandler *wp)
     MprWaitService  *ws;
 
     if (wp) {
-        ws = MPR->waitService;
+        ws = wp->service ? wp->service : MPR->waitService;
         if (ws) {
             lock(ws);
             wp->flags |= MPR_WAIT_RECALL_HANDLER;
             ws->needRecall = 1;
-            mprWakeEventService();
+            if (ws == MPR->waitService) {
+                mprWakeEventService();
+            } else {
+                mprWakeWaitService(ws);
+            }
             unlock(ws);
         }
     }
 }
 
 
+/*
+    Wake the primary wait service
+ */
+PUBLIC void mprWakeNotifier()
+{
+    if (MPR->waitService) {
+        mprWakeWaitService(MPR->waitService);
+    }
+}
+
+
 /*
     Recall a handler which may have buffered data. Only called by notifiers.
  */
@@ -14,11 +14,6 @@ static void manageNet(HttpNet *net, int flags);
 static void netTimeout(HttpNet *net, MprEvent *mprEvent);
 static void secureNet(HttpNet *net, MprSsl *ssl, cchar *peerName);
 
-#if ME_HTTP_HTTP2
-static HttpHeaderTable *createHeaderTable(int maxSize);
-static void manageHeaderTable(HttpHeaderTable *table, int flags);
-#endif
-
 /*********************************** Code *************************************/
 
 PUBLIC HttpNet *httpCreateNet(MprDispatcher *dispatcher, HttpEndpoint *endpoint, int protocol, int flags)
@@ -71,8 +66,8 @@ PUBLIC HttpNet *httpCreateNet(MprDispatcher *dispatcher, HttpEndpoint *endpoint,
      */
     ssize packetSize = max(HTTP2_MIN_FRAME_SIZE + HTTP2_FRAME_OVERHEAD, net->limits->packetSize);
     httpSetQueueLimits(net->socketq, net->limits, packetSize, -1, -1, -1);
-    net->rxHeaders = createHeaderTable(HTTP2_TABLE_SIZE);
-    net->txHeaders = createHeaderTable(HTTP2_TABLE_SIZE);
+    net->rxHeaders = httpCreatePackedHeaderTable(HTTP2_TABLE_SIZE);
+    net->txHeaders = httpCreatePackedHeaderTable(HTTP2_TABLE_SIZE);
 }
 #endif
 
@@ -119,6 +114,13 @@ PUBLIC void httpDestroyNet(HttpNet *net)
                 next--;
             }
             httpMonitorNetEvent(net, HTTP_COUNTER_ACTIVE_CONNECTIONS, -1);
+        } else {
+            /*
+                Client streams may outlive the network, but must not remain on the timer wheel
+             */
+            for (ITERATE_ITEMS(net->streams, stream, next)) {
+                httpCancelTimeout(&stream->wheelEntry);
+            }
         }
         httpRemoveNet(net);
         if (net->sock) {
@@ -297,37 +299,17 @@ PUBLIC void httpNetClosed(HttpNet *net)
 }
 
 
-#if ME_HTTP_HTTP2
-static HttpHeaderTable *createHeaderTable(int maxsize)
-{
-    HttpHeaderTable     *table;
-
-    table = mprAllocObj(HttpHeaderTable, manageHeaderTable);
-    table->list = mprCreateList(256, 0);
-    table->size = 0;
-    table->max = maxsize;
-    return table;
-}
-
-
-static void manageHeaderTable(HttpHeaderTable *table, int flags)
-{
-    if (flags & MPR_MANAGE_MARK) {
-        mprMark(table->list);
-    }
-}
-#endif
-
-
 PUBLIC void httpAddStream(HttpNet *net, HttpStream *stream)
 {
     mprAddItem(net->streams, stream);
     stream->net = net;
+    httpScheduleStreamTimeout(stream);
 }
 
 
 PUBLIC void httpRemoveStream(HttpNet *net, HttpStream *stream)
 {
+    httpCancelTimeout(&stream->wheelEntry);
     mprRemoveItem(net->streams, stream);
 }
 
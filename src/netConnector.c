@@ -2,7 +2,8 @@
     netConnector.c -- General network connector.
 
     The Network connector handles I/O from upstream handlers and filters. It uses vectored writes to
-    aggregate output packets into fewer actual I/O requests to the O/S.
+    aggregate output packets into fewer actual I/O requests to the O/S. Unfilled entity packets from the
+    fileHandler are sent directly from the file via sendfile() with surrounding packet data written before and after.
 
     Copyright (c) All Rights Reserved. See details at the end of the file.
  */
@@ -19,6 +20,7 @@ static void adjustNetVec(HttpQueue *q, ssize written);
 static MprOff buildNetVec(HttpQueue *q);
 static void freeNetPackets(HttpQueue *q, ssize written);
 static HttpPacket *getPacket(HttpNet *net, ssize *size);
+static ssize sendNetFile(HttpQueue *q);
 static void netOutgoing(HttpQueue *q, HttpPacket *packet);
 static void netOutgoingService(HttpQueue *q);
 static HttpPacket *readPacket(HttpNet *net);
@@ -124,6 +126,9 @@ PUBLIC void httpIOEvent(HttpNet *net, MprEvent *event)
     }
     net->lastActivity = net->http->now;
     if (event->mask & MPR_WRITABLE) {
+#if ME_HTTP_HTTP2
+        net->ioWritten = 0;
+#endif
         httpResumeQueue(net->socketq);
         httpScheduleQueue(net->socketq);
     }
@@ -305,7 +310,10 @@ PUBLIC int httpGetNetEventMask(HttpNet *net)
             eventMask |= MPR_WRITABLE;
         }
     }
-    if (mprSocketHasBufferedRead(sock) || !net->inputq || (net->inputq->count < net->inputq->max)) {
+    /*
+        Reading is suspended while readBlocked. The consumer of the input (proxy) clears it and re-enables events.
+     */
+    if (!net->readBlocked && (mprSocketHasBufferedRead(sock) || !net->inputq || (net->inputq->count < net->inputq->max))) {
         /*
             TODO - how to mitigate against a ping flood?
             Was testing if !writeBlocked before adding MPR_READABLE, but this is always required for HTTP/2 to read window frames.
@@ -399,11 +407,24 @@ static void netOutgoingService(HttpQueue *q)
     net->writeBlocked = 0;
 
     while (q->first || q->ioIndex) {
+#if ME_HTTP_HTTP2
+        if (net->protocol >= 2 && net->ioWritten >= ME_HTTP_WRITE_BUDGET) {
+            /*
+                Return to the event loop so new frames can be read and scheduled alongside the current streams
+             */
+            net->writeBlocked = 1;
+            break;
+        }
+#endif
         if (q->ioIndex == 0 && buildNetVec(q) <= 0) {
             freeNetPackets(q, 0);
             break;
         }
-        written = mprWriteSocketVector(net->sock, q->iovec, q->ioIndex);
+        if (q->ioFile) {
+            written = sendNetFile(q);
+        } else {
+            written = mprWriteSocketVector(net->sock, q->iovec, q->ioIndex);
+        }
         if (written < 0) {
             errCode = mprGetError();
             if (errCode == EAGAIN || errCode == EWOULDBLOCK) {
@@ -421,11 +442,18 @@ static void netOutgoingService(HttpQueue *q)
             break;
 
         } else if (written > 0) {
+#if ME_HTTP_HTTP2
+            net->ioWritten += written;
+#endif
             freeNetPackets(q, written);
             adjustNetVec(q, written);
 
         } else {
             /* Socket full or SSL negotiate */
+            if (q->ioFile) {
+                /* Sendfile returns zero rather than EAGAIN when the socket is full */
+                net->writeBlocked = 1;
+            }
             break;
         }
     }
@@ -450,7 +478,14 @@ static MprOff buildNetVec(HttpQueue *q)
         if (q->ioIndex >= (ME_MAX_IOVEC - 2)) {
             break;
         }
-        if (httpGetPacketLength(packet) > 0 || packet->prefix) {
+        if (packet->esize > 0 && q->ioFile) {
+            /* Only one file segment per write. Data up to the next file segment is written after the file data */
+            if (packet->prefix && mprGetBufLength(packet->prefix) > 0) {
+                addToNetVector(q, mprGetBufStart(packet->prefix), mprGetBufLength(packet->prefix));
+            }
+            break;
+        }
+        if (httpGetPacketLength(packet) > 0 || packet->prefix || packet->esize > 0) {
             addPacketForNet(q, packet);
         }
     }
@@ -469,11 +504,18 @@ static void addPacketForNet(HttpQueue *q, HttpPacket *packet)
     assert(q->count >= 0);
     assert(q->ioIndex < (ME_MAX_IOVEC - 2));
 
-    net->bytesWritten += httpGetPacketLength(packet);
+    net->bytesWritten += httpGetPacketEntityLength(packet);
     if (packet->prefix && mprGetBufLength(packet->prefix) > 0) {
         addToNetVector(q, mprGetBufStart(packet->prefix), mprGetBufLength(packet->prefix));
     }
-    if (packet->content && mprGetBufLength(packet->content) > 0) {
+    if (packet->esize > 0) {
+        /*
+            Entity packet that has not been filled. Add a placeholder entry (null start) for the file data.
+         */
+        addToNetVector(q, NULL, (ssize) packet->esize);
+        q->ioFile = 1;
+
+    } else if (packet->content && mprGetBufLength(packet->content) > 0) {
         addToNetVector(q, mprGetBufStart(packet->content), mprGetBufLength(packet->content));
     }
 }
@@ -493,6 +535,30 @@ static void addToNetVector(HttpQueue *q, char *ptr, ssize bytes)
 }
 
 
+/*
+    Write the I/O vector using sendfile. Entries before the file placeholder are written first, then the file data,
+    then the entries after the placeholder. The file position is the current position of the first entity packet.
+ */
+static ssize sendNetFile(HttpQueue *q)
+{
+    HttpPacket  *packet;
+    HttpStream  *stream;
+    MprIOVec    *iovec;
+    int         i;
+
+    for (packet = q->first; packet && packet->esize == 0; packet = packet->next) { }
+    if (!packet || (stream = packet->stream) == 0 || !stream->tx || !stream->tx->file) {
+        mprSetError(EBADF);
+        return MPR_ERR_BAD_STATE;
+    }
+    iovec = q->iovec;
+    for (i = 0; i < q->ioIndex && iovec[i].start; i++) { }
+    assert(i < q->ioIndex);
+    return (ssize) mprSendFileToSocket(q->net->sock, stream->tx->file, packet->epos, q->ioCount,
+        iovec, i, &iovec[i + 1], q->ioIndex - i - 1);
+}
+
+
 static void freeNetPackets(HttpQueue *q, ssize bytes)
 {
     HttpPacket  *packet;
@@ -520,7 +586,14 @@ static void freeNetPackets(HttpQueue *q, ssize bytes)
                     packet->prefix = 0;
                 }
             }
-            if (packet->content) {
+            if (packet->esize > 0) {
+                /* Entity data sent from the file. Entity packets don't count in the q->count */
+                len = (ssize) min(packet->esize, bytes);
+                packet->epos += len;
+                packet->esize -= len;
+                bytes -= len;
+
+            } else if (packet->content) {
                 len = mprGetBufLength(packet->content);
                 len = min(len, bytes);
                 mprAdjustBufStart(packet->content, len);
@@ -529,7 +602,7 @@ static void freeNetPackets(HttpQueue *q, ssize bytes)
                 assert(q->count >= 0);
             }
         }
-        if (httpGetPacketLength(packet) == 0 && !packet->prefix) {
+        if (httpGetPacketLength(packet) == 0 && packet->esize == 0 && !packet->prefix) {
             /* Done with this packet - consume it. Important for flow control. */
             httpGetPacket(q);
         } else {
@@ -558,6 +631,7 @@ static void adjustNetVec(HttpQueue *q, ssize written)
          */
         q->ioIndex = 0;
         q->ioCount = 0;
+        q->ioFile = 0;
 
     } else {
         /*
@@ -569,7 +643,9 @@ static void adjustNetVec(HttpQueue *q, ssize written)
         for (i = 0; i < q->ioIndex; i++) {
             len = iovec[i].len;
             if (written < len) {
-                iovec[i].start += written;
+                if (iovec[i].start) {
+                    iovec[i].start += written;
+                }
                 iovec[i].len -= written;
                 break;
             } else {
@@ -579,7 +655,11 @@ static void adjustNetVec(HttpQueue *q, ssize written)
         /*
             Compact the vector
          */
+        q->ioFile = 0;
         for (j = 0; i < q->ioIndex; ) {
+            if (iovec[i].start == 0) {
+                q->ioFile = 1;
+            }
             iovec[j++] = iovec[i++];
         }
         q->ioIndex = j;
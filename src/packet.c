@@ -177,16 +177,22 @@ PUBLIC HttpPacket *httpGetPacket(HttpQueue *q)
 }
 
 
+/*
+    Remove a packet from anywhere in the queue. Prev is the preceding packet or null if the packet is first.
+ */
 PUBLIC void httpRemovePacket(HttpQueue *q, HttpPacket *prev, HttpPacket *packet)
 {
-    prev->next = packet->next;
-    if (q->last == packet) {
-        q->last = 0;
+    if (prev) {
+        prev->next = packet->next;
+    } else {
+        q->first = packet->next;
     }
-    if (q->first == packet) {
-        q->first = 0;
+    if (q->last == packet) {
+        q->last = prev;
     }
+    packet->next = 0;
     q->count -= httpGetPacketLength(packet);
+    assert(q->count >= 0);
 }
 
 
@@ -288,6 +294,10 @@ PUBLIC void httpJoinPackets(HttpQueue *q, ssize size)
          */
         count = 0;
         for (p = q->first; p; p = p->next) {
+            if (p->esize) {
+                /* Unfilled entity packets cannot be joined */
+                break;
+            }
             if (!(p->flags & HTTP_PACKET_HEADER)) {
                 count += httpGetPacketLength(p);
             }
@@ -310,7 +320,7 @@ PUBLIC void httpJoinPackets(HttpQueue *q, ssize size)
         /*
             Copy the data and free all other packets
          */
-        for (p = packet->next; p && (p->flags & HTTP_PACKET_DATA); p = p->next) {
+        for (p = packet->next; p && (p->flags & HTTP_PACKET_DATA) && p->esize == 0; p = p->next) {
             if ((len = httpGetPacketLength(p)) > 0) {
                 httpJoinPacket(packet, p);
             }
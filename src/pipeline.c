@@ -66,12 +66,10 @@ PUBLIC void httpCreateRxPipeline(HttpStream *stream, HttpRoute *route)
         q->flags |= HTTP_QUEUE_REQUEST;
     }
     stream->readq = q;
-    if (httpClientStream(stream)) {
-        pairQueues(stream->rxHead, stream->txHead);
-        httpOpenQueues(stream);
-    }
     if (q->net->protocol < 2) {
+        /* The output queue resumes the stream when the network drains */
         q->net->inputq->stream = stream;
+        q->net->inputq->pair->stream = stream;
     }
 }
 
@@ -117,6 +115,14 @@ PUBLIC void httpCreateTxPipeline(HttpStream *stream, HttpRoute *route)
             }
         }
     }
+    /*
+        Compression must follow the route filters so that cached responses and ranges see the uncompressed content
+     */
+    if (route->compress && http->compressFilter &&
+            matchFilter(stream, http->compressFilter, route, HTTP_STAGE_TX) == HTTP_ROUTE_OK) {
+        mprAddItem(tx->outputPipeline, http->compressFilter);
+        tx->flags |= HTTP_TX_HAS_FILTERS;
+    }
     /*
         Create the outgoing queues linked from the tx queue head
      */
@@ -59,6 +59,7 @@ PUBLIC void httpProcess(HttpQueue *q)
 static void processHttp(HttpQueue *q)
 {
     HttpStream  *stream;
+    HttpPacket  *packet;
     bool        more;
     int         count;
 
@@ -108,6 +109,10 @@ static void processHttp(HttpQueue *q)
             httpDestroyStream(stream);
         } else {
             httpResetServerStream(stream);
+            if ((packet = httpGetPacket(stream->net->inputq)) != 0) {
+                /* Parse the next request that was received before this request completed */
+                httpPutPacket(stream->net->inputq, packet);
+            }
         }
     }
 }
@@ -128,6 +133,10 @@ static void processFirst(HttpQueue *q)
         stream->started = stream->http->now;
         stream->http->totalRequests++;
         httpSetState(stream, HTTP_STATE_FIRST);
+        /*
+            The parse timeout now applies
+         */
+        httpScheduleStreamTimeout(stream);
 
     } else {
 #if TODO /* TODO: 100 Continue */
@@ -549,9 +558,21 @@ static void processParsed(HttpQueue *q)
 }
 
 
+/*
+    Passwords may be verified by a worker while routing. If so, the request content is buffered and the request is
+    routed again by processContent once verified.
+ */
 static void routeRequest(HttpStream *stream)
 {
+    HttpRx      *rx;
+
+    rx = stream->rx;
+    rx->authAsync = 1;
     httpRouteRequest(stream);
+    rx->authAsync = 0;
+    if (rx->authPending) {
+        return;
+    }
     httpCreatePipeline(stream);
     httpStartPipeline(stream);
     httpStartHandler(stream);
@@ -592,7 +613,7 @@ static bool processContent(HttpQueue *q)
     stream = q->stream;
     rx = stream->rx;
 
-    if (rx->eof) {
+    if (rx->eof && !rx->uploadPending && !rx->authPending) {
         if (httpServerStream(stream)) {
             if (httpAddBodyParams(stream) < 0) {
                 httpError(stream, HTTP_CODE_BAD_REQUEST, "Bad request parameters");
@@ -601,6 +622,9 @@ static bool processContent(HttpQueue *q)
             mapMethod(stream);
             if (!rx->route) {
                 routeRequest(stream);
+                if (rx->authPending) {
+                    return 0;
+                }
             }
             while ((packet = httpGetPacket(stream->rxHead)) != 0) {
                 httpPutPacket(stream->readq, packet);
@@ -613,7 +637,7 @@ static bool processContent(HttpQueue *q)
             HTTP_NOTIFY(stream, HTTP_EVENT_READABLE, 0);
         }
     }
-    return pumpOutput(q) || rx->eof;
+    return pumpOutput(q) || (rx->eof && !rx->uploadPending);
 }
 
 
@@ -759,6 +783,7 @@ static void prepErrorDoc(HttpQueue *q)
     stream->tx = httpCreateTx(stream, NULL);
 
     stream->rx->headers = rx->headers;
+    stream->rx->headerFields = rx->headerFields;
     stream->rx->method = rx->method;
     stream->rx->originalUri = rx->uri;
     stream->rx->uri = (char*) tx->errorDocument;
@@ -0,0 +1,1036 @@
+/*
+    proxyHandler.c - Reverse proxy handler.
+
+    This handler relays requests to upstream HTTP servers and returns the upstream responses to the client. Request
+    and response bodies are streamed packet by packet through the pipeline and are not buffered. Upstream network
+    connections are kept alive and pooled per upstream for reuse by later requests. Upstreams are selected by round
+    robin or least connections and are taken out of service if requests or health checks fail.
+
+    An upstream network runs on the dispatcher of the client network while in use, so that all processing for a
+    proxied request is serialized. Idle upstream networks and health checks run on the proxy dispatcher.
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************* Includes ***********************************/
+
+#include    "http.h"
+
+/********************************** Defines ***********************************/
+
+/*
+    Hop-by-hop headers apply to a single connection and are not forwarded (RFC 7230 6.1). Expect is answered by this
+    server. The Host and Content-Length are defined separately.
+ */
+static cchar *hopHeaders[] = {
+    "connection",
+    "content-length",
+    "expect",
+    "host",
+    "http2-settings",
+    "keep-alive",
+    "proxy-authenticate",
+    "proxy-authorization",
+    "proxy-connection",
+    "te",
+    "trailer",
+    "transfer-encoding",
+    "upgrade",
+    0
+};
+
+/*
+    Proxy state for a request
+ */
+typedef struct ProxyRequest {
+    HttpStream      *stream;                /* Client facing stream */
+    HttpStream      *upstream;              /* Upstream client stream */
+    HttpNet         *net;                   /* Upstream network */
+    HttpUpstream    *server;                /* Selected upstream server */
+    int             responded;              /* Upstream response headers have been passed to the client */
+    int             complete;               /* Upstream response is complete */
+    int             inputPaused;            /* Reading the request body from the client is paused */
+    int             outputPaused;           /* Reading the response body from the upstream is paused */
+    int             releasing;              /* Upstream release event is scheduled */
+} ProxyRequest;
+
+/********************************** Forwards **********************************/
+
+static HttpNet *acquireNet(HttpUpstream *up, MprDispatcher *dispatcher);
+static void closeNet(HttpProxy *proxy, HttpNet *net);
+static void closeProbe(HttpNet *net, MprEvent *event);
+static void closeProxy(HttpQueue *q);
+static bool connectUpstream(ProxyRequest *req, HttpUpstream *up);
+static void copyRequestHeaders(HttpStream *stream, HttpStream *upstream);
+static void copyResponseHeaders(HttpStream *upstream, HttpStream *stream);
+static void incomingProxy(HttpQueue *q, HttpPacket *packet);
+static bool isHopHeader(HttpStream *stream, cchar *key);
+static bool isUsable(HttpProxy *proxy, HttpNet *net, MprTicks now, bool idle);
+static void manageProxy(HttpProxy *proxy, int flags);
+static void manageProxyRequest(ProxyRequest *req, int flags);
+static void manageUpstream(HttpUpstream *up, int flags);
+static int openProxy(HttpQueue *q);
+static void outgoingProxyService(HttpQueue *q);
+static void parkNet(HttpUpstream *up, HttpNet *net, bool reuse);
+static void probeNotifier(HttpStream *stream, int event, int arg);
+static void probeUpstream(HttpUpstream *up);
+static void proxyIOEvent(HttpNet *net, MprEvent *event);
+static void proxyTimer(HttpProxy *proxy, MprEvent *event);
+static void pruneIdle(HttpUpstream *up, MprTicks now);
+static void pumpResponse(ProxyRequest *req);
+static void readyProxy(HttpQueue *q);
+static void releaseEvent(ProxyRequest *req, MprEvent *event);
+static void releaseUpstream(ProxyRequest *req);
+static void resumeInput(ProxyRequest *req);
+static HttpUpstream *selectUpstream(HttpProxy *proxy, MprList *tried);
+static void setHealth(HttpUpstream *up, bool ok);
+static void startProxy(HttpQueue *q);
+static void startResponse(ProxyRequest *req);
+static void startTimer(HttpProxy *proxy);
+static void upstreamNotifier(HttpStream *upstream, int event, int arg);
+
+/*********************************** Code *************************************/
+
+PUBLIC int httpOpenProxyHandler()
+{
+    HttpStage     *stage;
+
+    if ((stage = httpCreateHandler("proxyHandler", NULL)) == 0) {
+        return MPR_ERR_CANT_CREATE;
+    }
+    HTTP->proxyHandler = stage;
+    stage->open = openProxy;
+    stage->close = closeProxy;
+    stage->start = startProxy;
+    stage->ready = readyProxy;
+    stage->incoming = incomingProxy;
+    stage->outgoingService = outgoingProxyService;
+    return 0;
+}
+
+
+/******************************** Configuration *******************************/
+
+PUBLIC HttpProxy *httpCreateProxy(int balance, int protocol)
+{
+    HttpProxy   *proxy;
+
+    if ((proxy = mprAllocObj(HttpProxy, manageProxy)) == 0) {
+        return 0;
+    }
+    proxy->upstreams = mprCreateList(0, MPR_LIST_STABLE);
+    proxy->mutex = mprCreateLock();
+    proxy->dispatcher = mprCreateDispatcher("proxy", 0);
+    proxy->balance = balance;
+    proxy->protocol = (protocol >= 2) ? 2 : 1;
+    proxy->maxIdle = HTTP_PROXY_MAX_IDLE;
+    proxy->idleTimeout = HTTP_PROXY_IDLE_TIMEOUT;
+    proxy->healthPeriod = HTTP_PROXY_HEALTH_PERIOD;
+    proxy->maxFailures = HTTP_PROXY_MAX_FAILURES;
+    return proxy;
+}
+
+
+static void manageProxy(HttpProxy *proxy, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(proxy->upstreams);
+        mprMark(proxy->dispatcher);
+        mprMark(proxy->timer);
+        mprMark(proxy->mutex);
+        mprMark(proxy->healthUri);
+    }
+}
+
+
+PUBLIC HttpUpstream *httpAddProxyUpstream(HttpProxy *proxy, cchar *url)
+{
+    HttpUpstream    *up;
+    HttpUri         *uri;
+
+    assert(proxy);
+
+    if (!url || (uri = httpCreateUri(url, 0)) == 0 || !uri->host || !uri->scheme ||
+            !(smatch(uri->scheme, "http") || smatch(uri->scheme, "https"))) {
+        return 0;
+    }
+    if ((up = mprAllocObj(HttpUpstream, manageUpstream)) == 0) {
+        return 0;
+    }
+    up->proxy = proxy;
+    up->url = strim(sclone(url), "/", MPR_TRIM_END);
+    up->idle = mprCreateList(0, 0);
+    up->shared = mprCreateList(0, 0);
+    up->mutex = mprCreateLock();
+    up->healthy = 1;
+    if (uri->secure) {
+        up->ssl = mprCreateSsl(0);
+    }
+    mprAddItem(proxy->upstreams, up);
+    return up;
+}
+
+
+static void manageUpstream(HttpUpstream *up, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(up->proxy);
+        mprMark(up->url);
+        mprMark(up->ssl);
+        mprMark(up->idle);
+        mprMark(up->shared);
+        mprMark(up->mutex);
+        mprMark(up->probe);
+    }
+}
+
+
+PUBLIC void httpSetProxyHealth(HttpProxy *proxy, cchar *uri, MprTicks period, int maxFailures)
+{
+    assert(proxy);
+
+    proxy->healthUri = (uri && *uri) ? sclone(uri) : 0;
+    if (period > 0) {
+        proxy->healthPeriod = period;
+    }
+    if (maxFailures > 0) {
+        proxy->maxFailures = maxFailures;
+    }
+    if (proxy->timer) {
+        startTimer(proxy);
+    }
+}
+
+
+PUBLIC void httpSetProxyPool(HttpProxy *proxy, int maxIdle, MprTicks idleTimeout)
+{
+    assert(proxy);
+
+    if (maxIdle >= 0) {
+        proxy->maxIdle = maxIdle;
+    }
+    if (idleTimeout > 0) {
+        proxy->idleTimeout = idleTimeout;
+    }
+}
+
+
+PUBLIC int httpSetRouteProxy(HttpRoute *route, HttpProxy *proxy)
+{
+    assert(route);
+
+    if (!proxy) {
+        route->proxy = 0;
+        return 0;
+    }
+    if (!HTTP->clientLimits) {
+        mprLog("error http proxy", 0, "Proxying requires the Http client side to be enabled");
+        return MPR_ERR_BAD_STATE;
+    }
+    if (mprGetListLength(proxy->upstreams) == 0) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    if (httpSetRouteHandler(route, "proxyHandler") < 0) {
+        return MPR_ERR_CANT_FIND;
+    }
+    route->proxy = proxy;
+    if (!route->parent || route->methods == route->parent->methods) {
+        /* Upstreams decide which methods they support */
+        httpSetRouteMethods(route, "*");
+    }
+    if (!proxy->timer) {
+        startTimer(proxy);
+    }
+    return 0;
+}
+
+
+/*
+    The timer prunes idle upstream connections and checks upstream health
+ */
+static void startTimer(HttpProxy *proxy)
+{
+    if (proxy->timer) {
+        mprRemoveEvent(proxy->timer);
+    }
+    proxy->timer = mprCreateTimerEvent(proxy->dispatcher, "proxyTimer", proxy->healthPeriod, proxyTimer, proxy,
+        MPR_EVENT_CONTINUOUS);
+}
+
+
+/********************************** Handler ***********************************/
+
+static int openProxy(HttpQueue *q)
+{
+    ProxyRequest    *req;
+
+    if ((req = mprAllocObj(ProxyRequest, manageProxyRequest)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    req->stream = q->stream;
+    /* Range requests are forwarded and ranges are applied by the upstream */
+    q->stream->tx->outputRanges = 0;
+    q->queueData = req;
+    if (q->pair) {
+        q->pair->queueData = req;
+    }
+    return 0;
+}
+
+
+static void manageProxyRequest(ProxyRequest *req, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(req->stream);
+        mprMark(req->upstream);
+        mprMark(req->net);
+        mprMark(req->server);
+    }
+}
+
+
+static void closeProxy(HttpQueue *q)
+{
+    ProxyRequest    *req;
+
+    if ((req = q->queueData) != 0) {
+        releaseUpstream(req);
+    }
+}
+
+
+/*
+    Select an upstream and send the request headers. If an upstream cannot be connected, try the others in turn.
+ */
+static void startProxy(HttpQueue *q)
+{
+    HttpStream      *stream;
+    HttpProxy       *proxy;
+    HttpUpstream    *up;
+    ProxyRequest    *req;
+    MprList         *tried;
+
+    stream = q->stream;
+    req = q->queueData;
+    if ((proxy = stream->rx->route->proxy) == 0) {
+        httpError(stream, HTTP_CODE_INTERNAL_SERVER_ERROR, "Route does not define proxy upstreams");
+        return;
+    }
+    tried = 0;
+    while ((up = selectUpstream(proxy, tried)) != 0) {
+        if (connectUpstream(req, up)) {
+            return;
+        }
+        if (!tried) {
+            tried = mprCreateList(0, 0);
+        }
+        mprAddItem(tried, up);
+    }
+    if (tried) {
+        httpError(stream, HTTP_CODE_BAD_GATEWAY, "Cannot connect to an upstream server");
+    } else {
+        httpError(stream, HTTP_CODE_SERVICE_UNAVAILABLE, "No upstream server is available");
+    }
+}
+
+
+/*
+    All the request body has been received
+ */
+static void readyProxy(HttpQueue *q)
+{
+    ProxyRequest    *req;
+
+    req = q->queueData;
+    if (req->upstream) {
+        httpFinalizeOutput(req->upstream);
+        httpServiceNetQueues(req->net, 0);
+    }
+}
+
+
+/*
+    Relay request body packets to the upstream without buffering. If the upstream cannot absorb the data, stop reading
+    from the client until the upstream write queue drains. HTTP/2 client networks are not paused as that would also
+    stall other streams.
+ */
+static void incomingProxy(HttpQueue *q, HttpPacket *packet)
+{
+    ProxyRequest    *req;
+    HttpStream      *upstream;
+    HttpNet         *net;
+
+    req = q->queueData;
+    if (!req || (upstream = req->upstream) == 0 || req->complete) {
+        return;
+    }
+    if (packet->flags & HTTP_PACKET_END) {
+        httpFinalizeOutput(upstream);
+
+    } else if (httpGetPacketLength(packet) > 0) {
+        packet->stream = 0;
+        httpPutPacket(upstream->writeq, packet);
+        net = q->net;
+        if (upstream->writeq->count >= upstream->writeq->max && net->protocol < 2 && !req->inputPaused) {
+            req->inputPaused = 1;
+            net->readBlocked = 1;
+        }
+    }
+    httpServiceNetQueues(req->net, 0);
+    httpEnableNetEvents(req->net);
+}
+
+
+/*
+    Resume reading the upstream response once the client has absorbed the response data already received
+ */
+static void outgoingProxyService(HttpQueue *q)
+{
+    ProxyRequest    *req;
+
+    httpDefaultOutgoingServiceStage(q);
+
+    req = q->queueData;
+    if (req && req->outputPaused && q->count <= q->low) {
+        req->outputPaused = 0;
+        pumpResponse(req);
+        if (!req->outputPaused && req->net) {
+            req->net->readBlocked = 0;
+            httpEnableNetEvents(req->net);
+        }
+    }
+}
+
+
+/*
+    Issue the request to the upstream. Return false if the upstream cannot be connected.
+ */
+static bool connectUpstream(ProxyRequest *req, HttpUpstream *up)
+{
+    HttpStream  *stream, *upstream;
+    HttpRx      *rx;
+    HttpNet     *net;
+    cchar       *uri;
+
+    stream = req->stream;
+    rx = stream->rx;
+
+    if ((net = acquireNet(up, stream->net->dispatcher)) == 0) {
+        setHealth(up, 0);
+        return 0;
+    }
+    if (net->protocol < 2 && (upstream = mprGetFirstItem(net->streams)) != 0) {
+        /* Pooled HTTP/1 networks retain their stream for the next request */
+        upstream->dispatcher = net->dispatcher;
+        httpResetClientStream(upstream, 0);
+        httpScheduleStreamTimeout(upstream);
+
+    } else if ((upstream = httpCreateStream(net, 0)) == 0) {
+        parkNet(up, net, 0);
+        setHealth(up, 0);
+        return 0;
+    }
+    req->server = up;
+    req->net = net;
+    req->upstream = upstream;
+    upstream->data = req;
+
+    copyRequestHeaders(stream, upstream);
+    if (rx->length >= 0) {
+        httpSetContentLength(upstream, rx->length);
+    }
+    httpSetStreamNotifier(upstream, upstreamNotifier);
+
+    uri = (rx->originalUri && *rx->originalUri == '/') ? rx->originalUri : rx->uri;
+    if (rx->route->prefixLen > 0 && sstarts(uri, rx->route->prefix)) {
+        /* The route prefix is not forwarded */
+        uri = &uri[rx->route->prefixLen];
+        if (*uri != '/') {
+            uri = sjoin("/", uri, NULL);
+        }
+    }
+    if (httpConnect(upstream, rx->method, sjoin(up->url, uri, NULL), up->ssl) < 0) {
+        httpLog(stream->trace, "proxy.upstream.error", "error", "msg:'Cannot connect to upstream',upstream:'%s',error:'%s'",
+            up->url, net->errorMsg);
+        releaseUpstream(req);
+        setHealth(up, 0);
+        return 0;
+    }
+    httpLog(stream->trace, "proxy.upstream", "context", "upstream:'%s',uri:'%s',protocol:%d", up->url, uri, net->protocol);
+    httpEnableNetEvents(net);
+    httpServiceNetQueues(net, 0);
+    return 1;
+}
+
+
+/*
+    Forward the request headers except hop-by-hop headers and add the forwarding headers
+ */
+static void copyRequestHeaders(HttpStream *stream, HttpStream *upstream)
+{
+    HttpRx      *rx;
+    MprKey      *kp;
+    cchar       *forwarded;
+
+    rx = stream->rx;
+    for (ITERATE_KEYS(rx->headers, kp)) {
+        if (!isHopHeader(stream, kp->key) && kp->data) {
+            httpSetHeaderString(upstream, kp->key, kp->data);
+        }
+    }
+    if ((forwarded = httpGetHeader(stream, "x-forwarded-for")) != 0) {
+        httpSetHeader(upstream, "X-Forwarded-For", "%s, %s", forwarded, stream->ip);
+    } else {
+        httpSetHeaderString(upstream, "X-Forwarded-For", stream->ip);
+    }
+    if (rx->hostHeader) {
+        httpSetHeaderString(upstream, "X-Forwarded-Host", rx->hostHeader);
+    }
+    httpSetHeaderString(upstream, "X-Forwarded-Proto", stream->secure ? "https" : "http");
+}
+
+
+/*
+    Return the upstream response headers except hop-by-hop headers
+ */
+static void copyResponseHeaders(HttpStream *upstream, HttpStream *stream)
+{
+    HttpRx      *rx;
+    MprKey      *kp;
+
+    rx = upstream->rx;
+    for (ITERATE_KEYS(rx->headers, kp)) {
+        if (isHopHeader(upstream, kp->key) || !kp->data) {
+            continue;
+        }
+        if (scaselessmatch(kp->key, "set-cookie")) {
+            httpAppendHeaderString(stream, kp->key, kp->data);
+        } else {
+            httpSetHeaderString(stream, kp->key, kp->data);
+        }
+    }
+}
+
+
+/*
+    Test if a header is hop-by-hop. This includes headers nominated by the Connection header.
+ */
+static bool isHopHeader(HttpStream *stream, cchar *key)
+{
+    cchar   **hp, *connection;
+    char    *name, *tok;
+
+    for (hp = hopHeaders; *hp; hp++) {
+        if (scaselessmatch(key, *hp)) {
+            return 1;
+        }
+    }
+    if ((connection = httpGetHeader(stream, "connection")) != 0) {
+        for (name = stok(sclone(connection), ", \t", &tok); name; name = stok(NULL, ", \t", &tok)) {
+            if (scaselessmatch(name, key)) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+
+static void upstreamNotifier(HttpStream *upstream, int event, int arg)
+{
+    ProxyRequest    *req;
+
+    if ((req = upstream->data) == 0) {
+        return;
+    }
+    switch (event) {
+    case HTTP_EVENT_STATE:
+        if (arg == HTTP_STATE_CONTENT) {
+            startResponse(req);
+
+        } else if (arg == HTTP_STATE_COMPLETE) {
+            req->complete = 1;
+            pumpResponse(req);
+        }
+        break;
+
+    case HTTP_EVENT_READABLE:
+        pumpResponse(req);
+        break;
+    }
+}
+
+
+/*
+    The upstream response headers have been received. Define the response status and headers.
+ */
+static void startResponse(ProxyRequest *req)
+{
+    HttpStream  *stream, *upstream;
+    HttpRx      *rx;
+
+    stream = req->stream;
+    upstream = req->upstream;
+    rx = upstream->rx;
+
+    if (upstream->error || rx->status == 0 || stream->error) {
+        return;
+    }
+    setHealth(req->server, 1);
+    httpSetStatus(stream, rx->status);
+    copyResponseHeaders(upstream, stream);
+    if (rx->length >= 0) {
+        httpSetContentLength(stream, rx->length);
+    }
+    req->responded = 1;
+}
+
+
+/*
+    Relay upstream response packets to the client. If the client cannot absorb the data, stop reading from the
+    upstream until the client has caught up. The response is finalized when the upstream response is complete and
+    all data has been relayed.
+ */
+static void pumpResponse(ProxyRequest *req)
+{
+    HttpStream  *stream, *upstream;
+    HttpPacket  *packet;
+    HttpQueue   *q;
+
+    stream = req->stream;
+    if ((upstream = req->upstream) == 0 || stream->tx->finalizedOutput) {
+        return;
+    }
+    if (req->complete && (!req->responded || upstream->error)) {
+        if (!req->responded) {
+            setHealth(req->server, 0);
+        }
+        if (!stream->error) {
+            httpError(stream, ((stream->tx->flags & HTTP_TX_HEADERS_CREATED) ? HTTP_ABORT : 0) |
+                HTTP_CODE_BAD_GATEWAY, "Upstream request failed: %s", upstream->errorMsg ? upstream->errorMsg : "no response");
+        }
+        httpFinalizeOutput(stream);
+        httpServiceNetQueues(stream->net, 0);
+        if (!req->releasing) {
+            req->releasing = 1;
+            mprCreateEvent(stream->dispatcher, "proxyRelease", 0, releaseEvent, req, 0);
+        }
+        return;
+    }
+    q = stream->writeq;
+    while (upstream->readq->first) {
+        if (q->count >= q->max && req->net->protocol < 2) {
+            if (!req->outputPaused) {
+                req->outputPaused = 1;
+                req->net->readBlocked = 1;
+            }
+            break;
+        }
+        packet = httpGetPacket(upstream->readq);
+        if (httpGetPacketLength(packet) > 0) {
+            packet->stream = 0;
+            httpPutPacket(q, packet);
+        }
+    }
+    if (req->complete && !upstream->readq->first) {
+        httpFinalizeOutput(stream);
+        if (!req->releasing) {
+            /* Release after the upstream network has finished servicing the current I/O event */
+            req->releasing = 1;
+            mprCreateEvent(stream->dispatcher, "proxyRelease", 0, releaseEvent, req, 0);
+        }
+    }
+    httpServiceNetQueues(stream->net, 0);
+}
+
+
+static void releaseEvent(ProxyRequest *req, MprEvent *event)
+{
+    releaseUpstream(req);
+}
+
+
+/*
+    Detach the request from the upstream network. The network is returned to the pool if it can be reused.
+ */
+static void releaseUpstream(ProxyRequest *req)
+{
+    HttpStream      *upstream;
+    HttpNet         *net;
+    HttpUpstream    *up;
+    bool            reuse;
+
+    if ((upstream = req->upstream) == 0) {
+        return;
+    }
+    net = req->net;
+    up = req->server;
+    req->upstream = 0;
+    req->net = 0;
+
+    reuse = upstream->state == HTTP_STATE_COMPLETE && !upstream->error && httpIsEof(upstream) &&
+        !upstream->readq->first && !net->error && !net->eof && (net->protocol >= 2 || upstream->keepAliveCount > 1);
+    upstream->data = 0;
+    httpSetStreamNotifier(upstream, NULL);
+    if (reuse && net->protocol < 2) {
+        /* Destroying an HTTP/1 stream disconnects the socket, so retain the stream with the network */
+        httpCancelTimeout(&upstream->wheelEntry);
+    } else {
+        httpDestroyStream(upstream);
+    }
+    resumeInput(req);
+    parkNet(up, net, reuse);
+
+    lock(up);
+    up->active--;
+    unlock(up);
+}
+
+
+/*
+    Resume reading the request body from the client
+ */
+static void resumeInput(ProxyRequest *req)
+{
+    HttpNet     *net;
+
+    if (req->inputPaused) {
+        req->inputPaused = 0;
+        net = req->stream->net;
+        if (!net->destroyed) {
+            net->readBlocked = 0;
+            httpEnableNetEvents(net);
+        }
+    }
+}
+
+
+/*
+    I/O event callback for upstream networks. Resume reading the request body if the upstream has drained it.
+ */
+static void proxyIOEvent(HttpNet *net, MprEvent *event)
+{
+    HttpStream      *upstream;
+    ProxyRequest    *req;
+    int             next;
+
+    httpIOEvent(net, event);
+
+    if (!net->destroyed) {
+        for (ITERATE_ITEMS(net->streams, upstream, next)) {
+            if ((req = upstream->data) != 0 && req->inputPaused && upstream->writeq->count <= upstream->writeq->low) {
+                resumeInput(req);
+            }
+        }
+    }
+}
+
+
+/********************************** Balancing *********************************/
+
+/*
+    Select a healthy upstream that has not already been tried for this request
+ */
+static HttpUpstream *selectUpstream(HttpProxy *proxy, MprList *tried)
+{
+    HttpUpstream    *up, *best;
+    int             count, i, index, start;
+
+    lock(proxy);
+    best = 0;
+    index = 0;
+    count = mprGetListLength(proxy->upstreams);
+    start = count ? proxy->next % count : 0;
+    for (i = 0; i < count; i++) {
+        up = mprGetItem(proxy->upstreams, (start + i) % count);
+        if (!up->healthy || (tried && mprLookupItem(tried, up) >= 0)) {
+            continue;
+        }
+        if (!best || (proxy->balance == HTTP_PROXY_LEAST_CONN && up->active < best->active)) {
+            best = up;
+            index = (start + i) % count;
+            if (proxy->balance == HTTP_PROXY_ROUND_ROBIN) {
+                break;
+            }
+        }
+    }
+    if (best) {
+        proxy->next = index + 1;
+    }
+    unlock(proxy);
+    return best;
+}
+
+
+/*
+    Record the outcome of a request or health check. Upstreams are taken out of service after consecutive failures.
+ */
+static void setHealth(HttpUpstream *up, bool ok)
+{
+    HttpProxy   *proxy;
+
+    proxy = up->proxy;
+    lock(up);
+    if (ok) {
+        up->failures = 0;
+        if (!up->healthy) {
+            up->healthy = 1;
+            mprLog("info http proxy", 2, "Upstream %s is in service", up->url);
+        }
+    } else if (++up->failures >= proxy->maxFailures && up->healthy) {
+        up->healthy = 0;
+        mprLog("error http proxy", 0, "Upstream %s is out of service after %d failures", up->url, up->failures);
+    }
+    unlock(up);
+}
+
+
+/************************************ Pool ************************************/
+
+/*
+    Get a network for the upstream. Prefer an active HTTP/2 network on the same dispatcher, then an idle network,
+    otherwise create a new network. The network is bound to the given dispatcher.
+ */
+static HttpNet *acquireNet(HttpUpstream *up, MprDispatcher *dispatcher)
+{
+    HttpProxy   *proxy;
+    HttpNet     *net, *np;
+    MprTicks    now;
+    int         next;
+
+    proxy = up->proxy;
+    now = mprGetTicks();
+    net = 0;
+
+    lock(up);
+    if (proxy->protocol >= 2) {
+        for (ITERATE_ITEMS(up->shared, np, next)) {
+            if (np->dispatcher == dispatcher && isUsable(proxy, np, now, 0) && np->ownStreams < np->limits->txStreamsMax) {
+                up->active++;
+                unlock(up);
+                return np;
+            }
+        }
+    }
+    while ((np = mprPopItem(up->idle)) != 0) {
+        if (isUsable(proxy, np, now, 1)) {
+            net = np;
+            break;
+        }
+        closeNet(proxy, np);
+    }
+    up->active++;
+    unlock(up);
+
+    if (net) {
+        net->dispatcher = dispatcher;
+        net->lastActivity = net->http->now;
+        httpScheduleNetTimeout(net);
+    } else if ((net = httpCreateNet(dispatcher, NULL, proxy->protocol, HTTP_NET_ASYNC)) != 0) {
+        httpSetIOCallback(net, proxyIOEvent);
+    } else {
+        lock(up);
+        up->active--;
+        unlock(up);
+        return 0;
+    }
+    if (net->protocol >= 2) {
+        lock(up);
+        mprAddItem(up->shared, net);
+        unlock(up);
+    }
+    return net;
+}
+
+
+/*
+    Return a network to the pool. The network is detached from the client dispatcher and its I/O events are disabled.
+    Networks that cannot be reused are closed. HTTP/2 networks remain active while they have other streams.
+ */
+static void parkNet(HttpUpstream *up, HttpNet *net, bool reuse)
+{
+    HttpProxy   *proxy;
+
+    proxy = up->proxy;
+    lock(up);
+    if (net->protocol >= 2 && mprGetListLength(net->streams) > 0) {
+        if (!reuse) {
+            /* Do not share further. The network is closed when its last stream completes. */
+            mprRemoveItem(up->shared, net);
+        }
+        unlock(up);
+        return;
+    }
+    mprRemoveItem(up->shared, net);
+    if (reuse && mprGetListLength(up->idle) < proxy->maxIdle) {
+        mprRemoveSocketHandler(net->sock);
+        httpCancelTimeout(&net->wheelEntry);
+        net->readBlocked = 0;
+        net->dispatcher = proxy->dispatcher;
+        net->lastActivity = net->http->now;
+        mprPushItem(up->idle, net);
+        unlock(up);
+        return;
+    }
+    unlock(up);
+    closeNet(proxy, net);
+}
+
+
+/*
+    Close a network. The network must first be detached from the client dispatcher which may be destroyed
+    with the network.
+ */
+static void closeNet(HttpProxy *proxy, HttpNet *net)
+{
+    net->dispatcher = proxy->dispatcher;
+    if (net->sock) {
+        mprRemoveSocketHandler(net->sock);
+    }
+    httpDestroyNet(net);
+}
+
+
+/*
+    Test if a network can be used for another request. An idle network must not have expired, must not have been
+    closed by the upstream and must not have received unsolicited data.
+ */
+static bool isUsable(HttpProxy *proxy, HttpNet *net, MprTicks now, bool idle)
+{
+    MprSocket   *sock;
+
+    if ((sock = net->sock) == 0 || net->destroyed || net->error || net->eof || net->goaway || net->receivedGoaway) {
+        return 0;
+    }
+    if (idle) {
+        if ((now - net->lastActivity) >= proxy->idleTimeout || mprIsSocketEof(sock) || mprSocketHasBufferedRead(sock)) {
+            return 0;
+        }
+#if ME_UNIX_LIKE && defined(MSG_DONTWAIT)
+    {
+        char    c;
+
+        if (recv(sock->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+            return 0;
+        }
+    }
+#endif
+    }
+    return 1;
+}
+
+
+/*********************************** Health ***********************************/
+
+/*
+    Prune idle networks and check upstream health. Runs on the proxy dispatcher.
+ */
+static void proxyTimer(HttpProxy *proxy, MprEvent *event)
+{
+    HttpUpstream    *up;
+    MprTicks        now;
+    int             next;
+
+    now = mprGetTicks();
+    for (ITERATE_ITEMS(proxy->upstreams, up, next)) {
+        pruneIdle(up, now);
+        if (proxy->healthUri) {
+            probeUpstream(up);
+
+        } else if (!up->healthy) {
+            /*
+                Passive checking only. Return the upstream to service on probation: a further failure will take it
+                out of service again.
+             */
+            lock(up);
+            up->healthy = 1;
+            up->failures = max(proxy->maxFailures - 1, 0);
+            unlock(up);
+        }
+    }
+}
+
+
+static void pruneIdle(HttpUpstream *up, MprTicks now)
+{
+    HttpNet     *net;
+    int         next;
+
+    lock(up);
+    for (ITERATE_ITEMS(up->idle, net, next)) {
+        if (!isUsable(up->proxy, net, now, 1)) {
+            mprRemoveItem(up->idle, net);
+            next--;
+            closeNet(up->proxy, net);
+        }
+    }
+    unlock(up);
+}
+
+
+/*
+    Request the health check URI from the upstream. A probe that has not completed by the next period has failed.
+ */
+static void probeUpstream(HttpUpstream *up)
+{
+    HttpProxy   *proxy;
+    HttpNet     *net;
+    HttpStream  *stream;
+
+    proxy = up->proxy;
+    if ((net = up->probe) != 0) {
+        up->probe = 0;
+        httpDestroyNet(net);
+        setHealth(up, 0);
+    }
+    if ((net = httpCreateNet(proxy->dispatcher, NULL, proxy->protocol, HTTP_NET_ASYNC)) == 0) {
+        return;
+    }
+    if ((stream = httpCreateStream(net, 0)) == 0) {
+        httpDestroyNet(net);
+        return;
+    }
+    stream->data = up;
+    stream->keepAliveCount = 0;
+    httpSetStreamNotifier(stream, probeNotifier);
+    if (httpConnect(stream, "GET", sjoin(up->url, proxy->healthUri, NULL), up->ssl) < 0) {
+        httpDestroyNet(net);
+        setHealth(up, 0);
+        return;
+    }
+    up->probe = net;
+    httpFinalizeOutput(stream);
+    httpEnableNetEvents(net);
+    httpServiceNetQueues(net, 0);
+}
+
+
+static void probeNotifier(HttpStream *stream, int event, int arg)
+{
+    HttpUpstream    *up;
+    int             status;
+
+    if (event != HTTP_EVENT_STATE || arg != HTTP_STATE_COMPLETE || (up = stream->data) == 0 || up->probe != stream->net) {
+        return;
+    }
+    status = stream->rx ? stream->rx->status : 0;
+    setHealth(up, !stream->error && 200 <= status && status < 400);
+    up->probe = 0;
+    mprCreateEvent(up->proxy->dispatcher, "proxyProbe", 0, closeProbe, stream->net, 0);
+}
+
+
+static void closeProbe(HttpNet *net, MprEvent *event)
+{
+    httpDestroyNet(net);
+}
+
+
+/*
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+ */
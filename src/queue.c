@@ -244,6 +244,9 @@ PUBLIC bool httpFlushQueue(HttpQueue *q, int flags)
             stream->lastActivity = net->lastActivity = net->http->now;
             if (events & MPR_WRITABLE) {
                 net->lastActivity = net->http->now;
+#if ME_HTTP_HTTP2
+                net->ioWritten = 0;
+#endif
                 httpResumeQueue(net->socketq);
                 httpScheduleQueue(net->socketq);
                 httpServiceNetQueues(net, flags);
@@ -36,6 +36,7 @@ PUBLIC int httpOpenRangeFilter()
         return MPR_ERR_CANT_CREATE;
     }
     HTTP->rangeFilter = filter;
+    filter->flags |= HTTP_STAGE_ENTITY;
     filter->match = matchRange;
     filter->start = startRange;
     filter->outgoingService = outgoingRangeService;
@@ -164,7 +165,7 @@ static HttpPacket *selectBytes(HttpQueue *q, HttpPacket *packet)
         Process the data packet over multiple ranges ranges until all the data is processed or discarded.
      */
     while (range && packet) {
-        length = httpGetPacketLength(packet);
+        length = httpGetPacketEntityLength(packet);
         if (length <= 0) {
             return 0;
         }
@@ -191,7 +192,10 @@ static HttpPacket *selectBytes(HttpQueue *q, HttpPacket *packet)
             assert(range->start <= tx->rangePos && tx->rangePos < range->end);
             span = min(length, (range->end - tx->rangePos));
             span = max(span, 0);
-            count = (ssize) min(span, q->nextQ->packetSize);
+            /*
+                Entity packets are not buffered, so they are only split at range boundaries
+             */
+            count = (ssize) (packet->esize ? span : min(span, q->nextQ->packetSize));
             assert(count > 0);
             if (length > count) {
                 /* Split packet if packet extends past range */
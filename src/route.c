@@ -25,10 +25,32 @@
         route->field = mprCloneHash(route->parent->field); \
     }
 
+/*
+    Route dispatch trie node. Routes are anchored at the node for the complete segments that start their pattern.
+ */
+typedef struct HttpRouteTrie {
+    MprHash     *children;                  /**< Literal segment children */
+    struct HttpRouteTrie *wild;             /**< Child for a {token} segment */
+    MprList     *routes;                    /**< Indexes of routes anchored at this node in host order */
+    int         compiled;                   /**< Number of host routes when compiled (root only) */
+} HttpRouteTrie;
+
+#define HTTP_TRIE_SEGMENT       256         /**< Maximum literal segment length indexed by the trie */
+#define HTTP_TRIE_CANDIDATES    64          /**< Candidate routes held on the stack when routing */
+#define HTTP_SIMPLE_TOKEN       "([^/]*)"
+#define HTTP_SIMPLE_TOKEN_LEN   7
+#define HTTP_SIMPLE_MAX_TOKENS  ((ME_MAX_ROUTE_MATCHES * 2) / 3 - 1)
+
+#define isQuantifier(c)         ((c) == '*' || (c) == '+' || (c) == '?')
+
 /********************************** Forwards **********************************/
 
+static void addTrieRoute(HttpRouteTrie *trie, HttpRoute *route, int index);
 static void addUniqueItem(MprList *list, HttpRouteOp *op);
 static int checkRoute(HttpStream *stream, HttpRoute *route);
+static int collectRoutes(HttpRouteTrie *trie, cchar *path, int *candidates, int max, int count);
+static int compareIndex(cvoid *a, cvoid *b, void *ctx);
+static HttpRouteTrie *createTrie(void);
 static HttpLang *createLangDef(cchar *path, cchar *suffix, int flags);
 static HttpRouteOp *createRouteOp(cchar *name, int flags);
 static void definePathVars(HttpRoute *route);
@@ -39,12 +61,16 @@ static char *expandRequestTokens(HttpStream *stream, char *targetKey);
 static void finalizePattern(HttpRoute *route);
 static char *finalizeReplacement(HttpRoute *route, cchar *str);
 static char *finalizeTemplate(HttpRoute *route);
+static bool isSimplePattern(cchar *pattern);
 static bool opPresent(MprList *list, HttpRouteOp *op);
 static void manageRoute(HttpRoute *route, int flags);
 static void manageLang(HttpLang *lang, int flags);
+static void manageRouteCompress(HttpCompress *compress, int flags);
 static void manageRouteOp(HttpRouteOp *op, int flags);
+static void manageTrie(HttpRouteTrie *trie, int flags);
 static int matchRequestUri(HttpStream *stream, HttpRoute *route);
 static int matchRoute(HttpStream *stream, HttpRoute *route);
+static int matchSimple(cchar *pattern, cchar *path, int *matches);
 static int selectHandler(HttpStream *stream, HttpRoute *route);
 static int testCondition(HttpStream *stream, HttpRoute *route, HttpRouteOp *condition);
 static char *trimQuotes(char *str);
@@ -161,15 +187,18 @@ PUBLIC HttpRoute *httpCreateInheritedRoute(HttpRoute *parent)
     route->lifespan = parent->lifespan;
     route->limits = parent->limits;
     route->map = parent->map;
+    route->compress = parent->compress;
     route->methods = parent->methods;
     route->mimeTypes = parent->mimeTypes;
     route->mode = parent->mode;
     route->optimizedPattern = parent->optimizedPattern;
     route->outputStages = parent->outputStages;
+    route->proxy = parent->proxy;
     route->params = parent->params;
     route->parent = parent;
     route->pattern = parent->pattern;
     route->patternCompiled = parent->patternCompiled;
+    route->patternStudy = parent->patternStudy;
     route->prefix = parent->prefix;
     route->prefixLen = parent->prefixLen;
     route->renameUploads = parent->renameUploads;
@@ -224,9 +253,11 @@ static void manageRoute(HttpRoute *route, int flags)
         mprMark(route->languages);
         mprMark(route->limits);
         mprMark(route->map);
+        mprMark(route->compress);
         mprMark(route->methods);
         mprMark(route->mimeTypes);
         mprMark(route->mode);
+        mprMark(route->proxy);
         mprMark(route->optimizedPattern);
         mprMark(route->outputStages);
         mprMark(route->params);
@@ -254,6 +285,7 @@ static void manageRoute(HttpRoute *route, int flags)
     } else if (flags & MPR_MANAGE_FREE) {
         if (route->patternCompiled && (route->flags & HTTP_ROUTE_FREE_PATTERN)) {
             free(route->patternCompiled);
+            free(route->patternStudy);
         }
     }
 }
@@ -359,15 +391,28 @@ PUBLIC void httpStopRoute(HttpRoute *route)
  */
 PUBLIC void httpRouteRequest(HttpStream *stream)
 {
-    HttpRx      *rx;
-    HttpTx      *tx;
-    HttpRoute   *route;
-    int         next, rewrites, match;
+    HttpRx          *rx;
+    HttpTx          *tx;
+    HttpRoute       *route;
+    HttpRouteTrie   *trie;
+    MprList         *routes;
+    cchar           *pathInfo;
+    int             stack[HTTP_TRIE_CANDIDATES], *candidates;
+    int             count, next, rewrites, match;
 
     rx = stream->rx;
     tx = stream->tx;
     route = 0;
     rewrites = 0;
+    pathInfo = rx->pathInfo;
+    routes = stream->host->routes;
+    trie = stream->host->routeTrie;
+    if (trie && trie->compiled != routes->length) {
+        /* Routes were added to a shared route list since compiling */
+        trie = 0;
+    }
+    candidates = 0;
+    count = 0;
 
     if (stream->error) {
         tx->handler = stream->http->passHandler;
@@ -375,13 +420,31 @@ PUBLIC void httpRouteRequest(HttpStream *stream)
 
     } else {
         for (next = rewrites = 0; rewrites < ME_MAX_REWRITE; ) {
-            if (next >= stream->host->routes->length) {
-                break;
+            if (trie && next == 0) {
+                /*
+                    Select the routes that can match the path (again after a rewrite) and test them in host order
+                 */
+                candidates = stack;
+                if ((count = collectRoutes(trie, rx->pathInfo, stack, HTTP_TRIE_CANDIDATES, 0)) > HTTP_TRIE_CANDIDATES) {
+                    candidates = mprAlloc(routes->length * sizeof(int));
+                    count = collectRoutes(trie, rx->pathInfo, candidates, routes->length, 0);
+                }
+                mprSort(candidates, count, sizeof(int), compareIndex, 0);
+            }
+            if (candidates) {
+                if (next >= count) {
+                    break;
+                }
+                route = routes->items[candidates[next++]];
+            } else {
+                if (next >= routes->length) {
+                    break;
+                }
+                route = routes->items[next++];
             }
-            route = stream->host->routes->items[next++];
             if (route->startSegment && strncmp(rx->pathInfo, route->startSegment, route->startSegmentLen) != 0) {
                 /* Failed to match the first URI segment, skip to the next group */
-                if (next < route->nextGroup) {
+                if (!candidates && next < route->nextGroup) {
                     next = route->nextGroup;
                 }
 
@@ -399,6 +462,13 @@ PUBLIC void httpRouteRequest(HttpStream *stream)
             }
         }
     }
+    if (rx->authPending) {
+        /* Routing resumes once a worker has verified the password. Undo any prefix or rewrite of the path */
+        rx->route = 0;
+        rx->pathInfo = pathInfo;
+        rx->scriptName = 0;
+        return;
+    }
     if (route == 0 || tx->handler == 0) {
         rx->route = stream->host->defaultRoute;
         httpError(stream, HTTP_CODE_BAD_METHOD, "Cannot find suitable route for request method");
@@ -407,6 +477,7 @@ PUBLIC void httpRouteRequest(HttpStream *stream)
     rx->route = route;
     stream->limits = route->limits;
     stream->trace = route->trace;
+    httpScheduleStreamTimeout(stream);
 
     if (rewrites >= ME_MAX_REWRITE) {
         httpError(stream, HTTP_CODE_INTERNAL_SERVER_ERROR, "Too many request rewrites");
@@ -421,6 +492,139 @@ PUBLIC void httpRouteRequest(HttpStream *stream)
 }
 
 
+/*
+    Compile the host routes into a trie keyed by the complete leading segments of each route pattern
+ */
+PUBLIC void httpCompileRoutes(HttpHost *host)
+{
+    HttpRouteTrie   *trie;
+    HttpRoute       *route;
+    int             next;
+
+    if ((trie = createTrie()) == 0) {
+        return;
+    }
+    for (ITERATE_ITEMS(host->routes, route, next)) {
+        addTrieRoute(trie, route, next - 1);
+    }
+    trie->compiled = host->routes->length;
+    host->routeTrie = trie;
+}
+
+
+static HttpRouteTrie *createTrie()
+{
+    HttpRouteTrie   *trie;
+
+    if ((trie = mprAllocObj(HttpRouteTrie, manageTrie)) == 0) {
+        return 0;
+    }
+    trie->routes = mprCreateList(0, MPR_LIST_STATIC_VALUES);
+    return trie;
+}
+
+
+static void manageTrie(HttpRouteTrie *trie, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(trie->children);
+        mprMark(trie->wild);
+        mprMark(trie->routes);
+    }
+}
+
+
+/*
+    Anchor a route at the deepest node its pattern requires. A segment is only required if it is wholly literal or
+    a single {token}, and is followed by a "/" that is not quantified. Patterns that may match without their
+    leading literals (negated, alternation or no leading "/") stay at the root and are always tested.
+ */
+static void addTrieRoute(HttpRouteTrie *trie, HttpRoute *route, int index)
+{
+    HttpRouteTrie   *child;
+    cchar           *cp, *ep;
+    char            *segment;
+
+    cp = route->pattern;
+    if (*cp == '^') {
+        cp++;
+    }
+    if ((route->flags & HTTP_ROUTE_NOT) || schr(cp, '|')) {
+        cp = "";
+    }
+    while (*cp == '/') {
+        if (cp[1] == '{') {
+            if ((ep = schr(cp, '}')) == 0 || ep[1] != '/' || isQuantifier(ep[2]) || memchr(cp, '=', ep - cp)) {
+                break;
+            }
+            ep++;
+            if (!trie->wild && (trie->wild = createTrie()) == 0) {
+                break;
+            }
+            trie = trie->wild;
+        } else {
+            ep = &cp[1 + strcspn(&cp[1], "/^$*+?.()|{}[]\\~")];
+            if (*ep != '/' || isQuantifier(ep[1]) || (ep - cp - 1) > HTTP_TRIE_SEGMENT) {
+                break;
+            }
+            segment = snclone(&cp[1], ep - cp - 1);
+            if (!trie->children) {
+                trie->children = mprCreateHash(0, 0);
+            }
+            if ((child = mprLookupKey(trie->children, segment)) == 0) {
+                if ((child = createTrie()) == 0) {
+                    break;
+                }
+                mprAddKey(trie->children, segment, child);
+            }
+            trie = child;
+        }
+        cp = ep;
+    }
+    mprAddItem(trie->routes, ITOP(index));
+}
+
+
+/*
+    Collect the indexes of routes anchored on the trie paths matching the complete segments of the request path.
+    Returns the total count which may exceed "max" in which case only "max" indexes are stored.
+ */
+static int collectRoutes(HttpRouteTrie *trie, cchar *path, int *candidates, int max, int count)
+{
+    HttpRouteTrie   *child;
+    cchar           *ep;
+    char            segment[HTTP_TRIE_SEGMENT + 1];
+    int             i;
+
+    /* Items are route indexes, so zero is valid and the list cannot be iterated to a null item */
+    for (i = 0; i < trie->routes->length; i++, count++) {
+        if (count < max) {
+            candidates[count] = (int) PTOI(trie->routes->items[i]);
+        }
+    }
+    if (*path != '/' || (ep = schr(&path[1], '/')) == 0) {
+        return count;
+    }
+    if (trie->children && (ep - path - 1) <= HTTP_TRIE_SEGMENT) {
+        memcpy(segment, &path[1], ep - path - 1);
+        segment[ep - path - 1] = '\0';
+        if ((child = mprLookupKey(trie->children, segment)) != 0) {
+            count = collectRoutes(child, ep, candidates, max, count);
+        }
+    }
+    if (trie->wild) {
+        count = collectRoutes(trie->wild, ep, candidates, max, count);
+    }
+    return count;
+}
+
+
+static int compareIndex(cvoid *a, cvoid *b, void *ctx)
+{
+    return *(cint*) a - *(cint*) b;
+}
+
+
 static int matchRoute(HttpStream *stream, HttpRoute *route)
 {
     HttpRx      *rx;
@@ -467,8 +671,13 @@ static int matchRequestUri(HttpStream *stream, HttpRoute *route)
     rx = stream->rx;
 
     if (route->patternCompiled) {
-        rx->matchCount = pcre_exec(route->patternCompiled, NULL, rx->pathInfo, (int) slen(rx->pathInfo), 0, 0,
-            rx->matches, sizeof(rx->matches) / sizeof(int));
+        if (route->flags & HTTP_ROUTE_SIMPLE) {
+            /* Literal and token patterns are matched without PCRE */
+            rx->matchCount = matchSimple(route->optimizedPattern, rx->pathInfo, rx->matches);
+        } else {
+            rx->matchCount = pcre_exec(route->patternCompiled, route->patternStudy, rx->pathInfo, (int) slen(rx->pathInfo), 0, 0,
+                rx->matches, sizeof(rx->matches) / sizeof(int));
+        }
         if (route->flags & HTTP_ROUTE_NOT) {
             if (rx->matchCount > 0) {
                 return HTTP_ROUTE_REJECT;
@@ -496,6 +705,72 @@ static int matchRequestUri(HttpStream *stream, HttpRoute *route)
 }
 
 
+/*
+    Match a simple pattern of literal text and "([^/]*)" tokens that are followed by "/" or the end of the pattern.
+    Tokens are then matched greedily without backtracking. Returns the same match count and offsets as pcre_exec.
+ */
+static int matchSimple(cchar *pattern, cchar *path, int *matches)
+{
+    cchar   *pp, *sp, *start;
+    int     count;
+
+    count = 1;
+    sp = path;
+    for (pp = &pattern[1]; *pp; ) {
+        if (*pp == '(') {
+            for (start = sp; *sp && *sp != '/'; sp++) {}
+            matches[count * 2] = (int) (start - path);
+            matches[count * 2 + 1] = (int) (sp - path);
+            count++;
+            pp += HTTP_SIMPLE_TOKEN_LEN;
+
+        } else if (*pp == '$') {
+            /* As for PCRE, "$" also matches before a trailing newline */
+            if (*sp && !(sp[0] == '\n' && sp[1] == '\0')) {
+                return PCRE_ERROR_NOMATCH;
+            }
+            break;
+
+        } else if (*pp++ != *sp++) {
+            return PCRE_ERROR_NOMATCH;
+        }
+    }
+    matches[0] = 0;
+    matches[1] = (int) (sp - path);
+    return count;
+}
+
+
+/*
+    Test if an optimized pattern can be matched by matchSimple
+ */
+static bool isSimplePattern(cchar *pattern)
+{
+    cchar   *cp;
+    int     tokens;
+
+    if (*pattern != '^') {
+        return 0;
+    }
+    for (tokens = 0, cp = &pattern[1]; *cp; cp++) {
+        if (sncmp(cp, HTTP_SIMPLE_TOKEN, HTTP_SIMPLE_TOKEN_LEN) == 0) {
+            cp += HTTP_SIMPLE_TOKEN_LEN;
+            if ((*cp != '\0' && *cp != '/' && !(cp[0] == '$' && cp[1] == '\0')) || ++tokens > HTTP_SIMPLE_MAX_TOKENS) {
+                return 0;
+            }
+            cp--;
+
+        } else if (*cp == '$' && cp[1] == '\0') {
+            break;
+
+        } else if (strchr("^$*+?.()|{}[]\\", *cp)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
 static int checkRoute(HttpStream *stream, HttpRoute *route)
 {
     HttpRouteOp     *op, *condition, *update;
@@ -516,7 +791,8 @@ static int checkRoute(HttpStream *stream, HttpRoute *route)
     if (route->requestHeaders) {
         for (next = 0; (op = mprGetNextItem(route->requestHeaders, &next)) != 0; ) {
             if ((header = httpGetHeader(stream, op->name)) != 0) {
-                count = pcre_exec(op->mdata, NULL, header, (int) slen(header), 0, 0, matched, sizeof(matched) / sizeof(int));
+                count = pcre_exec(op->mdata, op->mextra, header, (int) slen(header), 0, 0, matched,
+                    sizeof(matched) / sizeof(int));
                 result = count > 0;
                 if (op->flags & HTTP_ROUTE_NOT) {
                     result = !result;
@@ -530,7 +806,8 @@ static int checkRoute(HttpStream *stream, HttpRoute *route)
     if (route->params) {
         for (next = 0; (op = mprGetNextItem(route->params, &next)) != 0; ) {
             if ((field = httpGetParam(stream, op->name, "")) != 0) {
-                count = pcre_exec(op->mdata, NULL, field, (int) slen(field), 0, 0, matched, sizeof(matched) / sizeof(int));
+                count = pcre_exec(op->mdata, op->mextra, field, (int) slen(field), 0, 0, matched,
+                    sizeof(matched) / sizeof(int));
                 result = count > 0;
                 if (op->flags & HTTP_ROUTE_NOT) {
                     result = !result;
@@ -544,7 +821,7 @@ static int checkRoute(HttpStream *stream, HttpRoute *route)
     if (route->conditions) {
         for (next = 0; (condition = mprGetNextItem(route->conditions, &next)) != 0; ) {
             rc = testCondition(stream, route, condition);
-            if (rc == HTTP_ROUTE_REROUTE) {
+            if (rc == HTTP_ROUTE_REROUTE || rx->authPending) {
                 return rc;
             }
             if (condition->flags & HTTP_ROUTE_NOT) {
@@ -750,6 +1027,7 @@ PUBLIC int httpAddRouteCondition(HttpRoute *route, cchar *name, cchar *details,
             mprLog("error http route", 0, "Cannot compile condition match pattern. Error %s at column %d", errMsg, column);
             return MPR_ERR_BAD_SYNTAX;
         }
+        op->mextra = pcre_study(op->mdata, 0, &errMsg);
         op->details = finalizeReplacement(route, value);
         op->flags |= HTTP_ROUTE_FREE;
 
@@ -912,6 +1190,41 @@ PUBLIC void httpAddRouteMapping(HttpRoute *route, cchar *extensions, cchar *mapp
 }
 
 
+PUBLIC void httpSetRouteCompress(HttpRoute *route, int level, ssize minSize, cchar *types, int flags)
+{
+    HttpCompress    *compress;
+    char            *type, *tok;
+
+    assert(route);
+
+    if (level <= 0) {
+        route->compress = 0;
+        return;
+    }
+    if ((compress = mprAllocObj(HttpCompress, manageRouteCompress)) == 0) {
+        return;
+    }
+    compress->level = min(level, 9);
+    compress->minSize = (minSize < 0) ? HTTP_COMPRESS_MIN_SIZE : minSize;
+    compress->flags = flags;
+    if (types && *types) {
+        compress->types = mprCreateHash(0, MPR_HASH_STATIC_VALUES | MPR_HASH_STABLE);
+        for (type = stok(slower(types), ", \t", &tok); type; type = stok(NULL, ", \t", &tok)) {
+            mprAddKey(compress->types, type, type);
+        }
+    }
+    route->compress = compress;
+}
+
+
+static void manageRouteCompress(HttpCompress *compress, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(compress->types);
+    }
+}
+
+
 /*
     Param field valuePattern
  */
@@ -932,6 +1245,7 @@ PUBLIC void httpAddRouteParam(HttpRoute *route, cchar *field, cchar *value, int
     if ((op->mdata = pcre_compile2(value, 0, 0, &errMsg, &column, NULL)) == 0) {
         mprLog("error http route", 0, "Cannot compile field pattern. Error %s at column %d", errMsg, column);
     } else {
+        op->mextra = pcre_study(op->mdata, 0, &errMsg);
         op->flags |= HTTP_ROUTE_FREE;
         mprAddItem(route->params, op);
     }
@@ -958,6 +1272,7 @@ PUBLIC void httpAddRouteRequestHeaderCheck(HttpRoute *route, cchar *header, ccha
     if ((op->mdata = pcre_compile2(pattern, 0, 0, &errMsg, &column, NULL)) == 0) {
         mprLog("error http route", 0, "Cannot compile header pattern. Error %s at column %d", errMsg, column);
     } else {
+        op->mextra = pcre_study(op->mdata, 0, &errMsg);
         op->flags |= HTTP_ROUTE_FREE;
         mprAddItem(route->requestHeaders, op);
     }
@@ -1148,6 +1463,7 @@ PUBLIC void httpResetRoutePipeline(HttpRoute *route)
     if (!route->parent || route->map != route->parent->map) {
         route->map = 0;
     }
+    route->compress = 0;
     if (!route->parent || route->languages != route->parent->languages) {
         route->languages = 0;
     }
@@ -1433,6 +1749,30 @@ PUBLIC void httpSetRoutePreserveFrames(HttpRoute *route, bool on)
 }
 
 
+PUBLIC void httpSetRouteWebSocketsDeflate(HttpRoute *route, bool on)
+{
+    route->flags &= ~HTTP_ROUTE_WEB_SOCKETS_DEFLATE;
+    if (on) {
+        route->flags |= HTTP_ROUTE_WEB_SOCKETS_DEFLATE;
+    }
+}
+
+
+PUBLIC int httpSetRouteSessionStore(HttpRoute *route, cchar *store)
+{
+    assert(route);
+
+    if (smatch(store, "token")) {
+        route->flags |= HTTP_ROUTE_SESSION_TOKEN;
+    } else if (smatch(store, "cache")) {
+        route->flags &= ~HTTP_ROUTE_SESSION_TOKEN;
+    } else {
+        return MPR_ERR_BAD_ARGS;
+    }
+    return 0;
+}
+
+
 PUBLIC void httpSetRouteSessionVisibility(HttpRoute *route, bool visible)
 {
     route->flags &= ~HTTP_ROUTE_VISIBLE_SESSION;
@@ -1684,14 +2024,24 @@ static void finalizePattern(HttpRoute *route)
     }
     mprAddNullToBuf(pattern);
     route->optimizedPattern = sclone(mprGetBufStart(pattern));
+    if (isSimplePattern(route->optimizedPattern)) {
+        route->flags |= HTTP_ROUTE_SIMPLE;
+    } else {
+        route->flags &= ~HTTP_ROUTE_SIMPLE;
+    }
     if (mprGetListLength(route->tokens) == 0) {
         route->tokens = 0;
     }
     if (route->patternCompiled && (route->flags & HTTP_ROUTE_FREE_PATTERN)) {
         free(route->patternCompiled);
+        free(route->patternStudy);
     }
+    route->patternStudy = 0;
     if ((route->patternCompiled = pcre_compile2(route->optimizedPattern, 0, 0, &errMsg, &column, NULL)) == 0) {
         mprLog("error http route", 0, "Cannot compile route. Error %s at column %d", errMsg, column);
+    } else if (!(route->flags & HTTP_ROUTE_SIMPLE)) {
+        /* Study data is null if it cannot speed matching. Anchored patterns gain nothing from a start map */
+        route->patternStudy = pcre_study(route->patternCompiled, 0, &errMsg);
     }
     route->flags |= HTTP_ROUTE_FREE_PATTERN;
 }
@@ -2154,6 +2504,10 @@ static int authCondition(HttpStream *stream, HttpRoute *route, HttpRouteOp *op)
     }
     if (!httpIsAuthenticated(stream)) {
         if (!httpGetCredentials(stream, &username, &password) || !httpLogin(stream, username, password)) {
+            if (stream->rx->authPending) {
+                /* A worker is verifying the password. The request is routed again when verified */
+                return HTTP_ROUTE_OK;
+            }
             if (!stream->tx->finalized) {
                 if (auth && auth->type) {
                     (auth->type->askLogin)(stream);
@@ -2274,7 +2628,7 @@ static int matchCondition(HttpStream *stream, HttpRoute *route, HttpRouteOp *op)
     assert(op);
 
     str = expandTokens(stream, op->details);
-    count = pcre_exec(op->mdata, NULL, str, (int) slen(str), 0, 0, matched, sizeof(matched) / sizeof(int));
+    count = pcre_exec(op->mdata, op->mextra, str, (int) slen(str), 0, 0, matched, sizeof(matched) / sizeof(int));
     if (count > 0) {
         return HTTP_ROUTE_OK;
     }
@@ -2606,6 +2960,7 @@ static void manageRouteOp(HttpRouteOp *op, int flags)
     } else if (flags & MPR_MANAGE_FREE) {
         if (op->flags & HTTP_ROUTE_FREE) {
             free(op->mdata);
+            free(op->mextra);
         }
     }
 }
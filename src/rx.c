@@ -16,7 +16,7 @@ static void manageRx(HttpRx *rx, int flags);
 PUBLIC HttpRx *httpCreateRx(HttpStream *stream)
 {
     HttpRx      *rx;
-    int         peer;
+    int         flags, peer;
 
     if ((rx = mprAllocObj(HttpRx, manageRx)) == 0) {
         return 0;
@@ -28,7 +28,15 @@ PUBLIC HttpRx *httpCreateRx(HttpStream *stream)
     rx->pathInfo = sclone("/");
     rx->scriptName = mprEmptyString();
     rx->needInputPipeline = httpClientStream(stream);
-    rx->headers = mprCreateHash(HTTP_SMALL_HASH_SIZE, MPR_HASH_CASELESS | MPR_HASH_STABLE);
+    /*
+        HTTP/1 header keys are either shared known header keys or reference the parsed header fields. Values reference
+        the header fields which are retained by rx->headerFields.
+     */
+    flags = MPR_HASH_CASELESS | MPR_HASH_STABLE;
+    if (stream->net->protocol < 2) {
+        flags |= MPR_HASH_STATIC_KEYS | MPR_HASH_STATIC_VALUES;
+    }
+    rx->headers = mprCreateHashInArena(stream->arena, HTTP_SMALL_HASH_SIZE, flags);
     rx->chunkState = HTTP_CHUNK_UNCHUNKED;
 
     rx->seqno = ++stream->net->totalRequests;
@@ -46,6 +54,7 @@ static void manageRx(HttpRx *rx, int flags)
         mprMark(rx->acceptEncoding);
         mprMark(rx->acceptLanguage);
         mprMark(rx->authDetails);
+        mprMark(rx->authKey);
         mprMark(rx->authType);
         mprMark(rx->stream);
         mprMark(rx->connection);
@@ -55,6 +64,7 @@ static void manageRx(HttpRx *rx, int flags)
         mprMark(rx->extraPath);
         mprMark(rx->files);
         mprMark(rx->headerPacket);
+        mprMark(rx->headerFields);
         mprMark(rx->headers);
         mprMark(rx->hostHeader);
         mprMark(rx->inputPipeline);
@@ -227,7 +237,7 @@ PUBLIC cchar *httpGetHeader(HttpStream *stream, cchar *key)
         assert(stream->rx);
         return 0;
     }
-    return mprLookupKey(stream->rx->headers, slower(key));
+    return mprLookupKey(stream->rx->headers, key);
 }
 
 
@@ -298,7 +308,7 @@ PUBLIC int httpSetUri(HttpStream *stream, cchar *uri)
     char        *pathInfo;
 
     rx = stream->rx;
-    if ((parsedUri = httpCreateUri(uri, 0)) == 0 || !parsedUri->valid) {
+    if ((parsedUri = httpCreateUriInArena(stream->arena, uri, 0)) == 0 || !parsedUri->valid) {
         return MPR_ERR_BAD_ARGS;
     }
     if (parsedUri->host && !rx->hostHeader) {
@@ -327,7 +337,8 @@ PUBLIC bool httpIsEof(HttpStream *stream)
 
 
 /*
-    Match the entity's etag with the client's provided etag.
+    Match the entity's etag with the client's provided etag. The etags of compressed variants have an encoding suffix
+    added by the compress filter and also match.
  */
 PUBLIC bool httpMatchEtag(HttpStream *stream, char *requestedEtag)
 {
@@ -343,7 +354,8 @@ PUBLIC bool httpMatchEtag(HttpStream *stream, char *requestedEtag)
         return 0;
     }
     for (next = 0; (tag = mprGetNextItem(rx->etags, &next)) != 0; ) {
-        if (strcmp(tag, requestedEtag) == 0) {
+        if (strcmp(tag, requestedEtag) == 0 || (sstarts(tag, requestedEtag) &&
+                (smatch(&tag[slen(requestedEtag)], "-gzip") || smatch(&tag[slen(requestedEtag)], "-deflate")))) {
             return (rx->ifMatch) ? 0 : 1;
         }
     }
@@ -73,9 +73,14 @@ PUBLIC HttpStatusCode HttpStatusCodes[] = {
 
 /****************************** Forward Declarations **************************/
 
+static HttpTimerWheel *createWheel(MprTicks granularity);
+static MprTicks getNetDeadline(HttpNet *net);
+static MprTicks getStreamDeadline(HttpStream *stream, int *reason);
 static void httpTimer(Http *http, MprEvent *event);
 static bool isIdle(bool traceRequests);
 static void manageHttp(Http *http, int flags);
+static void manageWheel(HttpTimerWheel *wheel, int flags);
+static void stopStreams(Http *http, MprEvent *event);
 static void terminateHttp(int state, int how, int status);
 static void updateCurrentDate(void);
 
@@ -109,6 +114,7 @@ PUBLIC Http *httpCreate(int flags)
     http->monitorPeriod = ME_HTTP_MONITOR_PERIOD;
     http->secret = mprGetRandomString(HTTP_MAX_SECRET);
     http->trace = httpCreateTrace(0);
+    http->wheel = createWheel(HTTP_TIMER_PERIOD);
     http->startLevel = 2;
     http->localPlatform = slower(sfmt("%s-%s-%s", ME_OS, ME_CPU, ME_PROFILE));
     httpSetPlatform(http->localPlatform);
@@ -144,6 +150,10 @@ PUBLIC Http *httpCreate(int flags)
         http->routeConditions = mprCreateHash(-1, MPR_HASH_STATIC_VALUES | MPR_HASH_STABLE);
         http->routeUpdates = mprCreateHash(-1, MPR_HASH_STATIC_VALUES | MPR_HASH_STABLE);
         http->sessionCache = mprCreateCache(MPR_CACHE_SHARED | MPR_HASH_STABLE);
+#if ME_MAX_CREDENTIALS > 0
+        http->credentialCache = mprCreateCache(MPR_HASH_STABLE);
+        mprSetCacheLimits(http->credentialCache, ME_MAX_CREDENTIALS, ME_MAX_CREDENTIAL_DURATION, 0, 0);
+#endif
         http->addresses = mprCreateHash(-1, MPR_HASH_STABLE);
         http->defenses = mprCreateHash(-1, MPR_HASH_STABLE);
         http->remedies = mprCreateHash(-1, MPR_HASH_CASELESS | MPR_HASH_STATIC_VALUES | MPR_HASH_STABLE);
@@ -151,6 +161,10 @@ PUBLIC Http *httpCreate(int flags)
         httpOpenCacheHandler();
         httpOpenPassHandler();
         httpOpenActionHandler();
+        httpOpenProxyHandler();
+#if ME_HTTP_COMPRESS
+        httpOpenCompressFilter();
+#endif
         httpOpenDirHandler();
         httpOpenFileHandler();
         http->serverLimits = httpCreateLimits(1);
@@ -209,14 +223,18 @@ static void manageHttp(Http *http, int flags)
         mprMark(http->secret);
         mprMark(http->serverLimits);
         mprMark(http->sessionCache);
+        mprMark(http->sessionKeys);
+        mprMark(http->credentialCache);
         mprMark(http->software);
         mprMark(http->stages);
         mprMark(http->staticHeaders);
+        mprMark(http->staticIndex);
         mprMark(http->statusCodes);
         mprMark(http->timer);
         mprMark(http->timestamp);
         mprMark(http->trace);
         mprMark(http->user);
+        mprMark(http->wheel);
 
         /*
             Server endpoints keep network connections alive until a timeout.
@@ -451,10 +469,12 @@ PUBLIC HttpHost *httpLookupHost(cchar *name)
 PUBLIC void httpInitLimits(HttpLimits *limits, bool serverSide)
 {
     memset(limits, 0, sizeof(HttpLimits));
+    limits->arenaSize = ME_MAX_ARENA;
     limits->cacheItemSize = ME_MAX_CACHE_ITEM;
     limits->chunkSize = ME_MAX_CHUNK;
     limits->clientMax = ME_MAX_CLIENTS;
     limits->connectionsMax = ME_MAX_CONNECTIONS;
+    limits->eventLoops = ME_MAX_EVENT_LOOPS;
     limits->headerMax = ME_MAX_NUM_HEADERS;
     limits->headerSize = ME_MAX_HEADERS;
     limits->keepAliveMax = ME_MAX_KEEP_ALIVE;
@@ -462,6 +482,7 @@ PUBLIC void httpInitLimits(HttpLimits *limits, bool serverSide)
     limits->processMax = ME_MAX_PROCESSES;
     limits->requestsPerClientMax = ME_MAX_REQUESTS_PER_CLIENT;
     limits->sessionMax = ME_MAX_SESSIONS;
+    limits->sessionTokenSize = ME_MAX_SESSION_TOKEN;
     limits->uriSize = ME_MAX_URI;
 
     limits->inactivityTimeout = ME_MAX_INACTIVITY_DURATION;
@@ -470,6 +491,7 @@ PUBLIC void httpInitLimits(HttpLimits *limits, bool serverSide)
     limits->sessionTimeout = ME_MAX_SESSION_DURATION;
 
 #if ME_HTTP_WEB_SOCKETS
+    limits->webSocketsDeflate = ME_MAX_WSS_DEFLATE;
     limits->webSocketsMax = ME_MAX_WSS_SOCKETS;
     limits->webSocketsMessageSize = ME_MAX_WSS_MESSAGE;
     limits->webSocketsFrameSize = ME_MAX_WSS_FRAME;
@@ -587,69 +609,33 @@ PUBLIC void httpSetListenCallback(HttpListenCallback fn)
 
 
 /*
-    The http timer does maintenance activities and will fire per second while there are active requests.
+    The http timer does maintenance activities and will fire per timer granularity while there are active requests.
+    Timeouts are expired from the timer wheel so only the networks and streams that are due are examined.
     This routine will also be called by httpTerminate with event == 0 to signify a shutdown.
-    NOTE: Because we lock the http here, streams cannot be deleted while we are modifying the list.
  */
 static void httpTimer(Http *http, MprEvent *event)
 {
-    HttpNet     *net;
-    HttpStream  *stream;
     HttpStage   *stage;
-    HttpLimits  *limits;
     MprModule   *module;
-    int         next, active, abort, nextConn;
-
-    active = 0;
+    int         next, active;
 
     updateCurrentDate();
-    lock(http->networks);
 
     if (!mprGetDebugMode()) {
-        for (next = 0; (net = mprGetNextItem(http->networks, &next)) != 0; active++) {
-            /*
-               Check for any inactive streams or expired requests (inactivityTimeout and requestTimeout)
-             */
-            for (active = 0, nextConn = 0; (stream = mprGetNextItem(net->streams, &nextConn)) != 0; active++) {
-                limits = stream->limits;
-                abort = mprIsStopping();
-                if (httpServerStream(stream) && (HTTP_STATE_CONNECTED < stream->state && stream->state < HTTP_STATE_PARSED) &&
-                        (http->now - stream->started) > limits->requestParseTimeout) {
-                    stream->timeout = HTTP_PARSE_TIMEOUT;
-                    abort = 1;
-                } else if ((http->now - stream->lastActivity) > limits->inactivityTimeout) {
-                    stream->timeout = HTTP_INACTIVITY_TIMEOUT;
-                    abort = 1;
-                } else if ((http->now - stream->started) > limits->requestTimeout) {
-                    stream->timeout = HTTP_REQUEST_TIMEOUT;
-                    abort = 1;
-                } else if (!event) {
-                    /* Called directly from httpStop to stop streams */
-                    if (MPR->exitTimeout > 0) {
-                        if (stream->state == HTTP_STATE_COMPLETE ||
-                            (HTTP_STATE_CONNECTED < stream->state && stream->state < HTTP_STATE_PARSED)) {
-                            abort = 1;
-                        }
-                    } else {
-                        abort = 1;
-                    }
-                }
-                if (abort) {
-                    httpStreamTimeout(stream);
-                }
-            }
-            if ((http->now - net->lastActivity) > net->limits->inactivityTimeout) {
-                net->timeout = HTTP_INACTIVITY_TIMEOUT;
-                httpNetTimeout(net);
-            }
+        if (event && !mprIsStopping()) {
+            httpExpireTimeouts();
+        } else {
+            stopStreams(http, event);
         }
     }
+    lock(http->networks);
+    active = mprGetListLength(http->networks);
 
     /*
         Check for unloadable modules
         OPT - could check for modules every minute
      */
-    if (mprGetListLength(http->networks) == 0) {
+    if (active == 0) {
         for (next = 0; (module = mprGetNextItem(MPR->moduleService->modules, &next)) != 0; ) {
             if (module->timeout) {
                 if (module->lastActivity + module->timeout < http->now) {
@@ -687,6 +673,378 @@ static void httpTimer(Http *http, MprEvent *event)
 }
 
 
+/*
+    Check every stream when stopping. Called directly from httpStop (event == 0) to abort streams.
+    NOTE: Because we lock the networks here, streams cannot be deleted while we are modifying the list.
+ */
+static void stopStreams(Http *http, MprEvent *event)
+{
+    HttpNet     *net;
+    HttpStream  *stream;
+    int         next, nextStream, abort, reason;
+
+    lock(http->networks);
+    for (ITERATE_ITEMS(http->networks, net, next)) {
+        for (ITERATE_ITEMS(net->streams, stream, nextStream)) {
+            abort = 1;
+            if (getStreamDeadline(stream, &reason) < http->now) {
+                stream->timeout = reason;
+            } else if (!event && MPR->exitTimeout > 0) {
+                abort = stream->state == HTTP_STATE_COMPLETE ||
+                    (HTTP_STATE_CONNECTED < stream->state && stream->state < HTTP_STATE_PARSED);
+            }
+            if (abort) {
+                httpStreamTimeout(stream);
+            }
+        }
+        if (getNetDeadline(net) < http->now) {
+            net->timeout = HTTP_INACTIVITY_TIMEOUT;
+            httpNetTimeout(net);
+        }
+    }
+    unlock(http->networks);
+}
+
+
+/************************************ Timer Wheel *****************************/
+
+static HttpTimerWheel *createWheel(MprTicks granularity)
+{
+    HttpTimerWheel  *wheel;
+    HttpWheelEntry  *head;
+    int             level, slot;
+
+    if ((wheel = mprAllocObj(HttpTimerWheel, manageWheel)) == 0) {
+        return 0;
+    }
+    for (level = 0; level < HTTP_WHEEL_LEVELS; level++) {
+        for (slot = 0; slot < HTTP_WHEEL_SLOTS; slot++) {
+            head = &wheel->slots[level][slot];
+            head->next = head->prev = head;
+        }
+    }
+    wheel->mutex = mprCreateLock();
+    wheel->granularity = max(granularity, 1);
+    wheel->start = mprGetTicks();
+    return wheel;
+}
+
+
+/*
+    Scheduled entries keep their networks and streams alive so an entry can never reference a freed object
+ */
+static void manageWheel(HttpTimerWheel *wheel, int flags)
+{
+    HttpWheelEntry  *head, *entry;
+    int             level, slot;
+
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(wheel->mutex);
+        lock(wheel);
+        for (level = 0; level < HTTP_WHEEL_LEVELS; level++) {
+            for (slot = 0; slot < HTTP_WHEEL_SLOTS; slot++) {
+                head = &wheel->slots[level][slot];
+                for (entry = head->next; entry != head; entry = entry->next) {
+                    mprMark(entry->net);
+                    mprMark(entry->stream);
+                }
+            }
+        }
+        unlock(wheel);
+    }
+}
+
+
+PUBLIC int httpSetTimerGranularity(MprTicks granularity)
+{
+    HttpTimerWheel  *wheel;
+
+    wheel = HTTP->wheel;
+    if (granularity <= 0) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    lock(wheel);
+    if (wheel->count > 0) {
+        unlock(wheel);
+        return MPR_ERR_BAD_STATE;
+    }
+    /*
+        Rebase so the current time maps onto the current tick
+     */
+    wheel->start = mprGetTicks() - (MprTicks) wheel->tick * granularity;
+    wheel->granularity = granularity;
+    unlock(wheel);
+    return 0;
+}
+
+
+/*
+    Add an entry to the list of a slot head
+ */
+static void appendEntry(HttpWheelEntry *head, HttpWheelEntry *entry)
+{
+    entry->next = head;
+    entry->prev = head->prev;
+    head->prev->next = entry;
+    head->prev = entry;
+}
+
+
+static void removeEntry(HttpWheelEntry *entry)
+{
+    entry->prev->next = entry->next;
+    entry->next->prev = entry->prev;
+    entry->next = entry->prev = 0;
+}
+
+
+/*
+    Move all entries from one slot to another
+ */
+static void moveEntries(HttpWheelEntry *to, HttpWheelEntry *from)
+{
+    if (from->next != from) {
+        from->next->prev = to->prev;
+        to->prev->next = from->next;
+        from->prev->next = to;
+        to->prev = from->prev;
+        from->next = from->prev = from;
+    }
+}
+
+
+/*
+    Link an entry into the slot for its tick. The tick must not be before the current wheel tick.
+    Entries beyond the span of the wheel are parked at the furthest slot and re-evaluated when they cascade.
+ */
+static void linkEntry(HttpTimerWheel *wheel, HttpWheelEntry *entry)
+{
+    uint64  delta;
+    int     level;
+
+    delta = entry->tick - wheel->tick;
+    for (level = 0; level < HTTP_WHEEL_LEVELS - 1; level++) {
+        if (delta < ((uint64) 1 << ((level + 1) * HTTP_WHEEL_BITS))) {
+            break;
+        }
+    }
+    if (delta >= ((uint64) 1 << (HTTP_WHEEL_LEVELS * HTTP_WHEEL_BITS))) {
+        entry->tick = wheel->tick + ((uint64) 1 << (HTTP_WHEEL_LEVELS * HTTP_WHEEL_BITS)) - 1;
+    }
+    appendEntry(&wheel->slots[level][(entry->tick >> (level * HTTP_WHEEL_BITS)) & (HTTP_WHEEL_SLOTS - 1)], entry);
+}
+
+
+/*
+    Schedule an entry to expire at the given time. Must be called with the wheel locked.
+ */
+static void scheduleEntry(HttpTimerWheel *wheel, HttpWheelEntry *entry, MprTicks when)
+{
+    uint64  tick;
+
+    if (entry->next) {
+        removeEntry(entry);
+    } else {
+        wheel->count++;
+    }
+    if (when > MPR_MAX_TIMEOUT - wheel->granularity) {
+        tick = MAXUINT64;
+    } else if (when < wheel->start) {
+        tick = 0;
+    } else {
+        /*
+            Entries expire once the time is past the deadline, so use the first tick after it
+         */
+        tick = (uint64) ((when - wheel->start) / wheel->granularity) + 1;
+    }
+    /*
+        The current tick has already been serviced
+     */
+    entry->tick = max(tick, wheel->tick + 1);
+    linkEntry(wheel, entry);
+}
+
+
+/*
+    Add ticks to a time without overflowing for unlimited timeouts
+ */
+static MprTicks addTicks(MprTicks when, MprTicks timeout)
+{
+    if (timeout >= MPR_MAX_TIMEOUT - when) {
+        return MPR_MAX_TIMEOUT;
+    }
+    return when + timeout;
+}
+
+
+/*
+    Return the time the stream will time out and the timeout reason
+ */
+static MprTicks getStreamDeadline(HttpStream *stream, int *reason)
+{
+    HttpLimits  *limits;
+    MprTicks    parse, inactivity, deadline;
+
+    limits = stream->limits;
+    deadline = addTicks(stream->started, limits->requestTimeout);
+    *reason = HTTP_REQUEST_TIMEOUT;
+
+    /*
+        When several timeouts have expired, parse takes precedence over inactivity over request timeouts
+     */
+    inactivity = addTicks(stream->lastActivity, limits->inactivityTimeout);
+    if (inactivity < deadline || inactivity < HTTP->now) {
+        deadline = inactivity;
+        *reason = HTTP_INACTIVITY_TIMEOUT;
+    }
+    if (httpServerStream(stream) && (HTTP_STATE_CONNECTED < stream->state && stream->state < HTTP_STATE_PARSED)) {
+        parse = addTicks(stream->started, limits->requestParseTimeout);
+        if (parse < deadline || parse < HTTP->now) {
+            deadline = parse;
+            *reason = HTTP_PARSE_TIMEOUT;
+        }
+    }
+    return deadline;
+}
+
+
+static MprTicks getNetDeadline(HttpNet *net)
+{
+    return addTicks(net->lastActivity, net->limits->inactivityTimeout);
+}
+
+
+PUBLIC void httpScheduleNetTimeout(HttpNet *net)
+{
+    HttpTimerWheel  *wheel;
+
+    if ((wheel = net->http->wheel) == 0 || net->destroyed) {
+        return;
+    }
+    lock(wheel);
+    net->wheelEntry.net = net;
+    net->wheelEntry.stream = 0;
+    scheduleEntry(wheel, &net->wheelEntry, getNetDeadline(net));
+    unlock(wheel);
+}
+
+
+PUBLIC void httpScheduleStreamTimeout(HttpStream *stream)
+{
+    HttpTimerWheel  *wheel;
+    int             reason;
+
+    if ((wheel = HTTP->wheel) == 0 || stream->destroyed || stream->net->destroyed || !stream->limits) {
+        return;
+    }
+    lock(wheel);
+    stream->wheelEntry.net = stream->net;
+    stream->wheelEntry.stream = stream;
+    scheduleEntry(wheel, &stream->wheelEntry, getStreamDeadline(stream, &reason));
+    unlock(wheel);
+}
+
+
+PUBLIC void httpCancelTimeout(HttpWheelEntry *entry)
+{
+    HttpTimerWheel  *wheel;
+
+    if ((wheel = HTTP->wheel) == 0 || !entry->next) {
+        return;
+    }
+    lock(wheel);
+    if (entry->next) {
+        removeEntry(entry);
+        wheel->count--;
+    }
+    unlock(wheel);
+}
+
+
+/*
+    Turn the wheel to the current time and collect the due entries. Higher level slots are cascaded down
+    as each lower level completes a rotation.
+ */
+static void turnWheel(HttpTimerWheel *wheel, HttpWheelEntry *due)
+{
+    HttpWheelEntry  pending, *entry;
+    uint64          target, tick;
+    int             level, slot;
+
+    target = (uint64) ((HTTP->now - wheel->start) / wheel->granularity);
+    if (wheel->count == 0) {
+        wheel->tick = max(wheel->tick, target);
+        return;
+    }
+    while (wheel->tick < target) {
+        tick = ++wheel->tick;
+        if ((tick & (HTTP_WHEEL_SLOTS - 1)) == 0) {
+            for (level = 1; level < HTTP_WHEEL_LEVELS; level++) {
+                slot = (int) ((tick >> (level * HTTP_WHEEL_BITS)) & (HTTP_WHEEL_SLOTS - 1));
+                pending.next = pending.prev = &pending;
+                moveEntries(&pending, &wheel->slots[level][slot]);
+                while ((entry = pending.next) != &pending) {
+                    removeEntry(entry);
+                    linkEntry(wheel, entry);
+                }
+                if (slot) {
+                    break;
+                }
+            }
+        }
+        moveEntries(due, &wheel->slots[0][tick & (HTTP_WHEEL_SLOTS - 1)]);
+    }
+}
+
+
+/*
+    Expire the due entries. Entries are scheduled for the earliest possible timeout, so the deadline is recomputed
+    from the current activity and the entry is rescheduled if the network or stream has been active since.
+    Timed out entries are rechecked after one more tick in case the timeout does not complete the request.
+ */
+PUBLIC void httpExpireTimeouts()
+{
+    Http            *http;
+    HttpTimerWheel  *wheel;
+    HttpWheelEntry  due, *entry;
+    MprTicks        deadline;
+    int             reason;
+
+    http = HTTP;
+    if ((wheel = http->wheel) == 0) {
+        return;
+    }
+    due.next = due.prev = &due;
+    lock(wheel);
+    turnWheel(wheel, &due);
+    while ((entry = due.next) != &due) {
+        removeEntry(entry);
+        wheel->count--;
+        if (entry->stream) {
+            if (entry->stream->destroyed) {
+                continue;
+            }
+            if ((deadline = getStreamDeadline(entry->stream, &reason)) < http->now) {
+                entry->stream->timeout = reason;
+                httpStreamTimeout(entry->stream);
+                deadline = http->now + wheel->granularity;
+            }
+        } else {
+            if (entry->net->destroyed) {
+                continue;
+            }
+            if ((deadline = getNetDeadline(entry->net)) < http->now) {
+                entry->net->timeout = HTTP_INACTIVITY_TIMEOUT;
+                httpNetTimeout(entry->net);
+                deadline = http->now + wheel->granularity;
+            }
+        }
+        scheduleEntry(wheel, entry, deadline);
+    }
+    unlock(wheel);
+}
+
+
 static void timestamp()
 {
     mprLog("info http", 0, "Time: %s", mprGetDate(NULL));
@@ -723,15 +1081,17 @@ PUBLIC void httpAddNet(HttpNet *net)
 
     lock(http);
     if (!http->timer && (!ME_DEBUG || !mprGetDebugMode())) {
-        http->timer = mprCreateTimerEvent(NULL, "httpTimer", HTTP_TIMER_PERIOD, httpTimer, http,
+        http->timer = mprCreateTimerEvent(NULL, "httpTimer", http->wheel->granularity, httpTimer, http,
             MPR_EVENT_CONTINUOUS | MPR_EVENT_QUICK);
     }
     unlock(http);
+    httpScheduleNetTimeout(net);
 }
 
 
 PUBLIC void httpRemoveNet(HttpNet *net)
 {
+    httpCancelTimeout(&net->wheelEntry);
     mprRemoveItem(net->http->networks, net);
 }
 
@@ -853,6 +1213,11 @@ PUBLIC void httpGetStats(HttpStats *sp)
 
     mprGetCacheStats(http->sessionCache, &sp->activeSessions, &memSessions);
     sp->memSessions = memSessions;
+    if (http->credentialCache) {
+        mprGetCacheStats(http->credentialCache, &sp->activeCredentials, NULL);
+    }
+    sp->credentialHits = http->credentialHits;
+    sp->credentialMisses = http->credentialMisses;
 
     lock(http->addresses);
     for (ITERATE_KEY_DATA(http->addresses, kp, address)) {
@@ -864,6 +1229,12 @@ PUBLIC void httpGetStats(HttpStats *sp)
     sp->totalRequests = http->totalRequests;
     sp->totalConnections = http->totalConnections;
     sp->totalSweeps = MPR->heap->stats.sweeps;
+    memcpy(sp->gcPauses, ap->gcPauses, sizeof(sp->gcPauses));
+    sp->gcPauseMax = ap->gcPauseMax;
+    sp->gcPauseTotal = ap->gcPauseTotal;
+    sp->gcAbandoned = ap->gcAbandoned;
+    sp->gcAbandonedMax = ap->gcAbandonedMax;
+    sp->gcAbandonedTotal = ap->gcAbandonedTotal;
 }
 
 
@@ -876,6 +1247,7 @@ PUBLIC char *httpStatsReport(int flags)
     static MprTime      lastTime;
     static HttpStats    last;
     double              mb;
+    int                 i;
 
     mb = 1024.0 * 1024;
     now = mprGetTime();
@@ -903,6 +1275,18 @@ PUBLIC char *httpStatsReport(int flags)
     mprPutToBuf(buf, "Connections  %8.1f per/sec\n", (s.totalConnections - last.totalConnections) / elapsed);
     mprPutToBuf(buf, "Requests     %8.1f per/sec\n", (s.totalRequests - last.totalRequests) / elapsed);
     mprPutToBuf(buf, "Sweeps       %8.1f per/sec\n", (s.totalSweeps - last.totalSweeps) / elapsed);
+    mprPutToBuf(buf, "GC pauses    %8.1f msec max, %.1f msec total\n", s.gcPauseMax / 1000.0, s.gcPauseTotal / 1000.0);
+    mprPutToBuf(buf, "GC abandoned %8lld, %.1f msec max wait, %.1f msec total wait\n", s.gcAbandoned,
+        s.gcAbandonedMax / 1000.0, s.gcAbandonedTotal / 1000.0);
+    mprPutToBuf(buf, "GC histogram ");
+    for (i = 0; i < MPR_GC_PAUSE_BUCKETS; i++) {
+        if (i < MPR_GC_PAUSE_BUCKETS - 1) {
+            mprPutToBuf(buf, " <%.1fms %lld", MPR_GC_PAUSE_LIMIT(i) / 1000.0, s.gcPauses[i]);
+        } else {
+            mprPutToBuf(buf, " >=%.1fms %lld", MPR_GC_PAUSE_LIMIT(i - 1) / 1000.0, s.gcPauses[i]);
+        }
+    }
+    mprPutCharToBuf(buf, '\n');
     mprPutCharToBuf(buf, '\n');
 
     mprPutToBuf(buf, "Clients      %8d active\n", s.activeClients);
@@ -913,6 +1297,8 @@ PUBLIC char *httpStatsReport(int flags)
     mprPutToBuf(buf, "Workers      %8d busy - %d yielded, %d idle, %d max\n",
         s.workersBusy, s.workersYielded, s.workersIdle, s.workersMax);
     mprPutToBuf(buf, "Sessions     %8.1f MB\n", s.memSessions / mb);
+    mprPutToBuf(buf, "Credentials  %8d cached - %lld hits, %lld misses\n", s.activeCredentials,
+        s.credentialHits, s.credentialMisses);
     mprPutCharToBuf(buf, '\n');
 
     last = s;
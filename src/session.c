@@ -8,17 +8,38 @@
 
 #include    "http.h"
 
+/*********************************** Locals ***********************************/
+/*
+    Session token layout. The header (version, key ID and expiry) is authenticated but not encrypted.
+    The session ID and variables are encrypted as length-prefixed strings.
+
+        version(1) keyId(4) expires(4) nonce(MPR_AEAD_NONCE) tag(MPR_AEAD_TAG) ciphertext
+ */
+#define TOKEN_VERSION   2
+#define TOKEN_AAD       9
+#define TOKEN_HEADER    (TOKEN_AAD + MPR_AEAD_NONCE + MPR_AEAD_TAG)
+
+#define hexValue(c)     (isdigit((uchar) (c)) ? (c) - '0' : (c) - 'a' + 10)
+
+typedef struct SessionKey {
+    uchar       key[MPR_AEAD_KEY];          /* AES-256 key */
+    uint        id;                         /* Key ID stored in tokens to select the key for decryption */
+} SessionKey;
+
 /********************************** Forwards  *********************************/
 
 static cchar *createSecurityToken(HttpStream *stream);
 static void manageSession(HttpSession *sp, int flags);
+static HttpSession *openSessionToken(HttpStream *stream, cchar *cookie);
+static void setSessionCookie(HttpStream *stream, cchar *value);
+static int writeSessionToken(HttpStream *stream, HttpSession *sp);
 
 /************************************* Code ***********************************/
 /*
     Allocate a http session state object. This keeps a local hash for session state items.
-    This is written via httpWriteSession to the backend session state store.
+    This is written via httpWriteSession to the backend session state store. The data is the packed session hash.
  */
-static HttpSession *allocSessionObj(HttpStream *stream, cchar *id, cchar *data)
+static HttpSession *allocSessionObj(HttpStream *stream, cchar *id, cchar *data, ssize len)
 {
     HttpSession *sp;
 
@@ -32,12 +53,14 @@ static HttpSession *allocSessionObj(HttpStream *stream, cchar *id, cchar *data)
     }
     sp->lifespan = stream->limits->sessionTimeout;
     sp->id = sclone(id);
-    sp->cache = stream->http->sessionCache;
-    if (data) {
-        sp->data = mprDeserialize(data);
+    if (stream->rx->route->flags & HTTP_ROUTE_SESSION_TOKEN) {
+        sp->token = 1;
+    } else {
+        sp->cache = stream->http->sessionCache;
     }
-    if (!sp->data) {
-        sp->data = mprCreateHash(ME_MAX_SESSION_HASH, 0);
+    sp->data = mprCreateHash(ME_MAX_SESSION_HASH, 0);
+    if (data && mprUnpackHash(sp->data, data, len, 0) < 0) {
+        return 0;
     }
     return sp;
 }
@@ -80,7 +103,9 @@ PUBLIC void httpDestroySession(HttpStream *stream)
     if ((sp = httpGetSession(stream, 0)) != 0) {
         cookie = rx->route->cookie ? rx->route->cookie : HTTP_SESSION_COOKIE;
         httpRemoveCookie(stream, cookie);
-        mprExpireCacheItem(sp->cache, sp->id, 0);
+        if (!sp->token) {
+            mprExpireCacheItem(sp->cache, sp->id, 0);
+        }
         sp->id = 0;
         rx->session = 0;
     }
@@ -107,10 +132,10 @@ PUBLIC HttpSession *httpGetSession(HttpStream *stream, int create)
     Http        *http;
     HttpRx      *rx;
     HttpRoute   *route;
-    MprTicks    lifespan;
-    cchar       *cookie, *data, *id, *url;
+    cchar       *cookie, *data, *id;
+    ssize       len;
     static int  seqno = 0;
-    int         flags, thisSeqno, activeSessions;
+    int         thisSeqno, activeSessions, token;
 
     assert(stream);
     rx = stream->rx;
@@ -119,43 +144,47 @@ PUBLIC HttpSession *httpGetSession(HttpStream *stream, int create)
     assert(rx);
 
     if (!rx->session) {
+        token = (route->flags & HTTP_ROUTE_SESSION_TOKEN) ? 1 : 0;
         if ((id = httpGetSessionID(stream)) != 0) {
-            if ((data = mprReadCache(stream->http->sessionCache, id, 0, 0)) != 0) {
-                rx->session = allocSessionObj(stream, id, data);
+            if (token) {
+                /* The session cookie holds the token rather than the session ID */
+                rx->session = openSessionToken(stream, id);
+            } else if ((data = mprReadCacheBlock(stream->http->sessionCache, id, &len, 0, 0)) != 0) {
+                rx->session = allocSessionObj(stream, id, data, len);
+            }
+            if (rx->session) {
                 rx->traceId = sfmt("%d-%d-%d-%d", stream->net->address->seqno, rx->session->seqno, stream->net->seqno, rx->seqno);
             }
         }
         if (!rx->session && create) {
-            lock(http);
-            thisSeqno = ++seqno;
-            id = sfmt("%08x%08x%d", PTOI(stream->data) + PTOI(stream), (int) mprGetTicks(), thisSeqno);
-            id = mprGetMD5WithPrefix(id, slen(id), "-http.session-");
-            id = sfmt("%d%s", thisSeqno, mprGetMD5WithPrefix(id, slen(id), "::http.session::"));
-
-            mprGetCacheStats(http->sessionCache, &activeSessions, NULL);
-            if (activeSessions >= stream->limits->sessionMax) {
+            if (token) {
+                /* Token sessions hold no server memory and so are not limited by sessionMax */
+                id = mprGetRandomString(32);
+            } else {
+                lock(http);
+                thisSeqno = ++seqno;
+                id = sfmt("%08x%08x%d", PTOI(stream->data) + PTOI(stream), (int) mprGetTicks(), thisSeqno);
+                id = mprGetMD5WithPrefix(id, slen(id), "-http.session-");
+                id = sfmt("%d%s", thisSeqno, mprGetMD5WithPrefix(id, slen(id), "::http.session::"));
+
+                mprGetCacheStats(http->sessionCache, &activeSessions, NULL);
+                if (activeSessions >= stream->limits->sessionMax) {
+                    unlock(http);
+                    httpLimitError(stream, HTTP_CODE_SERVICE_UNAVAILABLE,
+                        "Too many sessions %d/%d", activeSessions, stream->limits->sessionMax);
+                    return 0;
+                }
                 unlock(http);
-                httpLimitError(stream, HTTP_CODE_SERVICE_UNAVAILABLE,
-                    "Too many sessions %d/%d", activeSessions, stream->limits->sessionMax);
-                return 0;
             }
-            unlock(http);
-
-            rx->session = allocSessionObj(stream, id, NULL);
+            rx->session = allocSessionObj(stream, id, NULL, 0);
             rx->traceId = sfmt("%d-%d-%d-%d", stream->net->address->seqno, rx->session->seqno, stream->net->seqno, rx->seqno);
-            flags = (route->flags & HTTP_ROUTE_VISIBLE_SESSION) ? 0 : HTTP_COOKIE_HTTP;
-            if (stream->secure) {
-                flags |= HTTP_COOKIE_SECURE;
-            }
-            if (route->flags & HTTP_ROUTE_LAX_COOKIE) {
-                flags |= HTTP_COOKIE_SAME_LAX;
-            } else if (route->flags & HTTP_ROUTE_STRICT_COOKIE) {
-                flags |= HTTP_COOKIE_SAME_STRICT;
+            if (token) {
+                /* The token cookie is written by httpWriteSession before the headers */
+                rx->session->dirty = 1;
+            } else {
+                setSessionCookie(stream, rx->session->id);
             }
             cookie = route->cookie ? route->cookie : HTTP_SESSION_COOKIE;
-            lifespan = (route->flags & HTTP_ROUTE_PERSIST_COOKIE) ? rx->session->lifespan : 0;
-            url = (route->prefix && *route->prefix) ? route->prefix : "/";
-            httpSetCookie(stream, cookie, rx->session->id, url, NULL, lifespan, flags);
             httpLog(stream->trace, "session.create", "context", "cookie:'%s', session:'%s'", cookie, rx->session->id);
 
             if ((route->flags & HTTP_ROUTE_XSRF) && rx->securityToken) {
@@ -264,6 +293,10 @@ PUBLIC int httpSetSessionLink(HttpStream *stream, void *link)
     if ((sp = httpGetSession(stream, 1)) == 0) {
         return MPR_ERR_CANT_FIND;
     }
+    if (sp->token) {
+        /* Token sessions are not held by the server */
+        return MPR_ERR_BAD_STATE;
+    }
     mprSetCacheLink(sp->cache, sp->id, link);
     return 0;
 }
@@ -287,10 +320,17 @@ PUBLIC int httpRemoveSessionVar(HttpStream *stream, cchar *key)
 PUBLIC int httpWriteSession(HttpStream *stream)
 {
     HttpSession     *sp;
+    MprBuf          *buf;
 
     if ((sp = stream->rx->session) != 0) {
+        if (sp->token) {
+            return writeSessionToken(stream, sp);
+        }
         if (sp->dirty) {
-            if (mprWriteCache(sp->cache, sp->id, mprSerialize(sp->data, 0), 0, sp->lifespan, 0, MPR_CACHE_SET) == 0) {
+            buf = mprCreateBuf(ME_BUFSIZE, -1);
+            mprPackHash(buf, sp->data);
+            if (mprWriteCacheBlock(sp->cache, sp->id, mprGetBufStart(buf), mprGetBufLength(buf), 0, sp->lifespan, 0,
+                    MPR_CACHE_SET) == 0) {
                 mprLog("error http session", 0, "Cannot persist session cache");
                 return MPR_ERR_CANT_WRITE;
             }
@@ -324,6 +364,265 @@ PUBLIC cchar *httpGetSessionID(HttpStream *stream)
 }
 
 
+static void setSessionCookie(HttpStream *stream, cchar *value)
+{
+    HttpRoute   *route;
+    MprTicks    lifespan;
+    cchar       *cookie, *url;
+    int         flags;
+
+    route = stream->rx->route;
+    flags = (route->flags & HTTP_ROUTE_VISIBLE_SESSION) ? 0 : HTTP_COOKIE_HTTP;
+    if (stream->secure) {
+        flags |= HTTP_COOKIE_SECURE;
+    }
+    if (route->flags & HTTP_ROUTE_LAX_COOKIE) {
+        flags |= HTTP_COOKIE_SAME_LAX;
+    } else if (route->flags & HTTP_ROUTE_STRICT_COOKIE) {
+        flags |= HTTP_COOKIE_SAME_STRICT;
+    }
+    cookie = route->cookie ? route->cookie : HTTP_SESSION_COOKIE;
+    lifespan = (route->flags & HTTP_ROUTE_PERSIST_COOKIE) ? stream->limits->sessionTimeout : 0;
+    url = (route->prefix && *route->prefix) ? route->prefix : "/";
+    httpSetCookie(stream, cookie, value, url, NULL, lifespan, flags);
+}
+
+
+/*
+    Derive a session token key from a secret. The new key becomes current and older keys are retained for decryption.
+ */
+PUBLIC int httpAddSessionKey(cchar *secret)
+{
+    Http        *http;
+    SessionKey  *sk, *prior;
+    cchar       *digest;
+    int         i, next;
+
+    if (secret == 0 || *secret == '\0') {
+        return MPR_ERR_BAD_ARGS;
+    }
+    if ((sk = mprAllocStruct(SessionKey)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    digest = sjoin(mprGetSHA(sjoin("http.session.key.1:", secret, NULL)),
+        mprGetSHA(sjoin("http.session.key.2:", secret, NULL)), NULL);
+    for (i = 0; i < MPR_AEAD_KEY; i++) {
+        sk->key[i] = (uchar) ((hexValue(digest[i * 2]) << 4) | hexValue(digest[i * 2 + 1]));
+    }
+    sk->id = (uint) stoiradix(snclone(mprGetSHA(sjoin("http.session.id:", secret, NULL)), 8), 16, NULL);
+
+    http = HTTP;
+    lock(http);
+    if (!http->sessionKeys) {
+        http->sessionKeys = mprCreateList(ME_MAX_SESSION_KEYS + 1, 0);
+    }
+    for (ITERATE_ITEMS(http->sessionKeys, prior, next)) {
+        if (prior->id == sk->id) {
+            mprRemoveItem(http->sessionKeys, prior);
+            break;
+        }
+    }
+    mprInsertItemAtPos(http->sessionKeys, 0, sk);
+    while (mprGetListLength(http->sessionKeys) > ME_MAX_SESSION_KEYS) {
+        mprRemoveItemAtPos(http->sessionKeys, mprGetListLength(http->sessionKeys) - 1);
+    }
+    unlock(http);
+    return 0;
+}
+
+
+static SessionKey *findSessionKey(uint id)
+{
+    SessionKey  *sk;
+    int         next;
+
+    for (ITERATE_ITEMS(HTTP->sessionKeys, sk, next)) {
+        if (sk->id == id) {
+            return sk;
+        }
+    }
+    return 0;
+}
+
+
+static void putUint32(uchar *bp, uint value)
+{
+    bp[0] = (uchar) (value >> 24);
+    bp[1] = (uchar) (value >> 16);
+    bp[2] = (uchar) (value >> 8);
+    bp[3] = (uchar) value;
+}
+
+
+static uint getUint32(cuchar *bp)
+{
+    return ((uint) bp[0] << 24) | ((uint) bp[1] << 16) | ((uint) bp[2] << 8) | (uint) bp[3];
+}
+
+
+/*
+    Base64 using the URL and cookie safe alphabet without padding
+ */
+static char *encodeToken(cuchar *token, ssize len)
+{
+    char    *result, *cp;
+
+    result = mprEncode64Block((cchar*) token, len);
+    for (cp = result; *cp; cp++) {
+        if (*cp == '+') {
+            *cp = '-';
+        } else if (*cp == '/') {
+            *cp = '_';
+        } else if (*cp == '=') {
+            *cp = '\0';
+            break;
+        }
+    }
+    return result;
+}
+
+
+static uchar *decodeToken(cchar *cookie, ssize *len)
+{
+    char    *str, *cp;
+
+    str = sclone(cookie);
+    for (cp = str; *cp; cp++) {
+        if (*cp == '-') {
+            *cp = '+';
+        } else if (*cp == '_') {
+            *cp = '/';
+        } else if (*cp == '+' || *cp == '/') {
+            return 0;
+        }
+    }
+    return (uchar*) mprDecode64Block(str, len, MPR_DECODE_TOKEQ);
+}
+
+
+/*
+    Encrypt the session ID and variables into a token for the session cookie. The payload is the null terminated
+    session ID followed by the packed session hash.
+ */
+static char *sealSessionToken(HttpStream *stream, HttpSession *sp)
+{
+    SessionKey  *sk;
+    MprBuf      *buf;
+    uchar       *token;
+    ssize       len;
+
+    if (!HTTP->sessionKeys || (sk = mprGetFirstItem(HTTP->sessionKeys)) == 0) {
+        mprLog("error http session", 0, "No session token keys defined");
+        return 0;
+    }
+    buf = mprCreateBuf(ME_BUFSIZE, -1);
+    mprPutBlockToBuf(buf, sp->id, slen(sp->id) + 1);
+    mprPackHash(buf, sp->data);
+    len = mprGetBufLength(buf);
+    if ((token = mprAlloc(TOKEN_HEADER + len)) == 0) {
+        return 0;
+    }
+    token[0] = TOKEN_VERSION;
+    putUint32(&token[1], sk->id);
+    putUint32(&token[5], (uint) (sp->expires / TPS));
+    if (mprGetRandomBytes((char*) &token[TOKEN_AAD], MPR_AEAD_NONCE, 0) < 0) {
+        return 0;
+    }
+    if (mprSealData(sk->key, &token[TOKEN_AAD], token, TOKEN_AAD, (cuchar*) mprGetBufStart(buf), len,
+            &token[TOKEN_HEADER], &token[TOKEN_AAD + MPR_AEAD_NONCE]) < 0) {
+        mprLog("error http session", 0, "Cannot encrypt session token");
+        return 0;
+    }
+    return encodeToken(token, TOKEN_HEADER + len);
+}
+
+
+/*
+    Decrypt and verify a session token. Tokens that are expired, modified or sealed with an unknown key are ignored.
+ */
+static HttpSession *openSessionToken(HttpStream *stream, cchar *cookie)
+{
+    HttpSession *sp;
+    SessionKey  *sk;
+    MprTime     expires;
+    uchar       *token;
+    char        *data;
+    ssize       len, idLen;
+
+    if (slen(cookie) > stream->limits->sessionTokenSize) {
+        httpLog(stream->trace, "session.token.error", "error", "msg:'Session token is too big'");
+        return 0;
+    }
+    if ((token = decodeToken(cookie, &len)) == 0 || len < TOKEN_HEADER || token[0] != TOKEN_VERSION) {
+        httpLog(stream->trace, "session.token.error", "error", "msg:'Bad session token'");
+        return 0;
+    }
+    expires = (MprTime) getUint32(&token[5]) * TPS;
+    if (expires <= mprGetTime()) {
+        httpLog(stream->trace, "session.token.expired", "context", "msg:'Session token has expired'");
+        return 0;
+    }
+    if ((sk = findSessionKey(getUint32(&token[1]))) == 0) {
+        httpLog(stream->trace, "session.token.error", "error", "msg:'Unknown session token key'");
+        return 0;
+    }
+    len -= TOKEN_HEADER;
+    if ((data = mprAlloc(len + 1)) == 0) {
+        return 0;
+    }
+    if (mprOpenData(sk->key, &token[TOKEN_AAD], token, TOKEN_AAD, &token[TOKEN_HEADER], len, (uchar*) data,
+            &token[TOKEN_AAD + MPR_AEAD_NONCE]) < 0) {
+        httpLog(stream->trace, "session.token.error", "error", "msg:'Session token cannot be authenticated'");
+        return 0;
+    }
+    data[len] = '\0';
+    idLen = slen(data);
+    if (idLen == 0 || idLen >= len ||
+            (sp = allocSessionObj(stream, data, &data[idLen + 1], len - idLen - 1)) == 0) {
+        httpLog(stream->trace, "session.token.error", "error", "msg:'Corrupt session token'");
+        return 0;
+    }
+    sp->expires = expires;
+    if (sk != mprGetFirstItem(HTTP->sessionKeys)) {
+        /* Reseal with the current key */
+        sp->dirty = 1;
+    }
+    return sp;
+}
+
+
+/*
+    Write the session token cookie when the session has changed or when half its lifespan has elapsed so that
+    active sessions do not expire
+ */
+static int writeSessionToken(HttpStream *stream, HttpSession *sp)
+{
+    cchar   *token;
+    MprTime now;
+
+    now = mprGetTime();
+    if (!sp->dirty && (sp->expires - now) > (sp->lifespan / 2)) {
+        return 0;
+    }
+    if (stream->tx->flags & HTTP_TX_HEADERS_CREATED) {
+        httpLog(stream->trace, "session.token.error", "error", "msg:'Cannot update session token after headers'");
+        return MPR_ERR_BAD_STATE;
+    }
+    sp->expires = now + sp->lifespan;
+    if ((token = sealSessionToken(stream, sp)) == 0) {
+        return MPR_ERR_CANT_WRITE;
+    }
+    if (slen(token) > stream->limits->sessionTokenSize) {
+        mprLog("error http session", 0, "Session token of %zd bytes exceeds the limit of %d", slen(token),
+            stream->limits->sessionTokenSize);
+        return MPR_ERR_WONT_FIT;
+    }
+    setSessionCookie(stream, token);
+    sp->dirty = 0;
+    return 0;
+}
+
+
 /*
     Create a security token to use to mitiate CSRF threats. Security tokens are expected to be sent with POST requests to
     verify the request is not being forged.
@@ -48,6 +48,11 @@ PUBLIC HttpStream *httpCreateStream(HttpNet *net, bool peerCreated)
     stream->ip = net->ip;
     stream->secure = net->secure;
     stream->peerCreated = peerCreated;
+#if ME_HTTP_HTTP2
+    stream->weight = HTTP2_DEFAULT_WEIGHT;
+    stream->urgency = HTTP2_DEFAULT_URGENCY;
+    stream->incremental = 1;
+#endif
     pickStreamNumber(stream);
 
     if (net->endpoint) {
@@ -76,6 +81,9 @@ PUBLIC HttpStream *httpCreateStream(HttpNet *net, bool peerCreated)
     stream->keepAliveCount = (net->protocol >= 2) ? 0 : stream->limits->keepAliveMax;
     stream->dispatcher = net->dispatcher;
 
+    if (httpIsServer(net) && limits->arenaSize > 0) {
+        stream->arena = mprCreateArena(limits->arenaSize);
+    }
     stream->rx = httpCreateRx(stream);
     stream->tx = httpCreateTx(stream, NULL);
 
@@ -140,6 +148,7 @@ PUBLIC void httpDestroyStream(HttpStream *stream)
         }
         stream->destroyed = 1;
         httpRemoveStream(stream->net, stream);
+        mprResetArena(stream->arena);
     }
 }
 
@@ -149,6 +158,7 @@ static void manageStream(HttpStream *stream, int flags)
     assert(stream);
 
     if (flags & MPR_MANAGE_MARK) {
+        mprMark(stream->arena);
         mprMark(stream->authType);
         mprMark(stream->authData);
         mprMark(stream->boundary);
@@ -215,6 +225,10 @@ PUBLIC void httpResetServerStream(HttpStream *stream)
     stream->user = 0;
     stream->authData = 0;
     stream->encoded = 0;
+    /*
+        Release the prior request's arena allocations in one step
+     */
+    mprResetArena(stream->arena);
     stream->rx = httpCreateRx(stream);
     stream->tx = httpCreateTx(stream, NULL);
     commonPrep(stream);
@@ -547,6 +561,8 @@ PUBLIC void httpSetTimeout(HttpStream *stream, MprTicks requestTimeout, MprTicks
             stream->net->limits->inactivityTimeout = inactivityTimeout;
         }
     }
+    httpScheduleStreamTimeout(stream);
+    httpScheduleNetTimeout(stream->net);
 }
 
 
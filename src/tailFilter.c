@@ -11,6 +11,7 @@
 /********************************** Forwards **********************************/
 
 static HttpPacket *createAltBodyPacket(HttpQueue *q);
+static bool netCanAbsorb(HttpQueue *q, HttpPacket *packet);
 static void incomingTail(HttpQueue *q, HttpPacket *packet);
 static void outgoingTail(HttpQueue *q, HttpPacket *packet);
 static void outgoingTailService(HttpQueue *q);
@@ -25,6 +26,7 @@ PUBLIC int httpOpenTailFilter()
         return MPR_ERR_CANT_CREATE;
     }
     HTTP->tailFilter = filter;
+    filter->flags |= HTTP_STAGE_ENTITY;
     filter->incoming = incomingTail;
     filter->outgoing = outgoingTail;
     filter->outgoingService = outgoingTailService;
@@ -78,7 +80,7 @@ static void outgoingTail(HttpQueue *q, HttpPacket *packet)
         }
     }
     if (packet->flags & HTTP_PACKET_DATA) {
-        tx->bytesWritten += httpGetPacketLength(packet);
+        tx->bytesWritten += httpGetPacketEntityLength(packet);
         if (tx->bytesWritten > stream->limits->txBodySize) {
             httpLimitError(stream, HTTP_CODE_REQUEST_TOO_LARGE | ((tx->bytesWritten) ? HTTP_ABORT : 0),
                 "Http transmission aborted. Exceeded transmission max body of %lld bytes", stream->limits->txBodySize);
@@ -141,7 +143,7 @@ static void outgoingTailService(HttpQueue *q)
             httpPutBackPacket(q, packet);
             return;
         }
-        if (!httpWillQueueAcceptPacket(q, q->net->outputq, packet)) {
+        if (!netCanAbsorb(q, packet)) {
             httpPutBackPacket(q, packet);
             return;
         }
@@ -150,6 +152,30 @@ static void outgoingTailService(HttpQueue *q)
 }
 
 
+static bool netCanAbsorb(HttpQueue *q, HttpPacket *packet)
+{
+#if ME_HTTP_HTTP2
+    HttpPacket  *pp;
+
+    if (q->net->protocol >= 2) {
+        /*
+            Always admit one packet per stream so the HTTP/2 scheduler can choose amongst all streams with data to send.
+            The packet is already limited to the packet size by streamCanAbsorb.
+         */
+        for (pp = q->net->outputq->first; pp; pp = pp->next) {
+            if (pp->stream == q->stream) {
+                break;
+            }
+        }
+        if (!pp) {
+            return 1;
+        }
+    }
+#endif
+    return httpWillQueueAcceptPacket(q, q->net->outputq, packet);
+}
+
+
 /*
     Create an alternate response body for error responses.
  */
@@ -669,6 +669,10 @@ PUBLIC void httpPrepareHeaders(HttpStream *stream)
     if (tx->flags & HTTP_TX_HEADERS_CREATED) {
         return;
     }
+    if (rx->session && rx->session->token) {
+        /* Token sessions are stored in the session cookie and so must be written before the headers */
+        httpWriteSession(stream);
+    }
     tx->flags |= HTTP_TX_HEADERS_CREATED;
 
     if (stream->headersCallback) {
@@ -703,7 +707,7 @@ PUBLIC void httpPrepareHeaders(HttpStream *stream)
     if (rx->flags & HTTP_HEAD) {
         stream->tx->flags |= HTTP_TX_NO_BODY;
         httpDiscardData(stream, HTTP_QUEUE_TX);
-        if (tx->chunkSize <= 0) {
+        if (tx->chunkSize <= 0 && !(tx->flags & HTTP_TX_NO_LENGTH)) {
             httpAddHeader(stream, "Content-Length", "%lld", length);
         }
 
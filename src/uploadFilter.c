@@ -27,33 +27,64 @@
     Per upload context
  */
 typedef struct Upload {
+    HttpQueue       *q;                 /* Upload queue. Cleared when the upload is closed */
     HttpUploadFile  *currentFile;       /* Current file context */
     MprFile         *file;              /* Current file I/O object */
+    MprBuf          *spool;             /* File data batched for the next write */
+    MprList         *jobs;              /* Background writes. The first is in progress */
+    ssize           pending;            /* Bytes waiting in background writes */
+    bool            inputPaused;        /* Reading is paused until background writes catch up */
+    bool            preallocated;       /* Current file space was preallocated */
     char            *boundary;          /* Boundary signature */
     ssize           boundaryLen;        /* Length of boundary */
+    int             skip[256];          /* Boyer-Moore-Horspool shift for each byte under the boundary end */
     int             contentState;       /* Input states */
     char            *clientFilename;    /* Current file filename */
     char            *tmpPath;           /* Current temp filename for upload data */
     char            *name;              /* Form field name keyword value */
 } Upload;
 
+/*
+    Batch of file data written by a worker thread so disk I/O does not stall the stream dispatcher
+ */
+typedef struct UploadJob {
+    Upload          *up;                /* Owning upload */
+    MprDispatcher   *dispatcher;        /* Stream dispatcher to notify when written */
+    MprFile         *file;              /* File to write */
+    MprBuf          *buf;               /* File data */
+    MprOff          size;               /* Final file size when closing */
+    ssize           len;                /* Length of data to write */
+    int             error;              /* OS error if the write failed */
+    bool            close;              /* Close the file after writing */
+    bool            failed;             /* Write failed */
+    bool            truncate;           /* Trim preallocated file space when closing */
+} UploadJob;
+
 /********************************** Forwards **********************************/
 
 static void addUploadFile(HttpStream *stream, HttpUploadFile *upfile);
 static Upload *allocUpload(HttpQueue *q);
 static void cleanUploadedFiles(HttpStream *stream);
 static void closeUpload(HttpQueue *q);
-static char *getBoundary(char *buf, ssize bufLen, char *boundary, ssize boundaryLen, bool *pureData);
+static char *findBoundary(Upload *up, char *buf, ssize bufLen, ssize *retain);
 static cchar *getUploadDir(HttpStream *stream);
 static void incomingUpload(HttpQueue *q, HttpPacket *packet);
+static void initBoundary(Upload *up);
 static void manageHttpUploadFile(HttpUploadFile *file, int flags);
 static void manageUpload(Upload *up, int flags);
+static void manageUploadJob(UploadJob *job, int flags);
 static int openUpload(HttpQueue *q);
 static int  processUploadBoundary(HttpQueue *q, char *line);
 static int  processUploadHeader(HttpQueue *q, char *line);
 static int  processUploadData(HttpQueue *q);
+static int queueWrite(HttpQueue *q, bool close);
 static void renameUploadedFiles(HttpStream *stream);
+static void resumeUpload(HttpQueue *q);
 static void  startUpload(HttpQueue *q);
+static void uploadWorker(UploadJob *job, MprWorker *worker);
+static void uploadWritten(UploadJob *job, MprEvent *event);
+static void writeFailed(HttpStream *stream, UploadJob *job);
+static void writeJob(UploadJob *job);
 
 /************************************* Code ***********************************/
 
@@ -91,6 +122,8 @@ static Upload *allocUpload(HttpQueue *q)
         return 0;
     }
     q->queueData = up;
+    up->q = q;
+    up->jobs = mprCreateList(0, 0);
     up->contentState = HTTP_UPLOAD_BOUNDARY;
 
     uploadDir = getUploadDir(stream);
@@ -105,15 +138,36 @@ static Upload *allocUpload(HttpQueue *q)
         httpError(stream, HTTP_CODE_BAD_REQUEST, "Bad boundary");
         return 0;
     }
+    initBoundary(up);
     return up;
 }
 
 
+/*
+    Compute the Boyer-Moore-Horspool shift table. Bytes not in the boundary shift by the full boundary length.
+ */
+static void initBoundary(Upload *up)
+{
+    ssize   i, last;
+
+    last = up->boundaryLen - 1;
+    for (i = 0; i < 256; i++) {
+        up->skip[i] = (int) up->boundaryLen;
+    }
+    for (i = 0; i < last; i++) {
+        up->skip[(uchar) up->boundary[i]] = (int) (last - i);
+    }
+}
+
+
 static void manageUpload(Upload *up, int flags)
 {
     if (flags & MPR_MANAGE_MARK) {
+        mprMark(up->q);
         mprMark(up->currentFile);
         mprMark(up->file);
+        mprMark(up->spool);
+        mprMark(up->jobs);
         mprMark(up->boundary);
         mprMark(up->clientFilename);
         mprMark(up->tmpPath);
@@ -122,6 +176,17 @@ static void manageUpload(Upload *up, int flags)
 }
 
 
+static void manageUploadJob(UploadJob *job, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(job->up);
+        mprMark(job->dispatcher);
+        mprMark(job->file);
+        mprMark(job->buf);
+    }
+}
+
+
 static void freeUpload(HttpQueue *q)
 {
     HttpUploadFile  *file;
@@ -132,6 +197,15 @@ static void freeUpload(HttpQueue *q)
             file = up->currentFile;
             file->filename = 0;
         }
+        /*
+            Writes still in progress complete on their worker, but their results are ignored
+         */
+        resumeUpload(q);
+        up->q = 0;
+        up->spool = 0;
+        if (q->stream->rx) {
+            q->stream->rx->uploadPending = 0;
+        }
         q->queueData = 0;
     }
 }
@@ -396,6 +470,16 @@ static int processUploadHeader(HttpQueue *q, char *line)
                     httpError(stream, HTTP_CODE_INTERNAL_SERVER_ERROR, "Cannot open upload temp file %s", up->tmpPath);
                     return MPR_ERR_BAD_STATE;
                 }
+                up->preallocated = 0;
+#if LINUX
+                /*
+                    Reserve space for the remaining body so large uploads are not fragmented on disk.
+                    The file is trimmed to the actual size when closed.
+                 */
+                if (stream->rx->length > ME_MAX_UPLOAD_SPOOL) {
+                    up->preallocated = fallocate(up->file->fd, 0, 0, stream->rx->remainingContent + q->count) == 0;
+                }
+#endif
                 /*
                     Create the files[id]
                  */
@@ -462,7 +546,7 @@ static int writeToFile(HttpQueue *q, char *data, ssize len)
     HttpUploadFile  *file;
     HttpLimits      *limits;
     Upload          *up;
-    ssize           rc;
+    ssize           count;
 
     stream = q->stream;
     limits = stream->limits;
@@ -477,23 +561,193 @@ static int writeToFile(HttpQueue *q, char *data, ssize len)
             limits->uploadSize);
         return MPR_ERR_CANT_WRITE;
     }
-    if (len > 0) {
-        /*
-            File upload. Write the file data.
-         */
-        rc = mprWriteFile(up->file, data, len);
-        if (rc != len) {
-            httpError(stream, HTTP_CODE_INTERNAL_SERVER_ERROR,
-                "Cannot write to upload temp file %s, rc %zd, errno %d", up->tmpPath, rc, mprGetOsError());
+    file->size += len;
+    stream->rx->bytesUploaded += len;
+
+    /*
+        Batch the file data into spool buffers. Full buffers are written to disk by a worker thread.
+     */
+    while (len > 0) {
+        if (up->spool == 0) {
+            up->spool = mprCreateBuf(ME_MAX_UPLOAD_SPOOL, -1);
+        }
+        count = min(len, mprGetBufSpace(up->spool));
+        mprPutBlockToBuf(up->spool, data, count);
+        data += count;
+        len -= count;
+        if (mprGetBufSpace(up->spool) == 0 && queueWrite(q, 0) < 0) {
             return MPR_ERR_CANT_WRITE;
         }
-        file->size += len;
-        stream->rx->bytesUploaded += len;
     }
     return 0;
 }
 
 
+/*
+    Write the spooled data and optionally close the file. For HTTP/1, the write is done by a worker thread and
+    reading from the network is paused if the disk falls behind. HTTP/2 streams share the connection and cannot be
+    individually paused, so they write synchronously as do all requests when no worker is available.
+ */
+static int queueWrite(HttpQueue *q, bool close)
+{
+    HttpStream  *stream;
+    HttpNet     *net;
+    Upload      *up;
+    UploadJob   *job;
+
+    stream = q->stream;
+    net = q->net;
+    up = q->queueData;
+
+    if ((job = mprAllocObj(UploadJob, manageUploadJob)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    job->up = up;
+    job->dispatcher = stream->dispatcher;
+    job->file = up->file;
+    job->buf = up->spool;
+    job->len = up->spool ? mprGetBufLength(up->spool) : 0;
+    job->size = up->currentFile->size;
+    job->close = close;
+    job->truncate = close && up->preallocated;
+    up->spool = 0;
+
+    if (net->protocol < 2) {
+        if (mprGetListLength(up->jobs) > 0 || mprStartWorker((MprWorkerProc) uploadWorker, job) == 0) {
+            mprAddItem(up->jobs, job);
+            up->pending += job->len;
+            stream->rx->uploadPending = 1;
+            if (up->pending > ME_MAX_UPLOAD_SPOOL && !up->inputPaused) {
+                up->inputPaused = 1;
+                net->readBlocked = 1;
+            }
+            return 0;
+        }
+    }
+    writeJob(job);
+    if (job->failed) {
+        writeFailed(stream, job);
+        return MPR_ERR_CANT_WRITE;
+    }
+    return 0;
+}
+
+
+/*
+    Fail the request when upload data cannot be written. The rest of the body is not read, so abort the connection
+    rather than wait for input that will never be consumed.
+ */
+static void writeFailed(HttpStream *stream, UploadJob *job)
+{
+    httpError(stream, HTTP_ABORT | HTTP_CODE_INTERNAL_SERVER_ERROR,
+        "Cannot write to upload temp file %s, errno %d", job->file->path, job->error);
+}
+
+
+/*
+    Write a batch of file data. This may run on a worker thread and must only access the job.
+ */
+static void writeJob(UploadJob *job)
+{
+    if (job->len > 0 && mprWriteFile(job->file, mprGetBufStart(job->buf), job->len) != job->len) {
+        job->failed = 1;
+        job->error = mprGetOsError();
+    }
+    if (job->close) {
+#if LINUX
+        if (job->truncate && ftruncate(job->file->fd, job->size) < 0 && !job->failed) {
+            job->failed = 1;
+            job->error = mprGetOsError();
+        }
+#endif
+        mprCloseFile(job->file);
+    }
+}
+
+
+/*
+    Worker thread to write upload data. Stay yielded while blocked on disk I/O so the garbage collector is not delayed.
+ */
+static void uploadWorker(UploadJob *job, MprWorker *worker)
+{
+    mprYield(MPR_YIELD_STICKY);
+    writeJob(job);
+    mprResetYield();
+    mprCreateEvent(job->dispatcher, "uploadWritten", 0, uploadWritten, job, 0);
+}
+
+
+/*
+    Runs on the stream dispatcher when a background write completes. Start the next write, resume reading
+    and once all data is on disk, let the request proceed.
+ */
+static void uploadWritten(UploadJob *job, MprEvent *event)
+{
+    HttpQueue   *q;
+    HttpStream  *stream;
+    Upload      *up;
+    UploadJob   *next;
+
+    up = job->up;
+    mprRemoveItem(up->jobs, job);
+    up->pending -= job->len;
+
+    if ((q = up->q) == 0) {
+        /* Upload closed */
+        return;
+    }
+    stream = q->stream;
+    if (job->failed) {
+        writeFailed(stream, job);
+        mprClearList(up->jobs);
+        up->pending = 0;
+
+    } else if ((next = mprGetFirstItem(up->jobs)) != 0 && mprStartWorker((MprWorkerProc) uploadWorker, next) < 0) {
+        /*
+            No worker available. Write the backlog here rather than stall the upload.
+         */
+        while ((next = mprGetFirstItem(up->jobs)) != 0) {
+            writeJob(next);
+            mprRemoveItem(up->jobs, next);
+            up->pending -= next->len;
+            if (next->failed) {
+                writeFailed(stream, next);
+                mprClearList(up->jobs);
+                up->pending = 0;
+                break;
+            }
+        }
+    }
+    if (up->pending <= ME_MAX_UPLOAD_SPOOL) {
+        resumeUpload(q);
+    }
+    if (mprGetListLength(up->jobs) == 0 && stream->rx->uploadPending) {
+        stream->rx->uploadPending = 0;
+        httpProcess(stream->inputq);
+    }
+}
+
+
+/*
+    Resume reading the request body from the client
+ */
+static void resumeUpload(HttpQueue *q)
+{
+    HttpNet     *net;
+    Upload      *up;
+
+    up = q->queueData;
+    if (up->inputPaused) {
+        up->inputPaused = 0;
+        net = q->net;
+        if (!net->destroyed) {
+            net->readBlocked = 0;
+            httpEnableNetEvents(net);
+        }
+    }
+}
+
+
 /*
     Process the content data.
     Returns < 0 on error
@@ -506,8 +760,7 @@ static int processUploadData(HttpQueue *q)
     HttpPacket      *packet;
     MprBuf          *content;
     Upload          *up;
-    ssize           size, dataLen;
-    bool            pureData;
+    ssize           size, dataLen, retain;
     char            *data, *bp, *key;
 
     stream = q->stream;
@@ -520,14 +773,15 @@ static int processUploadData(HttpQueue *q)
         /*  Incomplete boundary. Return and get more data */
         return 0;
     }
-    bp = getBoundary(mprGetBufStart(content), size, up->boundary, up->boundaryLen, &pureData);
+    bp = findBoundary(up, mprGetBufStart(content), size, &retain);
     if (bp == 0) {
         if (up->clientFilename) {
             /*
-                No signature found yet. probably more data to come. Must handle split boundaries.
+                No signature found yet. probably more data to come. Retain a trailing partial boundary so a boundary
+                split across packets is matched when the next packet arrives.
              */
             data = mprGetBufStart(content);
-            dataLen = pureData ? size : (size - (up->boundaryLen - 1));
+            dataLen = size - retain;
             if (dataLen > 0) {
                 if (writeToFile(q, mprGetBufStart(content), dataLen) < 0) {
                     return MPR_ERR_CANT_WRITE;
@@ -582,9 +836,11 @@ static int processUploadData(HttpQueue *q)
     }
     if (up->clientFilename) {
         /*
-            Now have all the data (we've seen the boundary)
+            Now have all the data (we've seen the boundary). The file is closed after the last data is written.
          */
-        mprCloseFile(up->file);
+        if (queueWrite(q, 1) < 0) {
+            return MPR_ERR_CANT_WRITE;
+        }
         up->file = 0;
         up->clientFilename = 0;
     }
@@ -597,36 +853,37 @@ static int processUploadData(HttpQueue *q)
 
 
 /*
-    Find the boundary signature in memory. Returns pointer to the first match.
+    Find the boundary signature in memory using Boyer-Moore-Horspool. Returns pointer to the first match.
+    The window shifts on the byte under the last boundary byte, so runs of dashes in the data do not force a compare
+    at every byte. If not found, set *retain to the length of the longest buffer suffix that is a boundary prefix.
+    Only that suffix need be kept and rescanned when more data arrives.
  */
-static char *getBoundary(char *buf, ssize bufLen, char *boundary, ssize boundaryLen, bool *pureData)
+static char *findBoundary(Upload *up, char *buf, ssize bufLen, ssize *retain)
 {
-    char    *cp, *endp;
-    char    first;
+    uchar   *boundary, *cp, *endp;
+    ssize   last, len;
+    uchar   lastc;
 
     assert(buf);
-    assert(boundary);
-    assert(boundaryLen > 0);
+    assert(up->boundaryLen > 0);
 
-    first = *boundary & 0xff;
-    endp = &buf[bufLen];
+    boundary = (uchar*) up->boundary;
+    last = up->boundaryLen - 1;
+    lastc = boundary[last];
+    endp = (uchar*) &buf[bufLen];
 
-    for (cp = buf; cp < endp; cp++) {
-        if ((cp = memchr(cp, first, endp - cp)) == 0) {
-            *pureData = 1;
-            return 0;
+    for (cp = (uchar*) buf; (endp - cp) > last; cp += up->skip[cp[last]]) {
+        if (cp[last] == lastc && memcmp(cp, boundary, last) == 0) {
+            *retain = 0;
+            return (char*) cp;
         }
-        /* Potential boundary */
-        if ((endp - cp) < boundaryLen) {
-            *pureData = 0;
-            return 0;
-        }
-        if (memcmp(cp, boundary, boundaryLen) == 0) {
-            *pureData = 0;
-            return cp;
+    }
+    for (len = min(last, bufLen); len > 0; len--) {
+        if (memcmp(&buf[bufLen - len], boundary, len) == 0) {
+            break;
         }
     }
-    *pureData = 0;
+    *retain = len;
     return 0;
 }
 
@@ -643,6 +900,10 @@ static void addUploadFile(HttpStream *stream, HttpUploadFile *upfile)
 }
 
 
+/*
+    Remove the uploaded files when the request completes. Requests that fail before the body is received are not
+    routed and the handler has not seen the files, so always remove them.
+ */
 static void cleanUploadedFiles(HttpStream *stream)
 {
     HttpRx          *rx;
@@ -652,8 +913,8 @@ static void cleanUploadedFiles(HttpStream *stream)
     rx = stream->rx;
 
     for (ITERATE_ITEMS(rx->files, file, index)) {
-        if (file->filename && rx->route) {
-            if (rx->route->autoDelete && !rx->route->renameUploads) {
+        if (file->filename) {
+            if (!rx->route || (rx->route->autoDelete && !rx->route->renameUploads)) {
                 mprDeletePath(file->filename);
             }
             file->filename = 0;
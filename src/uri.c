@@ -36,14 +36,20 @@ static char *actionRoute(HttpRoute *route, cchar *controller, cchar *action);
     Missing fields are null or zero.
  */
 PUBLIC HttpUri *httpCreateUri(cchar *uri, int flags)
+{
+    return httpCreateUriInArena(NULL, uri, flags);
+}
+
+
+PUBLIC HttpUri *httpCreateUriInArena(MprArena *arena, cchar *uri, int flags)
 {
     HttpUri     *up;
     char        *tok, *next;
 
-    if ((up = mprAllocObj(HttpUri, manageUri)) == 0) {
+    if ((up = mprArenaAllocObj(arena, HttpUri, manageUri)) == 0) {
         return 0;
     }
-    tok = sclone(uri);
+    tok = mprArenaClone(arena, uri, -1);
 
     /*
         [scheme://][hostname[:port]][/path[.ext]][#ref][?query]
@@ -51,18 +57,18 @@ PUBLIC HttpUri *httpCreateUri(cchar *uri, int flags)
      */
     if ((next = schr(tok, '?')) != 0) {
         *next++ = '\0';
-        up->query = sclone(next);
+        up->query = mprArenaClone(arena, next, -1);
     }
     if ((next = schr(tok, '#')) != 0) {
         *next++ = '\0';
-        up->reference = sclone(next);
+        up->reference = mprArenaClone(arena, next, -1);
     }
 
     /*
         [scheme://][hostname[:port]][/path]
      */
     if ((next = scontains(tok, "://")) != 0) {
-        up->scheme = snclone(tok, (next - tok));
+        up->scheme = mprArenaClone(arena, tok, (next - tok));
         if (smatch(up->scheme, "http")) {
             if (flags & HTTP_COMPLETE_URI) {
                 up->port = 80;
@@ -92,7 +98,7 @@ PUBLIC HttpUri *httpCreateUri(cchar *uri, int flags)
      */
     if (*tok == '[' && ((next = strchr(tok, ']')) != 0)) {
         /* IPv6  [::]:port/uri */
-        up->host = snclone(&tok[1], (next - tok) - 1);
+        up->host = mprArenaClone(arena, &tok[1], (next - tok) - 1);
         tok = ++next;
 
     } else if (*tok && *tok != '/' && *tok != ':' && (up->scheme || strchr(tok, ':'))) {
@@ -104,7 +110,7 @@ PUBLIC HttpUri *httpCreateUri(cchar *uri, int flags)
         if ((next = spbrk(tok, ":/")) == 0) {
             next = &tok[slen(tok)];
         }
-        up->host = snclone(tok, next - tok);
+        up->host = mprArenaClone(arena, tok, next - tok);
         tok = next;
     }
     assert(tok);
@@ -123,23 +129,23 @@ PUBLIC HttpUri *httpCreateUri(cchar *uri, int flags)
 
     /* [/path] */
     if (*tok) {
-        up->path = sclone(tok);
+        up->path = mprArenaClone(arena, tok, -1);
         /* path[.ext[/extra]] */
         if ((tok = srchr(up->path, '.')) != 0) {
             if (tok[1]) {
                 if ((next = srchr(up->path, '/')) != 0) {
                     if (next < tok) {
-                        up->ext = sclone(++tok);
+                        up->ext = mprArenaClone(arena, ++tok, -1);
                     }
                 } else {
-                    up->ext = sclone(++tok);
+                    up->ext = mprArenaClone(arena, ++tok, -1);
                 }
             }
         }
     }
     if (flags & (HTTP_COMPLETE_URI | HTTP_COMPLETE_URI_PATH)) {
         if (up->path == 0 || *up->path == '\0') {
-            up->path = sclone("/");
+            up->path = mprArenaClone(arena, "/", -1);
         }
     }
 #if UNUSED
@@ -149,10 +155,10 @@ PUBLIC HttpUri *httpCreateUri(cchar *uri, int flags)
 
     if (flags & HTTP_COMPLETE_URI) {
         if (!up->scheme) {
-            up->scheme = sclone("http");
+            up->scheme = mprArenaClone(arena, "http", -1);
         }
         if (!up->host) {
-            up->host = sclone("localhost");
+            up->host = mprArenaClone(arena, "localhost", -1);
         }
         if (!up->port) {
             up->port = up->secure ? 443 : 80;
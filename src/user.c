@@ -180,6 +180,7 @@ PUBLIC HttpUser *httpAddUser(HttpAuth *auth, cchar *name, cchar *password, cchar
         user->name = sclone(name);
     }
     user->password = sclone(password);
+    httpFlushCredentials();
     if (roles) {
         user->roles = sclone(roles);
         httpComputeUserAbilities(auth, user);
@@ -203,6 +204,7 @@ PUBLIC int httpRemoveUser(HttpAuth *auth, cchar *name)
         return MPR_ERR_CANT_ACCESS;
     }
     mprRemoveKey(auth->userCache, name);
+    httpFlushCredentials();
     return 0;
 }
 
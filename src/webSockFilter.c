@@ -9,6 +9,22 @@
 #include    "http.h"
 
 #if ME_HTTP_WEB_SOCKETS
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ME_HTTP_SSE2 1
+    #include    <emmintrin.h>
+#endif
+#if ME_HTTP_SSE2 && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    /*
+        AVX2 is compiled for a target attribute and selected at runtime if the CPU supports it
+     */
+    #define ME_HTTP_AVX2 1
+    #include    <immintrin.h>
+#endif
+#if ME_HTTP_COMPRESS
+    #include    <zlib.h>
+#endif
+
 /********************************** Locals ************************************/
 /*
     Message frame states
@@ -64,10 +80,67 @@ static char *codetxt[16] = {
 #define GET_LEN(v)              ((v) & 0x7f)                /* Low order 7 bits of length */
 
 #define SET_FIN(v)              (((v) & 0x1) << 7)
+#define SET_RSV(v)              (((v) & 0x7) << 4)
 #define SET_MASK(v)             (((v) & 0x1) << 7)
 #define SET_CODE(v)             ((v) & 0xf)
 #define SET_LEN(len, n)         ((uchar)(((len) >> ((n) * 8)) & 0xff))
 
+#define WS_RSV_DEFLATE          0x4                         /* RSV1 marks a permessage-deflate message */
+#define WS_MAX_HEADER           14                          /* Maximum frame header size with length and mask */
+#define WS_BROADCAST_RETRY      20                          /* Msec to wait for a slow coalescing subscriber */
+
+/*
+    Broadcast group subscriber. Frames are shared, encoded messages waiting for delivery on the stream dispatcher.
+    All fields are guarded by the group mutex.
+ */
+typedef struct Subscriber {
+    HttpBroadcast   *group;                 /* Owning broadcast group */
+    HttpStream      *stream;                /* Subscribed WebSocket stream */
+    MprDispatcher   *dispatcher;            /* Stream dispatcher for delivery */
+    MprList         *frames;                /* Undelivered shared frames */
+    ssize           pending;                /* Length of undelivered frames */
+    ssize           backlog;                /* Stream write backlog when last delivered */
+    bool            scheduled;              /* Delivery event is scheduled */
+    bool            closed;                 /* Subscriber has left the group */
+    bool            disconnect;             /* Disconnect the stream on the next delivery */
+} Subscriber;
+
+#if ME_HTTP_COMPRESS
+/*
+    RFC 7692 permessage-deflate. Messages are compressed as raw deflate data with a sync flush per frame.
+    The trailing empty block (0x00 0x00 0xff 0xff) is removed from the last frame of each message.
+ */
+#define WS_DEFLATE_MIN_BITS     9                           /* Zlib cannot produce raw deflate with an 8 bit window */
+#define WS_DEFLATE_MAX_BITS     15
+#define WS_DEFLATE_MIN_SIZE     32                          /* Smaller single frame messages are not compressed */
+#define WS_DEFLATE_TRAILER      "\x00\x00\xff\xff"
+
+typedef struct WebSocketDeflate {
+    z_stream        tx;                     /* Compression state for outgoing messages */
+    z_stream        rx;                     /* Decompression state for incoming messages */
+    int             txBits;                 /* Compression window bits */
+    int             rxBits;                 /* Decompression window bits */
+    int             memLevel;               /* Compression memory level */
+    bool            txActive;               /* Compression state initialized */
+    bool            rxActive;               /* Decompression state initialized */
+    bool            txNoContext;            /* Reset compression after each message */
+    bool            rxNoContext;            /* Reset decompression after each message */
+    bool            txMessage;              /* Current outgoing message is compressed */
+    bool            rxMessage;              /* Current incoming message is compressed */
+} WebSocketDeflate;
+
+/*
+    Parsed permessage-deflate extension parameters
+ */
+typedef struct DeflateParams {
+    int             serverBits;             /* server_max_window_bits value. Zero if absent */
+    int             clientBits;             /* client_max_window_bits value. Zero if absent or no value */
+    bool            clientBitsOffered;      /* client_max_window_bits present */
+    bool            serverNoContext;        /* server_no_context_takeover present */
+    bool            clientNoContext;        /* client_no_context_takeover present */
+} DeflateParams;
+#endif
+
 /*
     Copyright (c) 2008-2009 Bjoern Hoehrmann <bjoern@hoehrmann.de>
     See http://bjoern.hoehrmann.de/utf-8/decoder/dfa/ for details.
@@ -95,20 +168,43 @@ static const uchar utfTable[] = {
 /********************************** Forwards **********************************/
 
 static void closeWebSock(HttpQueue *q);
+static void deliverBroadcast(Subscriber *sp, MprEvent *event);
+static ssize encodeFrameHeader(char *prefix, int last, int rsv, int type, ssize len, cuchar *mask);
 static void incomingWebSockData(HttpQueue *q, HttpPacket *packet);
+static void manageBroadcast(HttpBroadcast *group, int flags);
+static void manageSubscriber(Subscriber *sp, int flags);
 static void manageWebSocket(HttpWebSocket *ws, int flags);
+static uchar *maskWords(uchar *cp, uchar *end, cuchar *pattern);
 static int matchWebSock(HttpStream *stream, HttpRoute *route, int dir);
 static int openWebSock(HttpQueue *q);
 static void outgoingWebSockService(HttpQueue *q);
 static int processFrame(HttpQueue *q, HttpPacket *packet);
 static void readyWebSock(HttpQueue *q);
+static void scheduleDelivery(Subscriber *sp, MprTicks delay);
 static int validUTF8(HttpStream *stream, cchar *str, ssize len);
 static bool validateText(HttpStream *stream, HttpPacket *packet);
 static void webSockPing(HttpStream *stream);
 static void webSockTimeout(HttpStream *stream);
 
+#if ME_HTTP_COMPRESS
+static void acceptDeflate(HttpStream *stream, HttpWebSocket *ws, cchar *offers);
+static bool confirmDeflate(HttpStream *stream, cchar *response);
+static WebSocketDeflate *createDeflate(int txBits, int memLevel, int rxBits);
+static int deflatePacket(HttpQueue *q, HttpPacket *packet);
+static void endDeflate(WebSocketDeflate *wd);
+static bool fitDeflate(ssize limit, int *txBits, int *memLevel, int *rxBits, bool lowerRx);
+static int inflateFrame(HttpQueue *q, HttpPacket *packet);
+static void manageDeflate(WebSocketDeflate *wd, int flags);
+static void offerDeflate(HttpStream *stream);
+static bool parseDeflateParams(char *params, DeflateParams *dp);
+#endif
+
 static void traceErrorProc(HttpStream *stream, cchar *fmt, ...);
 
+#if ME_HTTP_AVX2
+static int useAvx2;
+#endif
+
 #define traceError(stream, ...) \
     if (stream->http->traceLevel > 0 && PTOI(mprLookupKey(stream->trace->events, "error")) <= stream->http->traceLevel) { \
         traceErrorProc(stream, __VA_ARGS__); \
@@ -132,6 +228,10 @@ PUBLIC int httpOpenWebSockFilter()
     filter->close = closeWebSock;
     filter->outgoingService = outgoingWebSockService;
     filter->incoming = incomingWebSockData;
+#if ME_HTTP_AVX2
+    __builtin_cpu_init();
+    useAvx2 = __builtin_cpu_supports("avx2");
+#endif
     return 0;
 }
 
@@ -229,6 +329,11 @@ static int matchWebSock(HttpStream *stream, HttpRoute *route, int dir)
         if (ws->subProtocol && *ws->subProtocol) {
             httpSetHeaderString(stream, "Sec-WebSocket-Protocol", ws->subProtocol);
         }
+#if ME_HTTP_COMPRESS
+        if (route->flags & HTTP_ROUTE_WEB_SOCKETS_DEFLATE) {
+            acceptDeflate(stream, ws, httpGetHeader(stream, "sec-websocket-extensions"));
+        }
+#endif
 #if !ME_HTTP_WEB_SOCKETS_STEALTH
         httpSetHeader(stream, "X-Request-Timeout", "%lld", stream->limits->requestTimeout / TPS);
         httpSetHeader(stream, "X-Inactivity-Timeout", "%lld", stream->limits->inactivityTimeout / TPS);
@@ -284,6 +389,8 @@ static void manageWebSocket(HttpWebSocket *ws, int flags)
         mprMark(ws->errorMsg);
         mprMark(ws->closeReason);
         mprMark(ws->data);
+        mprMark(ws->deflate);
+        mprMark(ws->broadcasts);
     }
 }
 
@@ -291,6 +398,7 @@ static void manageWebSocket(HttpWebSocket *ws, int flags)
 static void closeWebSock(HttpQueue *q)
 {
     HttpWebSocket   *ws;
+    HttpBroadcast   *group;
 
     if (q->stream && q->stream->rx) {
         ws = q->stream->rx->webSocket;
@@ -301,6 +409,14 @@ static void closeWebSock(HttpQueue *q)
                 mprRemoveEvent(ws->pingEvent);
                 ws->pingEvent = 0;
            }
+#if ME_HTTP_COMPRESS
+            if (ws->deflate) {
+                endDeflate(ws->deflate);
+            }
+#endif
+            while (ws->broadcasts && (group = mprGetFirstItem(ws->broadcasts)) != 0) {
+                httpLeaveBroadcast(group, q->stream);
+            }
         }
     }
 }
@@ -321,9 +437,9 @@ static void incomingWebSockData(HttpQueue *q, HttpPacket *packet)
     HttpPacket      *tail;
     HttpLimits      *limits;
     MprBuf          *content;
-    char            *fp, *cp;
+    char            *fp;
     ssize           len, currentFrameLen, offset, frameLen;
-    int             i, error, mask, lenBytes, opcode;
+    int             i, error, mask, lenBytes, opcode, rsv;
 
     assert(packet);
     stream = q->stream;
@@ -374,13 +490,21 @@ static void incomingWebSockData(HttpQueue *q, HttpPacket *packet)
                 return;
             }
             fp = content->start;
-            if (GET_RSV(*fp) != 0) {
+            rsv = GET_RSV(*fp);
+            packet->last = GET_FIN(*fp);
+            opcode = GET_CODE(*fp);
+#if ME_HTTP_COMPRESS
+            if (ws->deflate && (opcode == WS_MSG_TEXT || opcode == WS_MSG_BINARY)) {
+                /* RSV1 on the first frame marks a compressed message */
+                ((WebSocketDeflate*) ws->deflate)->rxMessage = (rsv & WS_RSV_DEFLATE) ? 1 : 0;
+                rsv &= ~WS_RSV_DEFLATE;
+            }
+#endif
+            if (rsv != 0) {
                 error = WS_STATUS_PROTOCOL_ERROR;
                 traceError(stream, "Protocol error, bad reserved field");
                 break;
             }
-            packet->last = GET_FIN(*fp);
-            opcode = GET_CODE(*fp);
             if (opcode == WS_MSG_CONT) {
                 if (!ws->currentMessageType) {
                     traceError(stream, "Protocol error, continuation frame but not prior message");
@@ -473,9 +597,8 @@ static void incomingWebSockData(HttpQueue *q, HttpPacket *packet)
                 break;
             }
             if (ws->maskOffset >= 0) {
-                for (cp = content->start; cp < content->end; cp++) {
-                    *cp = *cp ^ ws->dataMask[ws->maskOffset++ & 0x3];
-                }
+                ws->maskOffset = httpMaskWebSocketData(content->start, mprGetBufLength(content), ws->dataMask,
+                    ws->maskOffset);
             }
             if (packet->type == WS_MSG_CONT && ws->currentFrame) {
                 httpJoinPacket(ws->currentFrame, packet);
@@ -499,6 +622,13 @@ static void incomingWebSockData(HttpQueue *q, HttpPacket *packet)
             frameLen = httpGetPacketLength(packet);
             assert(frameLen <= ws->frameLength);
             if (frameLen == ws->frameLength) {
+#if ME_HTTP_COMPRESS
+                if (ws->deflate && packet->type < WS_MSG_CONTROL && ((WebSocketDeflate*) ws->deflate)->rxMessage) {
+                    if ((error = inflateFrame(q, packet)) != 0) {
+                        break;
+                    }
+                }
+#endif
                 if ((error = processFrame(q, packet)) != 0) {
                     break;
                 }
@@ -876,14 +1006,26 @@ static void outgoingWebSockService(HttpQueue *q)
     HttpStream      *stream;
     HttpPacket      *packet, *tail;
     HttpWebSocket   *ws;
-    char            *ep, *fp, *prefix, dataMask[4];
+    uchar           dataMask[4];
     ssize           len;
-    int             i, mask;
+    int             rsv;
 
     stream = q->stream;
     ws = stream->rx->webSocket;
     for (packet = httpGetPacket(q); packet; packet = httpGetPacket(q)) {
-        if (!(packet->flags & (HTTP_PACKET_END | HTTP_PACKET_HEADER))) {
+        if (packet->flags & HTTP_PACKET_FRAMED) {
+            /*
+                Shared broadcast frames are already encoded. Pass through whole without splitting.
+             */
+            if (q->nextQ->count > 0 && !httpWillNextQueueAcceptSize(q, httpGetPacketLength(packet))) {
+                httpPutBackPacket(q, packet);
+                return;
+            }
+            httpLogPacket(stream->trace, "websockets.tx.packet", "packet", 0, packet,
+                "wsSeqno:%d, wsTypeName:\"%s\", wsType:%d, wsLast:%d, wsLength:%zd, broadcast:1",
+                ws->txSeq++, codetxt[packet->type], packet->type, packet->last, httpGetPacketLength(packet));
+
+        } else if (!(packet->flags & (HTTP_PACKET_END | HTTP_PACKET_HEADER))) {
             if (!(packet->flags & HTTP_PACKET_SOLO)) {
                 if (packet->esize > stream->limits->packetSize) {
                     if ((tail = httpResizePacket(q, packet, stream->limits->packetSize)) != 0) {
@@ -900,39 +1042,28 @@ static void outgoingWebSockService(HttpQueue *q)
                 httpError(stream, HTTP_CODE_INTERNAL_SERVER_ERROR, "Bad WebSocket packet type %d", packet->type);
                 break;
             }
+            rsv = 0;
+#if ME_HTTP_COMPRESS
+            if (ws->deflate && packet->type < WS_MSG_CONTROL && (rsv = deflatePacket(q, packet)) < 0) {
+                httpError(stream, HTTP_CODE_INTERNAL_SERVER_ERROR, "Cannot compress WebSocket message");
+                break;
+            }
+#endif
             len = httpGetPacketLength(packet);
             packet->prefix = mprCreateBuf(16, 16);
-            prefix = packet->prefix->start;
             /*
                 Server-side does not mask outgoing data
              */
-            mask = httpServerStream(stream) ? 0 : 1;
-            *prefix++ = SET_FIN(packet->last) | SET_CODE(packet->type);
-            if (len <= WS_MAX_CONTROL) {
-                *prefix++ = SET_MASK(mask) | SET_LEN(len, 0);
-            } else if (len <= 65535) {
-                *prefix++ = SET_MASK(mask) | 126;
-                *prefix++ = SET_LEN(len, 1);
-                *prefix++ = SET_LEN(len, 0);
-            } else {
-                *prefix++ = SET_MASK(mask) | 127;
-                for (i = 7; i >= 0; i--) {
-                    *prefix++ = SET_LEN(len, i);
-                }
-            }
             if (httpClientStream(stream)) {
-                mprGetRandomBytes(dataMask, sizeof(dataMask), 0);
-                for (i = 0; i < 4; i++) {
-                    *prefix++ = dataMask[i];
-                }
-                fp = packet->content->start;
-                ep = packet->content->end;
-                for (i = 0; fp < ep; fp++) {
-                    *fp = *fp ^ dataMask[i++ & 0x3];
-                }
+                mprGetRandomBytes((char*) dataMask, sizeof(dataMask), 0);
+                mprAdjustBufEnd(packet->prefix,
+                    encodeFrameHeader(packet->prefix->start, packet->last, rsv, packet->type, len, dataMask));
+                httpMaskWebSocketData(packet->content->start, len, dataMask, 0);
+            } else {
+                mprAdjustBufEnd(packet->prefix,
+                    encodeFrameHeader(packet->prefix->start, packet->last, rsv, packet->type, len, NULL));
             }
-            *prefix = '\0';
-            mprAdjustBufEnd(packet->prefix, prefix - packet->prefix->start);
+            mprAddNullToBuf(packet->prefix);
             httpLogPacket(stream->trace, "websockets.tx.packet", "packet", 0, packet,
                 "wsSeqno:%d, wsTypeName:\"%s\", wsType:%d, wsLast:%d, wsLength:%zd",
                 ws->txSeq++, codetxt[packet->type], packet->type, packet->last, httpGetPacketLength(packet));
@@ -942,6 +1073,111 @@ static void outgoingWebSockService(HttpQueue *q)
 }
 
 
+/*
+    Encode a frame header into the prefix buffer which must have room for WS_MAX_HEADER bytes.
+    Client frames supply a mask. Returns the length of the header.
+ */
+static ssize encodeFrameHeader(char *prefix, int last, int rsv, int type, ssize len, cuchar *mask)
+{
+    char    *cp;
+    int     i;
+
+    cp = prefix;
+    *cp++ = SET_FIN(last) | SET_RSV(rsv) | SET_CODE(type);
+    if (len <= WS_MAX_CONTROL) {
+        *cp++ = SET_MASK(mask != 0) | SET_LEN(len, 0);
+    } else if (len <= 65535) {
+        *cp++ = SET_MASK(mask != 0) | 126;
+        *cp++ = SET_LEN(len, 1);
+        *cp++ = SET_LEN(len, 0);
+    } else {
+        *cp++ = SET_MASK(mask != 0) | 127;
+        for (i = 7; i >= 0; i--) {
+            *cp++ = SET_LEN(len, i);
+        }
+    }
+    if (mask) {
+        for (i = 0; i < 4; i++) {
+            *cp++ = mask[i];
+        }
+    }
+    return cp - prefix;
+}
+
+
+/*
+    Mask the data a byte at a time until word aligned, then a word or vector at a time. Whole words are multiples
+    of the 4 byte mask, so the offset into the mask only advances for the leading and trailing bytes.
+ */
+PUBLIC int httpMaskWebSocketData(char *data, ssize len, cuchar *mask, int offset)
+{
+    uchar   *cp, *end, pattern[32];
+    int     i;
+
+    cp = (uchar*) data;
+    end = &cp[len];
+    while (cp < end && ((size_t) cp & 0x7)) {
+        *cp++ ^= mask[offset++ & 0x3];
+    }
+    if (end - cp >= 8) {
+        for (i = 0; i < (int) sizeof(pattern); i++) {
+            pattern[i] = mask[(offset + i) & 0x3];
+        }
+        cp = maskWords(cp, end, pattern);
+    }
+    while (cp < end) {
+        *cp++ ^= mask[offset++ & 0x3];
+    }
+    return offset & 0x3;
+}
+
+
+#if ME_HTTP_AVX2
+__attribute__((target("avx2")))
+static uchar *maskAvx2(uchar *cp, uchar *end, cuchar *pattern)
+{
+    __m256i     mask;
+
+    mask = _mm256_loadu_si256((const __m256i*) pattern);
+    for (; end - cp >= 32; cp += 32) {
+        _mm256_storeu_si256((__m256i*) cp, _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) cp), mask));
+    }
+    return cp;
+}
+#endif
+
+
+/*
+    Mask whole 8 byte words starting at an aligned address. Pattern is the mask repeated to 32 bytes from the
+    current mask offset. Returns the first unmasked byte.
+ */
+static uchar *maskWords(uchar *cp, uchar *end, cuchar *pattern)
+{
+    uint64      word, mask64;
+
+#if ME_HTTP_AVX2
+    if (useAvx2) {
+        cp = maskAvx2(cp, end, pattern);
+    }
+#endif
+#if ME_HTTP_SSE2
+    {
+        __m128i mask = _mm_loadu_si128((const __m128i*) pattern);
+        for (; end - cp >= 16; cp += 16) {
+            _mm_storeu_si128((__m128i*) cp, _mm_xor_si128(_mm_loadu_si128((const __m128i*) cp), mask));
+        }
+    }
+#endif
+    memcpy(&mask64, pattern, sizeof(mask64));
+    for (; end - cp >= 8; cp += 8) {
+        memcpy(&word, cp, sizeof(word));
+        word ^= mask64;
+        memcpy(cp, &word, sizeof(word));
+    }
+    return cp;
+}
+
+
 PUBLIC cchar *httpGetWebSocketCloseReason(HttpStream *stream)
 {
     HttpWebSocket   *ws;
@@ -1031,6 +1267,12 @@ PUBLIC void httpSetWebSocketData(HttpStream *stream, void *data)
 }
 
 
+PUBLIC void httpSetWebSocketDeflate(HttpStream *stream, bool on)
+{
+    stream->webSocketsDeflate = on;
+}
+
+
 PUBLIC void httpSetWebSocketProtocols(HttpStream *stream, cchar *protocols)
 {
     assert(stream);
@@ -1048,6 +1290,242 @@ PUBLIC void httpSetWebSocketPreserveFrames(HttpStream *stream, bool on)
     }
 }
 
+/************************************* Broadcast **************************************/
+
+PUBLIC HttpBroadcast *httpCreateBroadcast(int policy, ssize maxBacklog)
+{
+    HttpBroadcast   *group;
+
+    if ((group = mprAllocObj(HttpBroadcast, manageBroadcast)) == 0) {
+        return 0;
+    }
+    group->subscribers = mprCreateList(0, 0);
+    group->mutex = mprCreateLock();
+    group->policy = policy ? policy : HTTP_BROADCAST_DROP;
+    group->maxBacklog = maxBacklog > 0 ? maxBacklog : ME_MAX_WSS_BACKLOG;
+    return group;
+}
+
+
+static void manageBroadcast(HttpBroadcast *group, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(group->subscribers);
+        mprMark(group->mutex);
+    }
+}
+
+
+static void manageSubscriber(Subscriber *sp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(sp->group);
+        mprMark(sp->stream);
+        mprMark(sp->dispatcher);
+        mprMark(sp->frames);
+    }
+}
+
+
+PUBLIC int httpJoinBroadcast(HttpBroadcast *group, HttpStream *stream)
+{
+    HttpWebSocket   *ws;
+    Subscriber      *sp;
+
+    if (!group || !stream || !httpServerStream(stream) || !stream->rx || (ws = stream->rx->webSocket) == 0) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    if (ws->state > WS_STATE_OPEN) {
+        return MPR_ERR_BAD_STATE;
+    }
+    if (!ws->broadcasts) {
+        ws->broadcasts = mprCreateList(0, 0);
+    } else if (mprLookupItem(ws->broadcasts, group) >= 0) {
+        return 0;
+    }
+    if ((sp = mprAllocObj(Subscriber, manageSubscriber)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    sp->group = group;
+    sp->stream = stream;
+    sp->dispatcher = stream->dispatcher;
+    sp->frames = mprCreateList(0, 0);
+    mprAddItem(ws->broadcasts, group);
+
+    lock(group);
+    mprAddItem(group->subscribers, sp);
+    unlock(group);
+    return 0;
+}
+
+
+PUBLIC void httpLeaveBroadcast(HttpBroadcast *group, HttpStream *stream)
+{
+    HttpWebSocket   *ws;
+    Subscriber      *sp;
+    int             next;
+
+    lock(group);
+    for (ITERATE_ITEMS(group->subscribers, sp, next)) {
+        if (sp->stream == stream) {
+            sp->closed = 1;
+            sp->pending = 0;
+            mprClearList(sp->frames);
+            mprRemoveItem(group->subscribers, sp);
+            break;
+        }
+    }
+    unlock(group);
+    if (stream->rx && (ws = stream->rx->webSocket) != 0 && ws->broadcasts) {
+        mprRemoveItem(ws->broadcasts, group);
+    }
+}
+
+
+/*
+    Encode the message once as a complete frame and share it with every subscriber. Server frames are not masked,
+    so the same bytes are valid for all streams.
+ */
+PUBLIC int httpBroadcast(HttpBroadcast *group, int type, cchar *buf, ssize len)
+{
+    Subscriber  *sp;
+    MprBuf      *frame;
+    ssize       size;
+    int         count, next;
+
+    if (!group || (type != WS_MSG_TEXT && type != WS_MSG_BINARY)) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    if (len < 0) {
+        len = slen(buf);
+    }
+    if ((frame = mprCreateBuf(len + WS_MAX_HEADER, 0)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    mprAdjustBufEnd(frame, encodeFrameHeader(mprGetBufEnd(frame), 1, 0, type, len, NULL));
+    if (len > 0 && mprPutBlockToBuf(frame, buf, len) != len) {
+        return MPR_ERR_MEMORY;
+    }
+    size = mprGetBufLength(frame);
+    count = 0;
+
+    lock(group);
+    group->sent++;
+    for (ITERATE_ITEMS(group->subscribers, sp, next)) {
+        if (sp->disconnect) {
+            continue;
+        }
+        if ((sp->pending + sp->backlog) > group->maxBacklog) {
+            if (group->policy == HTTP_BROADCAST_DISCONNECT) {
+                sp->disconnect = 1;
+                group->disconnected++;
+                scheduleDelivery(sp, 0);
+                continue;
+
+            } else if (group->policy == HTTP_BROADCAST_COALESCE) {
+                group->dropped += mprGetListLength(sp->frames);
+                mprClearList(sp->frames);
+                sp->pending = 0;
+
+            } else {
+                /*
+                    Drop the message. Schedule a delivery anyway to refresh the backlog as the stream drains.
+                 */
+                group->dropped++;
+                scheduleDelivery(sp, 0);
+                continue;
+            }
+        }
+        mprAddItem(sp->frames, frame);
+        sp->pending += size;
+        scheduleDelivery(sp, 0);
+        count++;
+    }
+    unlock(group);
+    return count;
+}
+
+
+/*
+    Schedule delivery on the stream dispatcher. Only one delivery event is outstanding per subscriber.
+    Must be called with the group locked.
+ */
+static void scheduleDelivery(Subscriber *sp, MprTicks delay)
+{
+    if (!sp->scheduled) {
+        if (mprCreateEvent(sp->dispatcher, "broadcast", delay, deliverBroadcast, sp, 0) != 0) {
+            sp->scheduled = 1;
+        }
+    }
+}
+
+
+/*
+    Queue undelivered frames for the stream. Runs on the stream dispatcher. Each packet is a view of the shared
+    frame so the stream can consume it independently.
+ */
+static void deliverBroadcast(Subscriber *sp, MprEvent *event)
+{
+    HttpBroadcast   *group;
+    HttpStream      *stream;
+    HttpWebSocket   *ws;
+    HttpPacket      *packet;
+    MprList         *frames;
+    MprBuf          *frame;
+    ssize           backlog;
+    int             next;
+
+    group = sp->group;
+    stream = sp->stream;
+    ws = stream->rx ? stream->rx->webSocket : 0;
+    backlog = httpGetWriteQueueCount(stream) + (stream->net->socketq ? stream->net->socketq->count : 0);
+
+    lock(group);
+    sp->scheduled = 0;
+    if (sp->closed) {
+        unlock(group);
+        return;
+    }
+    sp->backlog = backlog;
+    if (sp->disconnect || !ws || ws->state > WS_STATE_OPEN || stream->state >= HTTP_STATE_FINALIZED) {
+        unlock(group);
+        if (sp->disconnect) {
+            httpLog(stream->trace, "websockets.broadcast", "error", "msg:'Disconnect slow subscriber', backlog:%zd",
+                backlog);
+        }
+        httpLeaveBroadcast(group, stream);
+        if (sp->disconnect) {
+            httpDisconnectStream(stream);
+        }
+        return;
+    }
+    if (ws->state < WS_STATE_OPEN || (group->policy == HTTP_BROADCAST_COALESCE && backlog > group->maxBacklog)) {
+        /*
+            Hold messages until the handshake completes. Hold the latest message until a slow stream drains.
+         */
+        scheduleDelivery(sp, WS_BROADCAST_RETRY);
+        unlock(group);
+        return;
+    }
+    frames = sp->frames;
+    sp->frames = mprCreateList(0, 0);
+    sp->backlog += sp->pending;
+    sp->pending = 0;
+    unlock(group);
+
+    for (ITERATE_ITEMS(frames, frame, next)) {
+        if ((packet = httpCreateDataPacket(0)) == 0) {
+            break;
+        }
+        packet->content = mprCreateBufView(frame);
+        packet->type = GET_CODE(*mprGetBufStart(frame));
+        packet->last = 1;
+        packet->flags |= HTTP_PACKET_SOLO | HTTP_PACKET_FRAMED;
+        httpPutForService(stream->writeq, packet, HTTP_SCHEDULE_QUEUE);
+    }
+    httpServiceNetQueues(stream->net, 0);
+}
+
 
 /*
     Test if a string is a valid unicode string.
@@ -1152,6 +1630,11 @@ PUBLIC int httpUpgradeWebSocket(HttpStream *stream)
     httpSetHeaderString(stream, "Sec-WebSocket-Key", tx->webSockKey);
     httpSetHeaderString(stream, "Sec-WebSocket-Protocol", stream->protocols ? stream->protocols : "chat");
     httpSetHeaderString(stream, "Sec-WebSocket-Version", "13");
+#if ME_HTTP_COMPRESS
+    if (stream->webSocketsDeflate) {
+        offerDeflate(stream);
+    }
+#endif
     httpSetHeader(stream, "X-Request-Timeout", "%lld", stream->limits->requestTimeout / TPS);
     httpSetHeader(stream, "X-Inactivity-Timeout", "%lld", stream->limits->inactivityTimeout / TPS);
 
@@ -1169,7 +1652,7 @@ PUBLIC bool httpVerifyWebSocketsHandshake(HttpStream *stream)
 {
     HttpRx          *rx;
     HttpTx          *tx;
-    cchar           *key, *expected;
+    cchar           *key, *expected, *extensions;
 
     rx = stream->rx;
     tx = stream->tx;
@@ -1198,11 +1681,374 @@ PUBLIC bool httpVerifyWebSocketsHandshake(HttpStream *stream)
         httpError(stream, HTTP_CODE_BAD_HANDSHAKE, "Bad WebSocket handshake key\n%s\n%s", key, expected);
         return 0;
     }
+    if ((extensions = httpGetHeader(stream, "sec-websocket-extensions")) != 0) {
+#if ME_HTTP_COMPRESS
+        if (!confirmDeflate(stream, extensions))
+#endif
+        {
+            httpError(stream, HTTP_CODE_BAD_HANDSHAKE, "Unsupported WebSocket extensions %s", extensions);
+            return 0;
+        }
+    }
     rx->webSocket->state = WS_STATE_OPEN;
     return 1;
 }
 
 
+#if ME_HTTP_COMPRESS
+/*
+    Server acceptance of a permessage-deflate offer. Accept the first offer with supported parameters that fits the
+    memory limit and respond with the agreed parameters.
+ */
+static void acceptDeflate(HttpStream *stream, HttpWebSocket *ws, cchar *offers)
+{
+    WebSocketDeflate    *wd;
+    DeflateParams       dp;
+    MprBuf              *buf;
+    char                *offer, *params, *tok;
+    int                 txBits, rxBits, memLevel;
+
+    if (!offers) {
+        return;
+    }
+    for (offer = stok(sclone(offers), ",", &tok); offer; offer = stok(NULL, ",", &tok)) {
+        offer = strim(stok(offer, ";", &params), " \t", MPR_TRIM_BOTH);
+        if (!smatch(offer, "permessage-deflate") || !parseDeflateParams(params, &dp)) {
+            continue;
+        }
+        txBits = dp.serverBits ? dp.serverBits : WS_DEFLATE_MAX_BITS;
+        rxBits = dp.clientBits ? dp.clientBits : WS_DEFLATE_MAX_BITS;
+        if (txBits < WS_DEFLATE_MIN_BITS ||
+                !fitDeflate(stream->limits->webSocketsDeflate, &txBits, &memLevel, &rxBits, dp.clientBitsOffered)) {
+            continue;
+        }
+        if ((wd = createDeflate(txBits, memLevel, rxBits)) == 0) {
+            return;
+        }
+        wd->txNoContext = dp.serverNoContext;
+        wd->rxNoContext = dp.clientNoContext;
+        ws->deflate = wd;
+
+        buf = mprCreateBuf(0, 0);
+        mprPutStringToBuf(buf, "permessage-deflate");
+        if (dp.serverNoContext) {
+            mprPutStringToBuf(buf, "; server_no_context_takeover");
+        }
+        if (dp.clientNoContext) {
+            mprPutStringToBuf(buf, "; client_no_context_takeover");
+        }
+        if (dp.serverBits) {
+            mprPutToBuf(buf, "; server_max_window_bits=%d", txBits);
+        }
+        if (dp.clientBitsOffered && (dp.clientBits || rxBits < WS_DEFLATE_MAX_BITS)) {
+            mprPutToBuf(buf, "; client_max_window_bits=%d", rxBits);
+        }
+        mprAddNullToBuf(buf);
+        httpSetHeaderString(stream, "Sec-WebSocket-Extensions", mprGetBufStart(buf));
+        httpLog(stream->trace, "websockets.deflate", "context", "extension:'%s'", mprGetBufStart(buf));
+        return;
+    }
+}
+
+
+/*
+    Client offer of permessage-deflate. Ask the server to limit its window if required to fit the memory limit.
+ */
+static void offerDeflate(HttpStream *stream)
+{
+    int     txBits, rxBits, memLevel;
+
+    txBits = rxBits = WS_DEFLATE_MAX_BITS;
+    if (!fitDeflate(stream->limits->webSocketsDeflate, &txBits, &memLevel, &rxBits, 1)) {
+        return;
+    }
+    if (rxBits < WS_DEFLATE_MAX_BITS) {
+        httpSetHeader(stream, "Sec-WebSocket-Extensions",
+            "permessage-deflate; client_max_window_bits; server_max_window_bits=%d", rxBits);
+    } else {
+        httpSetHeaderString(stream, "Sec-WebSocket-Extensions", "permessage-deflate; client_max_window_bits");
+    }
+}
+
+
+/*
+    Client check of the server extension response. Returns false if the response cannot be honored.
+ */
+static bool confirmDeflate(HttpStream *stream, cchar *response)
+{
+    WebSocketDeflate    *wd;
+    DeflateParams       dp;
+    char                *params;
+    int                 txBits, rxBits, memLevel;
+
+    if (!stream->webSocketsDeflate) {
+        return 0;
+    }
+    if (!smatch(strim(stok(sclone(response), ";", &params), " \t", MPR_TRIM_BOTH), "permessage-deflate") ||
+            !parseDeflateParams(params, &dp) || (dp.clientBitsOffered && !dp.clientBits)) {
+        return 0;
+    }
+    /*
+        Recompute the offer to get the window limit requested of the server
+     */
+    txBits = rxBits = WS_DEFLATE_MAX_BITS;
+    if (!fitDeflate(stream->limits->webSocketsDeflate, &txBits, &memLevel, &rxBits, 1)) {
+        return 0;
+    }
+    if ((dp.serverBits ? dp.serverBits : WS_DEFLATE_MAX_BITS) > rxBits) {
+        return 0;
+    }
+    if (dp.serverBits) {
+        rxBits = dp.serverBits;
+    }
+    if (dp.clientBits) {
+        if (dp.clientBits < WS_DEFLATE_MIN_BITS) {
+            return 0;
+        }
+        txBits = min(txBits, dp.clientBits);
+        memLevel = min(memLevel, txBits - 7);
+    }
+    if ((wd = createDeflate(txBits, memLevel, rxBits)) == 0) {
+        return 0;
+    }
+    wd->txNoContext = dp.clientNoContext;
+    wd->rxNoContext = dp.serverNoContext;
+    stream->rx->webSocket->deflate = wd;
+    return 1;
+}
+
+
+/*
+    Parse the parameters of an extension offer or response. Returns false for unknown, duplicate or invalid parameters.
+ */
+static bool parseDeflateParams(char *params, DeflateParams *dp)
+{
+    char    *param, *value, *tok;
+    int     bits;
+
+    memset(dp, 0, sizeof(DeflateParams));
+    if (!params) {
+        return 1;
+    }
+    for (param = stok(params, ";", &tok); param; param = stok(NULL, ";", &tok)) {
+        param = strim(stok(param, "=", &value), " \t", MPR_TRIM_BOTH);
+        bits = 0;
+        if (value) {
+            value = strim(strim(value, " \t", MPR_TRIM_BOTH), "\"", MPR_TRIM_BOTH);
+            bits = (int) stoi(value);
+            if (!snumber(value) || bits < 8 || bits > WS_DEFLATE_MAX_BITS) {
+                return 0;
+            }
+        }
+        if (smatch(param, "server_no_context_takeover") && !value && !dp->serverNoContext) {
+            dp->serverNoContext = 1;
+
+        } else if (smatch(param, "client_no_context_takeover") && !value && !dp->clientNoContext) {
+            dp->clientNoContext = 1;
+
+        } else if (smatch(param, "server_max_window_bits") && value && !dp->serverBits) {
+            dp->serverBits = bits;
+
+        } else if (smatch(param, "client_max_window_bits") && !dp->clientBitsOffered) {
+            dp->clientBitsOffered = 1;
+            dp->clientBits = bits;
+
+        } else {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+/*
+    Reduce the zlib windows until the compression and decompression state fits the memory limit. Zlib needs
+    (1 << (bits + 2)) + (1 << (memLevel + 9)) bytes to compress and (1 << bits) plus about 7K to decompress.
+    The decompression window can only be reduced if the peer accepts a limit. Returns false if it cannot fit.
+ */
+static bool fitDeflate(ssize limit, int *txBits, int *memLevel, int *rxBits, bool lowerRx)
+{
+    *memLevel = min(*txBits - 7, 8);
+    while (((ssize) 1 << (*txBits + 2)) + ((ssize) 1 << (*memLevel + 9)) + ((ssize) 1 << *rxBits) + 7 * 1024 > limit) {
+        if (*txBits > WS_DEFLATE_MIN_BITS) {
+            (*txBits)--;
+            *memLevel = min(*txBits - 7, 8);
+        } else if (lowerRx && *rxBits > WS_DEFLATE_MIN_BITS) {
+            (*rxBits)--;
+        } else {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+/*
+    Zlib state is initialized on first use so idle connections do not hold compression memory
+ */
+static WebSocketDeflate *createDeflate(int txBits, int memLevel, int rxBits)
+{
+    WebSocketDeflate    *wd;
+
+    if ((wd = mprAllocObj(WebSocketDeflate, manageDeflate)) == 0) {
+        return 0;
+    }
+    wd->txBits = txBits;
+    wd->memLevel = max(memLevel, 1);
+    wd->rxBits = rxBits;
+    return wd;
+}
+
+
+static void manageDeflate(WebSocketDeflate *wd, int flags)
+{
+    if (flags & MPR_MANAGE_FREE) {
+        endDeflate(wd);
+    }
+}
+
+
+static void endDeflate(WebSocketDeflate *wd)
+{
+    if (wd->txActive) {
+        deflateEnd(&wd->tx);
+        wd->txActive = 0;
+    }
+    if (wd->rxActive) {
+        inflateEnd(&wd->rx);
+        wd->rxActive = 0;
+    }
+}
+
+
+/*
+    Compress an outgoing data frame. Small single frame messages are sent uncompressed.
+    Returns the RSV bits for the frame or a negative MPR error code.
+ */
+static int deflatePacket(HttpQueue *q, HttpPacket *packet)
+{
+    HttpWebSocket       *ws;
+    WebSocketDeflate    *wd;
+    MprBuf              *out;
+    ssize               len, size;
+
+    ws = q->stream->rx->webSocket;
+    wd = ws->deflate;
+    len = httpGetPacketLength(packet);
+
+    if (packet->type != WS_MSG_CONT) {
+        wd->txMessage = !packet->last || len >= WS_DEFLATE_MIN_SIZE;
+    }
+    if (!wd->txMessage) {
+        return 0;
+    }
+    if (!wd->txActive) {
+        if (deflateInit2(&wd->tx, HTTP_COMPRESS_LEVEL, Z_DEFLATED, -wd->txBits, wd->memLevel,
+                Z_DEFAULT_STRATEGY) != Z_OK) {
+            return MPR_ERR_CANT_INITIALIZE;
+        }
+        wd->txActive = 1;
+    }
+    out = mprCreateBuf(len + ME_BUFSIZE, -1);
+    wd->tx.next_in = (Bytef*) mprGetBufStart(packet->content);
+    wd->tx.avail_in = (uInt) len;
+    do {
+        if (mprGetBufSpace(out) < ME_BUFSIZE && mprGrowBuf(out, ME_BUFSIZE) < 0) {
+            return MPR_ERR_MEMORY;
+        }
+        size = mprGetBufSpace(out);
+        wd->tx.next_out = (Bytef*) mprGetBufEnd(out);
+        wd->tx.avail_out = (uInt) size;
+        if (deflate(&wd->tx, Z_SYNC_FLUSH) == Z_STREAM_ERROR) {
+            return MPR_ERR_CANT_WRITE;
+        }
+        mprAdjustBufEnd(out, size - wd->tx.avail_out);
+    } while (wd->tx.avail_out == 0);
+
+    if (packet->last) {
+        /*
+            Remove the empty block trailer from the last frame. The peer restores it.
+         */
+        if (mprGetBufLength(out) >= 4 && memcmp(mprGetBufEnd(out) - 4, WS_DEFLATE_TRAILER, 4) == 0) {
+            mprAdjustBufEnd(out, -4);
+        }
+        if (wd->txNoContext) {
+            deflateReset(&wd->tx);
+        }
+    }
+    packet->content = out;
+    return (packet->type != WS_MSG_CONT) ? WS_RSV_DEFLATE : 0;
+}
+
+
+/*
+    Decompress a complete incoming frame of a compressed message. The inflated frame is limited to the maximum
+    message size to defeat compression bombs. Returns a WebSockets status code on errors.
+ */
+static int inflateFrame(HttpQueue *q, HttpPacket *packet)
+{
+    HttpStream          *stream;
+    HttpWebSocket       *ws;
+    WebSocketDeflate    *wd;
+    MprBuf              *out;
+    ssize               len, size, limit;
+    int                 rc;
+
+    stream = q->stream;
+    ws = stream->rx->webSocket;
+    wd = ws->deflate;
+    limit = stream->limits->webSocketsMessageSize;
+
+    if (!wd->rxActive) {
+        if (inflateInit2(&wd->rx, -wd->rxBits) != Z_OK) {
+            traceError(stream, "Cannot initialize decompression");
+            return WS_STATUS_INTERNAL_ERROR;
+        }
+        wd->rxActive = 1;
+    }
+    if (packet->last) {
+        mprPutBlockToBuf(packet->content, WS_DEFLATE_TRAILER, 4);
+    }
+    len = httpGetPacketLength(packet);
+    out = mprCreateBuf(max(len * 4, ME_BUFSIZE), -1);
+    wd->rx.next_in = (Bytef*) mprGetBufStart(packet->content);
+    wd->rx.avail_in = (uInt) len;
+    do {
+        if (mprGetBufSpace(out) < ME_BUFSIZE) {
+            if (mprGetBufLength(out) > limit) {
+                traceError(stream, "Incoming compressed message is too large, max %zd", limit);
+                return WS_STATUS_MESSAGE_TOO_LARGE;
+            }
+            if (mprGrowBuf(out, mprGetBufSize(out)) < 0) {
+                return WS_STATUS_INTERNAL_ERROR;
+            }
+        }
+        size = mprGetBufSpace(out);
+        wd->rx.next_out = (Bytef*) mprGetBufEnd(out);
+        wd->rx.avail_out = (uInt) size;
+        rc = inflate(&wd->rx, Z_SYNC_FLUSH);
+        mprAdjustBufEnd(out, size - wd->rx.avail_out);
+        if (rc == Z_STREAM_END) {
+            inflateReset(&wd->rx);
+        } else if (rc != Z_OK && rc != Z_BUF_ERROR) {
+            traceError(stream, "Cannot decompress message");
+            return WS_STATUS_PROTOCOL_ERROR;
+        }
+    } while (wd->rx.avail_in > 0 || wd->rx.avail_out == 0);
+
+    if (mprGetBufLength(out) > limit) {
+        traceError(stream, "Incoming compressed message is too large, max %zd", limit);
+        return WS_STATUS_MESSAGE_TOO_LARGE;
+    }
+    if (packet->last && wd->rxNoContext) {
+        inflateReset(&wd->rx);
+    }
+    packet->content = out;
+    return 0;
+}
+#endif /* ME_HTTP_COMPRESS */
+
+
 static void traceErrorProc(HttpStream *stream, cchar *fmt, ...)
 {
     HttpWebSocket   *ws;
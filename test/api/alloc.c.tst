@@ -0,0 +1,211 @@
+/**
+    alloc.c.tst - tests for per-thread allocation caches and GC pauses
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+/*********************************** Locals ***********************************/
+
+#define ALLOC_THREADS   4
+#define ALLOC_OPS       200000
+#define ALLOC_KEEP      64
+
+static volatile int finished;
+static volatile int failed;
+
+/************************************ Code ************************************/
+
+static void testSmall()
+{
+    MprMemStats *stats;
+    MprList     *list;
+    uint64      hits;
+    int         i;
+
+    stats = mprGetMemStats();
+    hits = stats->cacheHits;
+
+    list = mprCreateList(0, 0);
+    mprAddRoot(list);
+    for (i = 0; i < 1000; i++) {
+        mprAddItem(list, sfmt("item-%d", i));
+    }
+    mprGC(MPR_GC_FORCE | MPR_GC_COMPLETE);
+    for (i = 0; i < 1000; i++) {
+        if (!smatch(mprGetItem(list, i), sfmt("item-%d", i))) {
+            break;
+        }
+    }
+    ttrue(i == 1000);
+    mprRemoveRoot(list);
+
+    stats = mprGetMemStats();
+    if (ME_MPR_ALLOC_THREAD_CACHE) {
+        ttrue(stats->cacheHits > hits);
+    }
+}
+
+
+static void allocWorker(void *data, MprThread *tp)
+{
+    MprList *keep;
+    char    *str;
+    int     i, id;
+
+    /* Thread data is marked by the collector so an id cannot be passed as data */
+    id = (int) ((PTOL(tp) >> 4) & 0xFFFF);
+    keep = mprCreateList(ALLOC_KEEP, 0);
+    mprAddRoot(keep);
+    for (i = 0; i < ALLOC_OPS; i++) {
+        str = mprAlloc(16 + (i % 24) * 16);
+        fmt(str, 16, "%d-%d", id, i);
+        mprSetItem(keep, i % ALLOC_KEEP, str);
+        if ((i % 1000) == 0) {
+            mprYield(0);
+        }
+    }
+    for (i = ALLOC_OPS - ALLOC_KEEP; i < ALLOC_OPS; i++) {
+        if (!smatch(mprGetItem(keep, i % ALLOC_KEEP), sfmt("%d-%d", id, i))) {
+            failed = 1;
+        }
+    }
+    mprRemoveRoot(keep);
+    mprAtomicAdd(&finished, 1);
+}
+
+
+/*
+    Concurrent small allocations while collecting. Blocks retained across collections must survive.
+    Reports throughput and cache hit rate as a micro-benchmark.
+ */
+static void testThreads()
+{
+    MprMemStats *stats;
+    MprThread   *tp;
+    MprTicks    mark, elapsed;
+    uint64      hits, misses;
+    int         i;
+
+    stats = mprGetMemStats();
+    hits = stats->cacheHits;
+    misses = stats->cacheMisses;
+    finished = failed = 0;
+    mark = mprGetTicks();
+    for (i = 0; i < ALLOC_THREADS; i++) {
+        tp = mprCreateThread("alloc", allocWorker, NULL, 0);
+        ttrue(tp != 0);
+        mprStartThread(tp);
+    }
+    while (finished < ALLOC_THREADS) {
+        mprYield(0);
+        mprNap(1);
+    }
+    elapsed = mprGetTicks() - mark;
+    ttrue(!failed);
+
+    /* Exited threads return their caches and keep their counts */
+    mprNap(10);
+    stats = mprGetMemStats();
+    hits = stats->cacheHits - hits;
+    misses = stats->cacheMisses - misses;
+    tinfo("Alloc: %d threads, %d allocations in %lld msec, cache hit rate %.2f %%", ALLOC_THREADS,
+        ALLOC_THREADS * ALLOC_OPS, (int64) elapsed, (hits + misses) ? hits * 100.0 / (hits + misses) : 0.0);
+    if (ME_MPR_ALLOC_THREAD_CACHE) {
+        ttrue(hits > misses);
+    }
+}
+
+
+static void busyWorker(void *data, MprThread *tp)
+{
+    MprTicks    mark;
+
+    /* Run without yielding so the collector cannot pause this thread */
+    mark = mprGetTicks();
+    while (mprGetElapsedTicks(mark) < 300) { }
+    mprAtomicAdd(&finished, 1);
+}
+
+
+/*
+    A thread that does not yield must not hold yielded threads beyond the sync timeout. Abandoned attempts are
+    recorded separately from completed pauses.
+ */
+static void testSyncTimeout()
+{
+    MprMemStats *stats;
+    MprThread   *tp;
+    MprTicks    mark, elapsed;
+    uint64      abandoned, abandonedWait, pauses;
+    int         i;
+
+    ttrue(mprSetGCSyncTimeout(10) == ME_MPR_GC_SYNC_TIMEOUT);
+    stats = mprGetMemStats();
+    abandoned = stats->gcAbandoned;
+    abandonedWait = stats->gcAbandonedTotal;
+
+    finished = 0;
+    tp = mprCreateThread("busy", busyWorker, NULL, 0);
+    mprStartThread(tp);
+    mprNap(10);
+
+    for (i = 0; i < 1000000 && !mprNeedYield(); i++) {
+        mprAlloc(64);
+    }
+    mark = mprGetTicks();
+    mprYield(0);
+    elapsed = mprGetElapsedTicks(mark);
+    ttrue(elapsed < MPR_TIMEOUT_GC_SYNC);
+
+    while (finished < 1) {
+        mprYield(0);
+        mprNap(1);
+    }
+    ttrue(stats->gcAbandoned > abandoned);
+    ttrue(stats->gcAbandonedTotal > abandonedWait);
+    ttrue(stats->gcAbandonedMax > 0);
+
+    mprGC(MPR_GC_FORCE | MPR_GC_COMPLETE);
+    for (pauses = 0, i = 0; i < MPR_GC_PAUSE_BUCKETS; i++) {
+        pauses += stats->gcPauses[i];
+    }
+    ttrue(pauses > 0);
+    tinfo("GC: %lld pauses, max %.2f msec, %lld abandoned, max wait %.2f msec", pauses,
+        stats->gcPauseMax / 1000.0, stats->gcAbandoned, stats->gcAbandonedMax / 1000.0);
+}
+
+
+int main(int argc, char **argv)
+{
+    mprCreate(argc, argv, 0);
+    testSmall();
+    testThreads();
+    testSyncTimeout();
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
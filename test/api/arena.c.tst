@@ -0,0 +1,178 @@
+/**
+    arena.c.tst - tests for request lifetime memory arenas
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+/*********************************** Locals ***********************************/
+
+#define ARENA_KEYS      100
+#define ARENA_REQUESTS  20000
+#define ARENA_STREAMS   32
+
+static MprArena *arena;
+
+/************************************ Code ************************************/
+
+static void testAlloc()
+{
+    char    *str, *zeroed;
+    int     i;
+
+    str = mprArenaClone(arena, "Content-Type: text/plain", 12);
+    ttrue(smatch(str, "Content-Type"));
+    ttrue(mprIsValid(str));
+    ttrue(mprGetBlockSize(str) >= 13);
+
+    /* Clones stop at the first null */
+    ttrue(smatch(mprArenaClone(arena, "short", 100), "short"));
+    ttrue(smatch(mprArenaClone(arena, NULL, -1), ""));
+
+    zeroed = mprArenaAllocMem(arena, 64, MPR_ALLOC_ZERO);
+    for (i = 0; i < 64 && zeroed[i] == 0; i++) {}
+    ttrue(i == 64);
+
+    /* Large blocks escape to the heap and fill no chunk space */
+    ttrue(mprArenaAllocMem(arena, arena->chunkSize, 0) != 0);
+    ttrue(arena->allocated < arena->chunkSize);
+
+    /* Without an arena, blocks come from the heap */
+    ttrue(smatch(mprArenaClone(NULL, "heap", -1), "heap"));
+}
+
+
+static void testHash()
+{
+    MprHash     *hash;
+    int         i;
+
+    hash = mprCreateHashInArena(arena, 0, 0);
+    mprAddRoot(hash);
+    for (i = 0; i < ARENA_KEYS; i++) {
+        mprAddKey(hash, sfmt("key-%d", i), mprArenaClone(arena, sfmt("value-%d", i), -1));
+    }
+    ttrue(arena->chunks > 1);
+
+    mprGC(MPR_GC_FORCE | MPR_GC_COMPLETE);
+    ttrue(mprGetHashLength(hash) == ARENA_KEYS);
+    for (i = 0; i < ARENA_KEYS; i++) {
+        if (!smatch(mprLookupKey(hash, sfmt("key-%d", i)), sfmt("value-%d", i))) {
+            break;
+        }
+    }
+    ttrue(i == ARENA_KEYS);
+    mprRemoveRoot(hash);
+}
+
+
+/*
+    Blocks that outlive an arena reset must keep their chunk alive
+ */
+static void testEscape()
+{
+    char    *kept;
+    int     i;
+
+    kept = mprArenaClone(arena, "escaped", -1);
+    mprAddRoot(kept);
+    mprResetArena(arena);
+    ttrue(arena->allocated == 0 && arena->chunks == 1);
+
+    mprGC(MPR_GC_FORCE | MPR_GC_COMPLETE);
+    for (i = 0; i < 1000; i++) {
+        memset(mprAlloc(128), 'x', 128);
+    }
+    ttrue(smatch(kept, "escaped"));
+    mprRemoveRoot(kept);
+}
+
+
+static void simulateRequest(MprArena *ap)
+{
+    MprHash     *headers;
+    int         i;
+
+    headers = mprCreateHashInArena(ap, 0, MPR_HASH_CASELESS | MPR_HASH_STABLE);
+    for (i = 0; i < 16; i++) {
+        mprAddKey(headers, mprArenaClone(ap, "X-Header-Name", -1), mprArenaClone(ap, "header value text", -1));
+    }
+    mprResetArena(ap);
+}
+
+
+/*
+    Compare per-request allocation with and without arenas for a set of keep-alive streams.
+    Reports timing and GC sweeps as a micro-benchmark.
+ */
+static void testBenchmark()
+{
+    MprMemStats     *stats;
+    MprList         *arenas;
+    MprTicks        mark;
+    uint            sweeps;
+    int             i;
+
+    arenas = mprCreateList(ARENA_STREAMS, 0);
+    mprAddRoot(arenas);
+    for (i = 0; i < ARENA_STREAMS; i++) {
+        mprAddItem(arenas, mprCreateArena(0));
+    }
+    stats = mprGetMemStats();
+    mark = mprGetTicks();
+    sweeps = stats->sweeps;
+    for (i = 0; i < ARENA_REQUESTS; i++) {
+        simulateRequest(NULL);
+        mprYield(0);
+    }
+    tinfo("Heap: %d requests in %lld msec, %d sweeps", ARENA_REQUESTS, (int64) (mprGetTicks() - mark),
+        stats->sweeps - sweeps);
+
+    mark = mprGetTicks();
+    sweeps = stats->sweeps;
+    for (i = 0; i < ARENA_REQUESTS; i++) {
+        simulateRequest(mprGetItem(arenas, i % ARENA_STREAMS));
+        mprYield(0);
+    }
+    tinfo("Arena: %d requests in %lld msec, %d sweeps", ARENA_REQUESTS, (int64) (mprGetTicks() - mark),
+        stats->sweeps - sweeps);
+    mprRemoveRoot(arenas);
+}
+
+
+int main(int argc, char **argv)
+{
+    mprCreate(argc, argv, 0);
+    arena = mprCreateArena(0);
+    mprAddRoot(arena);
+    testAlloc();
+    testHash();
+    testEscape();
+    testBenchmark();
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -0,0 +1,240 @@
+/**
+    auth.c.tst - tests for password verification and the verified credential cache
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+/*********************************** Locals ***********************************/
+
+#define AUTH_LOGINS     200
+#define AUTH_REALM      "example.com"
+
+static HttpStream   *stream;
+static HttpAuth     *auth;
+
+/************************************ Code ************************************/
+
+static void addUser(cchar *name, cchar *password)
+{
+    httpAddUser(auth, name, mprMakePassword(sfmt("%s:%s:%s", name, AUTH_REALM, password), 0, 0), "user");
+}
+
+
+static bool login(cchar *name, cchar *password)
+{
+    stream->user = 0;
+    return httpLogin(stream, name, password);
+}
+
+
+static void testCache()
+{
+    int64   hits, misses;
+
+    addUser("ralph", "pass5");
+    hits = HTTP->credentialHits;
+    misses = HTTP->credentialMisses;
+
+    /* The first login hashes the password. Later logins with the same credentials are served from the cache */
+    ttrue(login("ralph", "pass5"));
+    ttrue(HTTP->credentialMisses == misses + 1);
+    ttrue(login("ralph", "pass5"));
+    ttrue(login("ralph", "pass5"));
+    ttrue(HTTP->credentialHits == hits + 2);
+
+    /* Wrong passwords are never cached */
+    ttrue(!login("ralph", "wrong"));
+    ttrue(!login("ralph", "wrong"));
+    ttrue(HTTP->credentialMisses == misses + 3);
+
+    /* Changing the user flushes the cache */
+    addUser("ralph", "pass6");
+    ttrue(!login("ralph", "pass5"));
+    ttrue(login("ralph", "pass6"));
+    ttrue(HTTP->credentialHits == hits + 2);
+    ttrue(login("ralph", "pass6"));
+    ttrue(HTTP->credentialHits == hits + 3);
+
+    httpRemoveUser(auth, "ralph");
+    ttrue(!login("ralph", "pass6"));
+    addUser("ralph", "pass5");
+}
+
+
+/*
+    While routing, the password is hashed by a worker and the request is routed again once verified.
+    The result is posted as an event to the stream dispatcher, so wait for dispatcher events until it arrives.
+ */
+static void testWorker()
+{
+    HttpRx      *rx;
+    MprTicks    mark;
+    int64       dispatcherMark;
+
+    httpFlushCredentials();
+    rx = stream->rx;
+    rx->authAsync = 1;
+    ttrue(!login("ralph", "pass5"));
+    rx->authAsync = 0;
+    /* The worker may have already posted the result */
+    ttrue(rx->authPending || rx->authVerified);
+
+    mark = mprGetTicks();
+    dispatcherMark = mprGetEventMark(stream->dispatcher);
+    while (rx->authPending && mprGetElapsedTicks(mark) < 5000) {
+        mprWaitForEvent(stream->dispatcher, 100, dispatcherMark);
+        dispatcherMark = mprGetEventMark(stream->dispatcher);
+    }
+    ttrue(!rx->authPending);
+    ttrue(rx->authVerified);
+
+    /* The worker result is used once, then the cache serves the credentials */
+    ttrue(login("ralph", "pass5"));
+    ttrue(!rx->authVerified);
+    ttrue(login("ralph", "pass5"));
+}
+
+
+/*
+    Start a worker to verify the credentials and wait for the result to be posted to the request. If no worker is
+    available, the password is verified immediately, so retry until a worker takes the job.
+ */
+static bool verifyByWorker(cchar *name, cchar *password)
+{
+    HttpRx      *rx;
+    MprTicks    mark;
+    int64       dispatcherMark;
+    int         i;
+
+    rx = stream->rx;
+    for (i = 0; i < 100; i++) {
+        httpFlushCredentials();
+        rx->authAsync = 1;
+        login(name, password);
+        rx->authAsync = 0;
+        if (rx->authPending || rx->authVerified || rx->authRejected) {
+            break;
+        }
+        mprSleep(10);
+    }
+
+    mark = mprGetTicks();
+    dispatcherMark = mprGetEventMark(stream->dispatcher);
+    while (rx->authPending && mprGetElapsedTicks(mark) < 5000) {
+        mprWaitForEvent(stream->dispatcher, 100, dispatcherMark);
+        dispatcherMark = mprGetEventMark(stream->dispatcher);
+    }
+    ttrue(!rx->authPending);
+    return rx->authVerified || rx->authRejected;
+}
+
+
+/*
+    A worker result applies only to the credentials it verified. Different credentials are verified again.
+ */
+static void testWorkerCredentials()
+{
+    HttpRx      *rx;
+
+    rx = stream->rx;
+    if (!verifyByWorker("ralph", "pass5")) {
+        tskip("No worker available");
+        return;
+    }
+    ttrue(rx->authVerified);
+    ttrue(!login("ralph", "wrong"));
+    ttrue(!rx->authVerified && !rx->authKey);
+
+    if (!verifyByWorker("ralph", "wrong")) {
+        tskip("No worker available");
+        return;
+    }
+    ttrue(rx->authRejected);
+    ttrue(login("ralph", "pass5"));
+    ttrue(!rx->authRejected && !rx->authKey);
+}
+
+
+/*
+    Compare logins that hash the password every time with logins served from the cache.
+    Reports timing as a micro-benchmark.
+ */
+static void testBenchmark()
+{
+    MprTicks    mark, hashed;
+    int         i, failed;
+
+    failed = 0;
+    mark = mprGetTicks();
+    for (i = 0; i < AUTH_LOGINS; i++) {
+        httpFlushCredentials();
+        failed += !login("ralph", "pass5");
+    }
+    hashed = mprGetTicks() - mark;
+
+    mark = mprGetTicks();
+    for (i = 0; i < AUTH_LOGINS; i++) {
+        failed += !login("ralph", "pass5");
+    }
+    ttrue(failed == 0);
+    tinfo("Credentials: %d logins, hashed %lld msec, cached %lld msec", AUTH_LOGINS, (int64) hashed,
+        (int64) (mprGetTicks() - mark));
+}
+
+
+int main(int argc, char **argv)
+{
+    HttpNet     *net;
+    HttpHost    *host;
+    HttpRoute   *route;
+
+    mprCreate(argc, argv, 0);
+    httpCreate(HTTP_SERVER_SIDE | HTTP_CLIENT_SIDE);
+    mprStartWorkerService();
+
+    host = httpCreateHost();
+    route = httpCreateConfiguredRoute(host, 1);
+    httpSetHostDefaultRoute(host, route);
+    auth = route->auth;
+    httpSetAuthRealm(auth, AUTH_REALM);
+    httpSetAuthStore(auth, "config");
+    auth->flags |= HTTP_AUTH_NO_SESSION;
+
+    net = httpCreateNet(mprCreateDispatcher("auth", 0), NULL, 1, 0);
+    stream = httpCreateStream(net, 1);
+    stream->host = host;
+    stream->rx->route = route;
+    mprAddRoot(stream);
+
+    testCache();
+    testWorker();
+    testWorkerCredentials();
+    testBenchmark();
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
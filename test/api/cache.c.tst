@@ -0,0 +1,181 @@
+/**
+    cache.c.tst - tests for the sharded in-memory cache
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+/*********************************** Locals ***********************************/
+
+#define CACHE_THREADS   4
+#define CACHE_KEYS      1000
+#define CACHE_OPS       50000
+
+static MprCache *cache;
+static volatile int finished;
+
+/************************************ Code ************************************/
+
+static void testReadWrite()
+{
+    MprTime     modified;
+    int64       version;
+    char        *value;
+
+    ttrue(mprWriteCache(cache, "color", "red", 0, -1, 0, 0) > 0);
+    value = mprReadCache(cache, "color", &modified, &version);
+    ttrue(smatch(value, "red"));
+    ttrue(modified > 0);
+    ttrue(version == 1);
+
+    /* Transactional write with a stale version must fail */
+    ttrue(mprWriteCache(cache, "color", "green", 0, -1, version, 0) > 0);
+    ttrue(mprWriteCache(cache, "color", "blue", 0, -1, version, 0) == MPR_ERR_BAD_STATE);
+    ttrue(smatch(mprLookupCache(cache, "color", NULL, NULL), "green"));
+
+    ttrue(mprWriteCache(cache, "color", "-dark", 0, -1, 0, MPR_CACHE_APPEND) > 0);
+    ttrue(smatch(mprReadCache(cache, "color", NULL, NULL), "green-dark"));
+    ttrue(mprWriteCache(cache, "color", "red", 0, -1, 0, MPR_CACHE_ADD) == 0);
+
+    ttrue(mprIncCache(cache, "counter", 5) == 5);
+    ttrue(mprIncCache(cache, "counter", -2) == 3);
+
+    ttrue(mprRemoveCache(cache, "color"));
+    ttrue(!mprRemoveCache(cache, "color"));
+    ttrue(mprReadCache(cache, "color", NULL, NULL) == 0);
+    ttrue(mprRemoveCache(cache, "counter"));
+}
+
+
+static void testBlock()
+{
+    char    *value;
+    ssize   len;
+
+    /* Binary items may contain nulls and are stored with their length */
+    ttrue(mprWriteCacheBlock(cache, "block", "a\0b\0c", 5, 0, -1, 0, 0) > 0);
+    value = mprReadCacheBlock(cache, "block", &len, NULL, NULL);
+    ttrue(len == 5 && memcmp(value, "a\0b\0c", 5) == 0 && value[5] == '\0');
+
+    ttrue(mprWriteCacheBlock(cache, "block", "\0d", 2, 0, -1, 0, MPR_CACHE_APPEND) > 0);
+    value = mprReadCacheBlock(cache, "block", &len, NULL, NULL);
+    ttrue(len == 7 && memcmp(value, "a\0b\0c\0d", 7) == 0);
+    ttrue(mprRemoveCache(cache, "block"));
+
+    /* Text items report their length */
+    mprWriteCache(cache, "text", "hello", 0, -1, 0, 0);
+    ttrue(smatch(mprReadCacheBlock(cache, "text", &len, NULL, NULL), "hello") && len == 5);
+    ttrue(mprRemoveCache(cache, "text"));
+}
+
+
+static void testShards()
+{
+    ssize   mem;
+    int     i, keys;
+
+    for (i = 0; i < CACHE_KEYS; i++) {
+        mprWriteCache(cache, sfmt("key-%d", i), sfmt("value-%d", i), 0, -1, 0, 0);
+    }
+    mprGetCacheStats(cache, &keys, &mem);
+    ttrue(keys == CACHE_KEYS);
+    ttrue(mem > 0);
+    for (i = 0; i < CACHE_KEYS; i++) {
+        if (!smatch(mprReadCache(cache, sfmt("key-%d", i), NULL, NULL), sfmt("value-%d", i))) {
+            break;
+        }
+    }
+    ttrue(i == CACHE_KEYS);
+
+    /* Pruning without a timer expires every item in every shard */
+    mprPruneCache(cache);
+    mprGetCacheStats(cache, &keys, &mem);
+    ttrue(keys == 0);
+    ttrue(mem == 0);
+}
+
+
+static void cacheWorker(void *data, MprThread *tp)
+{
+    char    key[32];
+    int     i, id;
+
+    id = (int) PTOI(data);
+    for (i = 0; i < CACHE_OPS; i++) {
+        fmt(key, sizeof(key), "%d-%d", id, i % CACHE_KEYS);
+        if (((i / CACHE_KEYS) % 10) == 0) {
+            mprWriteCache(cache, key, "value", 0, -1, 0, 0);
+        } else {
+            mprLookupCache(cache, key, NULL, NULL);
+        }
+    }
+    mprAtomicAdd(&finished, 1);
+}
+
+
+/*
+    Concurrent readers and writers. Reports throughput as a micro-benchmark.
+ */
+static void testThreads()
+{
+    MprThread   *tp;
+    MprTicks    mark, elapsed;
+    int         i, keys;
+
+    mprEnableGC(0);
+    finished = 0;
+    mark = mprGetTicks();
+    for (i = 0; i < CACHE_THREADS; i++) {
+        tp = mprCreateThread("cache", cacheWorker, ITOP(i), 0);
+        ttrue(tp != 0);
+        mprStartThread(tp);
+    }
+    while (finished < CACHE_THREADS) {
+        mprNap(1);
+    }
+    elapsed = mprGetTicks() - mark;
+    mprEnableGC(1);
+
+    mprGetCacheStats(cache, &keys, NULL);
+    ttrue(keys == CACHE_THREADS * CACHE_KEYS);
+    tinfo("Cache: %d threads, %d ops in %lld msec", CACHE_THREADS, CACHE_THREADS * CACHE_OPS, (int64) elapsed);
+    mprPruneCache(cache);
+}
+
+
+int main(int argc, char **argv)
+{
+    mprCreate(argc, argv, 0);
+    cache = mprCreateCache(0);
+    mprAddRoot(cache);
+    testReadWrite();
+    testBlock();
+    testShards();
+    testThreads();
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
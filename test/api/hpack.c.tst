@@ -0,0 +1,218 @@
+/**
+    hpack.c.tst - tests for the HTTP/2 HPACK header table
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+/************************************ Code ************************************/
+
+#if ME_HTTP_HTTP2
+
+static void testStaticLookup()
+{
+    HttpHeaderTable *headers;
+    bool            withValue;
+
+    headers = httpCreatePackedHeaderTable(HTTP2_TABLE_SIZE);
+    ttrue(headers != 0);
+
+    ttrue(httpLookupPackedHeader(headers, ":method", "GET", &withValue) == HTTP2_METHOD_GET);
+    ttrue(withValue);
+    ttrue(httpLookupPackedHeader(headers, ":method", "POST", &withValue) == HTTP2_METHOD_POST);
+    ttrue(withValue);
+    ttrue(httpLookupPackedHeader(headers, ":status", "404", &withValue) == HTTP2_STATUS_404);
+    ttrue(withValue);
+
+    /* Name only matches return the first static entry with that name */
+    ttrue(httpLookupPackedHeader(headers, ":method", "PUT", &withValue) == HTTP2_METHOD_GET);
+    ttrue(!withValue);
+    ttrue(httpLookupPackedHeader(headers, ":status", "201", &withValue) == HTTP2_STATUS_200);
+    ttrue(!withValue);
+    ttrue(httpLookupPackedHeader(headers, "x-unknown", "value", &withValue) == 0);
+    ttrue(!withValue);
+}
+
+
+static void testDynamicTable()
+{
+    HttpHeaderTable *headers;
+    MprKeyValue     *kp;
+    bool            withValue;
+    int             i, index;
+
+    headers = httpCreatePackedHeaderTable(HTTP2_TABLE_SIZE);
+
+    /* New entries take the first dynamic index and existing entries move down */
+    ttrue(httpAddPackedHeader(headers, "x-first", "one") == 62);
+    ttrue(httpAddPackedHeader(headers, "x-second", "two") == 62);
+    ttrue(httpLookupPackedHeader(headers, "x-second", "two", &withValue) == 62);
+    ttrue(withValue);
+    ttrue(httpLookupPackedHeader(headers, "x-first", "one", &withValue) == 63);
+    ttrue(withValue);
+    ttrue(httpLookupPackedHeader(headers, "x-first", "other", &withValue) == 63);
+    ttrue(!withValue);
+
+    kp = httpGetPackedHeader(headers, 63);
+    ttrue(kp && smatch(kp->key, "x-first") && smatch(kp->value, "one"));
+    ttrue(httpGetPackedHeader(headers, 64) == 0);
+    ttrue(httpGetPackedHeader(headers, 0) == 0);
+
+    /* Fill beyond the initial capacity so the table must grow and evict */
+    for (i = 0; i < 1000; i++) {
+        ttrue(httpAddPackedHeader(headers, "x-header", sfmt("%d", i)) == 62);
+    }
+    ttrue(headers->size <= headers->max);
+    ttrue(httpLookupPackedHeader(headers, "x-header", "999", &withValue) == 62);
+    ttrue(withValue);
+    ttrue(httpLookupPackedHeader(headers, "x-header", "990", &withValue) == 71);
+    ttrue(withValue);
+    ttrue(httpLookupPackedHeader(headers, "x-first", "one", &withValue) == 0);
+
+    index = 62 + headers->count - 1;
+    kp = httpGetPackedHeader(headers, index);
+    ttrue(kp && smatch(kp->value, sfmt("%d", 1000 - headers->count)));
+    ttrue(httpGetPackedHeader(headers, index + 1) == 0);
+
+    /* Shrinking evicts the oldest entries (RFC 7541 4.3) */
+    ttrue(httpSetPackedHeadersMax(headers, 100) == 0);
+    ttrue(headers->size <= 100);
+    ttrue(httpLookupPackedHeader(headers, "x-header", "999", &withValue) == 62);
+    ttrue(withValue);
+
+    /* An entry larger than the table empties the table and is not an error (RFC 7541 4.4) */
+    ttrue(httpAddPackedHeader(headers, "x-large", sfmt("%0200d", 0)) == 0);
+    ttrue(headers->count == 0 && headers->size == 0);
+    ttrue(httpGetPackedHeader(headers, 62) == 0);
+}
+
+
+/*
+    Huffman examples from RFC 7541 C.4
+ */
+static void testHuffman()
+{
+    char    buf[256], dst[1024], out[257];
+    ssize   len;
+    int     i;
+
+    static uchar host[] = { 0xf1, 0xe3, 0xc2, 0xe5, 0xf2, 0x3a, 0x6b, 0xa0, 0xab, 0x90, 0xf4, 0xff };
+    static uchar value[] = { 0x25, 0xa8, 0x49, 0xe9, 0x5b, 0xb8, 0xe8, 0xb4, 0xbf };
+
+    ttrue(httpHuffEncodedLength("www.example.com", 15, 0) == sizeof(host));
+    ttrue(httpHuffEncode("www.example.com", 15, buf, 0) == sizeof(host));
+    ttrue(memcmp(buf, host, sizeof(host)) == 0);
+    ttrue(httpHuffEncode("custom-value", 12, buf, 0) == sizeof(value));
+    ttrue(memcmp(buf, value, sizeof(value)) == 0);
+    ttrue(httpHuffEncode("WWW.Example.COM", 15, buf, 1) == sizeof(host));
+    ttrue(memcmp(buf, host, sizeof(host)) == 0);
+
+    ttrue(httpHuffDecodeBuf(host, sizeof(host), dst, sizeof(dst)) == 15);
+    ttrue(smatch(dst, "www.example.com"));
+    ttrue(smatch(httpHuffDecode(value, sizeof(value)), "custom-value"));
+    ttrue(httpHuffDecodeBuf(host, sizeof(host), dst, 15) == MPR_ERR_WONT_FIT);
+
+    /* Every octet value, including those with the longest codes */
+    for (i = 0; i < 256; i++) {
+        buf[i] = (char) (255 - i);
+    }
+    len = httpHuffEncode(buf, 256, dst, 0);
+    ttrue(len == httpHuffEncodedLength(buf, 256, 0));
+    ttrue(httpHuffDecodeBuf((uchar*) dst, len, out, sizeof(out)) == 256);
+    ttrue(memcmp(buf, out, 256) == 0);
+    ttrue(httpHuffDecodeBuf((uchar*) dst, len, out, 256) == MPR_ERR_WONT_FIT);
+}
+
+
+/*
+    RFC 7541 5.2: padding must be under 8 bits of the EOS prefix and EOS must not appear
+ */
+static void testHuffmanPadding()
+{
+    char    dst[64];
+    uchar   bad[16];
+
+    static uchar host[] = { 0xf1, 0xe3, 0xc2, 0xe5, 0xf2, 0x3a, 0x6b, 0xa0, 0xab, 0x90, 0xf4, 0xff };
+    static uchar eos[] = { 0xff, 0xff, 0xff, 0xff };
+
+    /* Padding that is not all ones */
+    memcpy(bad, host, sizeof(host));
+    bad[sizeof(host) - 1] = 0xfe;
+    ttrue(httpHuffDecodeBuf(bad, sizeof(host), dst, sizeof(dst)) == MPR_ERR_BAD_FORMAT);
+
+    /* Padding of 8 bits or more */
+    bad[sizeof(host) - 1] = 0xff;
+    bad[sizeof(host)] = 0xff;
+    ttrue(httpHuffDecodeBuf(bad, sizeof(host) + 1, dst, sizeof(dst)) == MPR_ERR_BAD_FORMAT);
+
+    /* Explicit EOS */
+    ttrue(httpHuffDecodeBuf(eos, sizeof(eos), dst, sizeof(dst)) == MPR_ERR_BAD_FORMAT);
+    ttrue(httpHuffDecode(eos, sizeof(eos)) == 0);
+
+    /* Empty input decodes to an empty string */
+    ttrue(httpHuffDecodeBuf(host, 0, dst, sizeof(dst)) == 0 && dst[0] == '\0');
+}
+
+
+/*
+    Encode and decode typical header values. Reports throughput as a micro-benchmark.
+ */
+static void testHuffmanBenchmark()
+{
+    MprTicks    mark;
+    cchar       *value;
+    char        encoded[256], decoded[256];
+    ssize       len, total;
+    int         i;
+
+    value = "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0 Safari/537.36";
+    total = 0;
+    mark = mprGetTicks();
+    for (i = 0; i < 200000; i++) {
+        len = httpHuffEncode(value, slen(value), encoded, 0);
+        total += httpHuffDecodeBuf((uchar*) encoded, len, decoded, sizeof(decoded));
+    }
+    ttrue(smatch(decoded, value));
+    tinfo("Huffman: %d round trips, %lld bytes in %lld msec", i, (int64) total, (int64) (mprGetTicks() - mark));
+}
+#endif
+
+
+int main(int argc, char **argv)
+{
+    mprCreate(argc, argv, 0);
+#if ME_HTTP_HTTP2
+    httpCreate(HTTP_SERVER_SIDE);
+    testStaticLookup();
+    testDynamicTable();
+    testHuffman();
+    testHuffmanPadding();
+    testHuffmanBenchmark();
+#endif
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -0,0 +1,300 @@
+/**
+    pack.c.tst - tests for the packed binary encoding of hashes and JSON trees
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+/*********************************** Locals ***********************************/
+
+#define PACK_HEADERS    16
+#define PACK_ROUNDS     20000
+
+/************************************ Code ************************************/
+
+static MprHash *createHeaders()
+{
+    MprHash     *hash;
+    int         i;
+
+    hash = mprCreateHash(0, 0);
+    mprAddKey(hash, "Content-Type", sclone("text/html; charset=utf-8"));
+    mprAddKey(hash, "Cache-Control", sclone("public, max-age=3600"));
+    for (i = 2; i < PACK_HEADERS; i++) {
+        mprAddKey(hash, sfmt("X-Header-%d", i), sfmt("header value number %d", i));
+    }
+    return hash;
+}
+
+
+static bool sameHash(MprHash *a, MprHash *b)
+{
+    MprKey      *kp;
+
+    if (mprGetHashLength(a) != mprGetHashLength(b)) {
+        return 0;
+    }
+    for (ITERATE_KEYS(a, kp)) {
+        if (!smatch(kp->data, mprLookupKey(b, kp->key))) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+static void testHash()
+{
+    MprHash     *hash, *copy, *empty;
+    MprBuf      *buf;
+    ssize       len;
+
+    hash = createHeaders();
+    mprAddKey(hash, "Empty", sclone(""));
+    mprAddKey(hash, "Unicode", sclone("caf\xc3\xa9 \xe2\x82\xac"));
+    buf = mprCreateBuf(0, -1);
+    len = mprPackHash(buf, hash);
+    ttrue(len == mprGetBufLength(buf));
+    ttrue((uchar) *mprGetBufStart(buf) == MPR_PACK_HASH);
+
+    copy = mprCreateHash(0, 0);
+    ttrue(mprUnpackHash(copy, mprGetBufStart(buf), len, 0) == len);
+    ttrue(sameHash(hash, copy));
+    ttrue(smatch(mprLookupKey(copy, "Empty"), ""));
+
+    /* Data following the packed hash is not consumed */
+    mprPutStringToBuf(buf, "trailing");
+    copy = mprCreateHash(0, 0);
+    ttrue(mprUnpackHash(copy, mprGetBufStart(buf), mprGetBufLength(buf), 0) == len);
+
+    empty = mprCreateHash(0, 0);
+    mprFlushBuf(buf);
+    len = mprPackHash(buf, empty);
+    ttrue(len == 2);
+    ttrue(mprUnpackHash(copy, mprGetBufStart(buf), len, 0) == len);
+}
+
+
+static void testReference()
+{
+    MprHash     *hash, *ref;
+    MprBuf      *buf;
+    MprKey      *kp;
+    cchar       *data;
+    ssize       len;
+
+    hash = createHeaders();
+    buf = mprCreateBuf(0, -1);
+    len = mprPackHash(buf, hash);
+    data = mprGetBufStart(buf);
+
+    /* Keys and values reference the packed data */
+    ref = mprCreateHash(0, MPR_HASH_STATIC_ALL);
+    ttrue(mprUnpackHash(ref, data, len, MPR_PACK_REFERENCE) == len);
+    ttrue(sameHash(hash, ref));
+    for (ITERATE_KEYS(ref, kp)) {
+        if (kp->key < data || kp->key >= &data[len] || (cchar*) kp->data < data || (cchar*) kp->data >= &data[len]) {
+            break;
+        }
+    }
+    ttrue(kp == 0);
+}
+
+
+static void testCorrupt()
+{
+    MprHash     *hash;
+    MprBuf      *buf;
+    char        *data;
+    ssize       len, i;
+    int         accepted;
+
+    buf = mprCreateBuf(0, -1);
+    len = mprPackHash(buf, createHeaders());
+    data = mprMemdup(mprGetBufStart(buf), len);
+
+    /* Every truncation is rejected */
+    accepted = 0;
+    for (i = 0; i < len; i++) {
+        hash = mprCreateHash(0, MPR_HASH_STATIC_ALL);
+        accepted += mprUnpackHash(hash, data, i, MPR_PACK_REFERENCE) >= 0;
+    }
+    ttrue(accepted == 0);
+
+    /* Overlong lengths and missing terminators are rejected */
+    data[2] = (char) 0xff;
+    ttrue(mprUnpackHash(mprCreateHash(0, 0), data, len, 0) < 0);
+    ttrue(mprUnpackHash(mprCreateHash(0, 0), "\xa1\x01\x02z", 4, 0) < 0);
+    ttrue(mprUnpackHash(mprCreateHash(0, 0), "\xa1\xff\xff\xff\xff\xff\xff", 7, 0) < 0);
+    ttrue(mprUnpackHash(mprCreateHash(0, 0), "{}", 2, 0) < 0);
+    ttrue(mprUnpackJson("\xa2\x01\x00\x7f", 4, NULL) == 0);
+}
+
+
+static void testJson()
+{
+    MprJson     *obj, *copy;
+    MprBuf      *buf;
+    cchar       *text;
+    ssize       len, used;
+    int         depth;
+
+    text = "{name:'ralph',age:42,admin:true,nothing:null,tags:['a','b',{deep:[1,2,[]]}],empty:{}}";
+    obj = mprParseJson(text);
+    buf = mprCreateBuf(0, -1);
+    len = mprPackJson(buf, obj);
+    ttrue((uchar) *mprGetBufStart(buf) == MPR_PACK_JSON);
+
+    copy = mprUnpackJson(mprGetBufStart(buf), len, &used);
+    ttrue(copy != 0 && used == len);
+    ttrue(smatch(mprJsonToString(copy, 0), mprJsonToString(obj, 0)));
+    ttrue(smatch(mprGetJson(copy, "tags[2].deep[1]"), "2"));
+    ttrue(mprGetJsonObj(copy, "age")->type & MPR_JSON_NUMBER);
+
+    /* Excessive nesting is rejected */
+    for (depth = 0, text = "1"; depth < 100; depth++) {
+        text = sfmt("[%s]", text);
+    }
+    mprFlushBuf(buf);
+    len = mprPackJson(buf, mprParseJson(text));
+    ttrue(mprUnpackJson(mprGetBufStart(buf), len, NULL) == 0);
+}
+
+
+/*
+    Parse a cached response record with text headers as done before packed records
+ */
+static cchar *parseText(cchar *content, MprHash *headers)
+{
+    cchar   *data;
+    char    *header, *text, *key, *value, *tok;
+
+    if ((data = strstr(content, "\n\n")) == 0) {
+        return content;
+    }
+    text = snclone(content, data - content);
+    for (header = stok(text, "\n", &tok); header; header = stok(NULL, "\n", &tok)) {
+        key = ssplit(header, ": ", &value);
+        mprAddKey(headers, key, sclone(value));
+    }
+    return data + 2;
+}
+
+
+/*
+    Compare the JSON text encoding with the packed encoding for session state and cached response headers.
+    Reports timing and size as a micro-benchmark.
+ */
+static void testBenchmark()
+{
+    MprHash     *hash, *copy;
+    MprBuf      *buf;
+    MprKey      *kp;
+    MprTicks    mark, elapsed;
+    cchar       *text, *body, *record;
+    ssize       len, used;
+    int         i, failed;
+
+    hash = createHeaders();
+    mprAddRoot(hash);
+    failed = 0;
+
+    mark = mprGetTicks();
+    for (i = 0; i < PACK_ROUNDS; i++) {
+        text = mprSerialize(hash, 0);
+        copy = mprDeserialize(text);
+        failed += mprGetHashLength(copy) != PACK_HEADERS;
+        mprYield(0);
+    }
+    elapsed = mprGetTicks() - mark;
+
+    mark = mprGetTicks();
+    for (i = 0; i < PACK_ROUNDS; i++) {
+        buf = mprCreateBuf(ME_BUFSIZE, -1);
+        len = mprPackHash(buf, hash);
+        copy = mprCreateHash(ME_MAX_SESSION_HASH, 0);
+        failed += mprUnpackHash(copy, mprGetBufStart(buf), len, 0) != len || mprGetHashLength(copy) != PACK_HEADERS;
+        mprYield(0);
+    }
+    tinfo("Session: %d rounds, serialize %lld msec %d bytes, pack %lld msec %d bytes", PACK_ROUNDS,
+        (int64) elapsed, (int) slen(mprSerialize(hash, 0)), (int64) (mprGetTicks() - mark), (int) len);
+
+    /* Cached response records: headers followed by the body */
+    buf = mprCreateBuf(0, -1);
+    mprPutToBuf(buf, "X-Status: 200\n");
+    for (ITERATE_KEYS(hash, kp)) {
+        mprPutToBuf(buf, "%s: %s\n", kp->key, (char*) kp->data);
+    }
+    mprPutToBuf(buf, "\n<html><body>Cached content</body></html>");
+    record = sclone(mprGetBufStart(buf));
+    mprAddRoot(record);
+
+    mark = mprGetTicks();
+    for (i = 0; i < PACK_ROUNDS; i++) {
+        copy = mprCreateHash(0, 0);
+        body = parseText(record, copy);
+        failed += mprGetHashLength(copy) != PACK_HEADERS + 1 || *body != '<';
+        mprYield(0);
+    }
+    elapsed = mprGetTicks() - mark;
+    mprRemoveRoot(record);
+
+    buf = mprCreateBuf(0, -1);
+    copy = mprCloneHash(hash);
+    mprAddKey(copy, "X-Status", sclone("200"));
+    mprPackHash(buf, copy);
+    mprPutStringToBuf(buf, "<html><body>Cached content</body></html>");
+    record = mprMemdup(mprGetBufStart(buf), mprGetBufLength(buf) + 1);
+    len = mprGetBufLength(buf);
+    mprAddRoot(record);
+
+    mark = mprGetTicks();
+    for (i = 0; i < PACK_ROUNDS; i++) {
+        copy = mprCreateHash(0, MPR_HASH_STATIC_ALL);
+        used = mprUnpackHash(copy, record, len, MPR_PACK_REFERENCE);
+        failed += used < 0 || mprGetHashLength(copy) != PACK_HEADERS + 1 || record[used] != '<';
+        mprYield(0);
+    }
+    ttrue(failed == 0);
+    tinfo("Response: %d rounds, text headers %lld msec, packed headers %lld msec", PACK_ROUNDS, (int64) elapsed,
+        (int64) (mprGetTicks() - mark));
+    mprRemoveRoot(record);
+    mprRemoveRoot(hash);
+}
+
+
+int main(int argc, char **argv)
+{
+    mprCreate(argc, argv, 0);
+    testHash();
+    testReference();
+    testCorrupt();
+    testJson();
+    testBenchmark();
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
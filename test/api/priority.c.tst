@@ -0,0 +1,302 @@
+/**
+    priority.c.tst - tests for the HTTP/2 stream priority scheduler
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+/*********************************** Locals ***********************************/
+
+#define FRAME_SIZE      1024
+
+static HttpNet      *net;
+static HttpQueue    *q;
+
+/************************************ Code ************************************/
+
+#if ME_HTTP_HTTP2
+
+static HttpStream *createStream(int streamID)
+{
+    HttpStream  *stream;
+
+    stream = httpCreateStream(net, 0);
+    stream->streamID = streamID;
+    return stream;
+}
+
+
+static void destroyStreams()
+{
+    HttpStream  *stream;
+    int         next;
+
+    for (ITERATE_ITEMS(net->streams, stream, next)) {
+        httpDestroyStream(stream);
+        next--;
+    }
+    net->priorityTime = 0;
+}
+
+
+static void queuePacket(HttpStream *stream, int flags)
+{
+    HttpPacket  *packet;
+
+    packet = (flags & HTTP_PACKET_HEADER) ? httpCreateHeaderPacket() : httpCreateDataPacket(FRAME_SIZE);
+    packet->flags = flags;
+    packet->stream = stream;
+    httpPutForService(q, packet, HTTP_DELAY_SERVICE);
+}
+
+
+/*
+    Queue packets for the streams in round-robin order
+ */
+static void queueData(HttpStream **streams, int count, int packets)
+{
+    int     i, j;
+
+    for (j = 0; j < packets; j++) {
+        for (i = 0; i < count; i++) {
+            queuePacket(streams[i], HTTP_PACKET_DATA);
+        }
+    }
+}
+
+
+/*
+    Select and "send" all queued packets and return the order of stream IDs as a string
+ */
+static cchar *drain()
+{
+    HttpPacket  *packet;
+    MprBuf      *buf;
+
+    buf = mprCreateBuf(0, 0);
+    while ((packet = httpSelectHttp2Packet(q)) != 0) {
+        if (mprGetBufLength(buf) > 0) {
+            mprPutCharToBuf(buf, ',');
+        }
+        mprPutToBuf(buf, "%s%d", (packet->flags & HTTP_PACKET_HEADER) ? "H" : "", packet->stream->streamID);
+        if (packet->flags & HTTP_PACKET_DATA) {
+            httpUpdatePriorityTime(net, packet->stream, FRAME_SIZE);
+        }
+    }
+    mprAddNullToBuf(buf);
+    return mprGetBufStart(buf);
+}
+
+
+static void testUrgency()
+{
+    HttpStream  *streams[3];
+
+    streams[0] = createStream(1);
+    streams[1] = createStream(3);
+    streams[2] = createStream(5);
+    httpParsePriorityHeader(streams[0], "u=5");
+    httpParsePriorityHeader(streams[1], "u=1");
+
+    /* Lower urgency values go first. Stream 5 has the default urgency of 3. */
+    queueData(streams, 3, 2);
+    ttrue(smatch(drain(), "3,3,5,5,1,1"));
+
+    /* Headers go before data regardless of urgency */
+    queuePacket(streams[1], HTTP_PACKET_DATA);
+    queuePacket(streams[0], HTTP_PACKET_HEADER);
+    queuePacket(streams[0], HTTP_PACKET_DATA);
+    ttrue(smatch(drain(), "H1,3,1"));
+
+    /* Non-incremental responses go before incremental responses of equal urgency */
+    httpParsePriorityHeader(streams[0], "u=3, i");
+    httpParsePriorityHeader(streams[2], "u=3");
+    queueData(streams, 3, 2);
+    ttrue(smatch(drain(), "3,3,5,5,1,1"));
+    destroyStreams();
+}
+
+
+static void testIncremental()
+{
+    HttpStream  *streams[3];
+    cchar       *order;
+    int         i, heavy;
+
+    /* Streams without a priority header share the connection round-robin */
+    streams[0] = createStream(5);
+    streams[1] = createStream(3);
+    streams[2] = createStream(1);
+    queueData(streams, 3, 3);
+    ttrue(smatch(drain(), "5,3,1,5,3,1,5,3,1"));
+
+    /* Non-incremental responses of equal urgency are sent one at a time in stream order */
+    for (i = 0; i < 3; i++) {
+        httpParsePriorityHeader(streams[i], "u=3");
+    }
+    queueData(streams, 3, 3);
+    ttrue(smatch(drain(), "1,1,1,3,3,3,5,5,5"));
+    destroyStreams();
+
+    /* Incremental responses share the connection round-robin */
+    streams[0] = createStream(5);
+    streams[1] = createStream(3);
+    streams[2] = createStream(1);
+    for (i = 0; i < 3; i++) {
+        httpParsePriorityHeader(streams[i], "u=3, i");
+    }
+    queueData(streams, 3, 3);
+    ttrue(smatch(drain(), "5,3,1,5,3,1,5,3,1"));
+
+    /* An idle stream rejoins at the current time and cannot claim credit for the time it had nothing to send */
+    queueData(streams, 2, 4);
+    ttrue(smatch(drain(), "5,3,5,3,5,3,5,3"));
+    queueData(streams, 3, 2);
+    ttrue(smatch(drain(), "1,5,3,1,5,3"));
+    destroyStreams();
+
+    /* Weighted fair share. Twice the weight sends twice the data. */
+    streams[0] = createStream(1);
+    streams[1] = createStream(3);
+    httpParsePriorityHeader(streams[0], "i");
+    httpParsePriorityHeader(streams[1], "i");
+    streams[0]->weight = 2 * HTTP2_DEFAULT_WEIGHT;
+    queueData(streams, 2, 12);
+    order = drain();
+    for (heavy = 0, i = 0; i < 12; i++) {
+        heavy += order[i * 2] == '1';
+    }
+    ttrue(heavy == 8);
+    destroyStreams();
+}
+
+
+static void testDependency()
+{
+    HttpStream  *streams[3];
+
+    /* Dependent streams wait while an ancestor has data to send */
+    streams[0] = createStream(5);
+    streams[1] = createStream(3);
+    streams[2] = createStream(1);
+    streams[0]->dependency = 3;
+    streams[1]->dependency = 1;
+    queueData(streams, 3, 2);
+    ttrue(smatch(drain(), "1,1,3,3,5,5"));
+
+    /* Dependency takes precedence over urgency */
+    httpParsePriorityHeader(streams[0], "u=0");
+    queueData(streams, 3, 1);
+    ttrue(smatch(drain(), "1,3,5"));
+
+    /* Parents without queued data do not block */
+    queueData(streams, 2, 2);
+    ttrue(smatch(drain(), "3,3,5,5"));
+
+    /* Dependencies on unknown streams are ignored */
+    streams[1]->dependency = 99;
+    queueData(streams, 2, 1);
+    ttrue(smatch(drain(), "3,5"));
+
+    /* Cyclic dependencies do not stall the scheduler */
+    streams[1]->dependency = 5;
+    queueData(streams, 2, 2);
+    ttrue(smatch(drain(), "5,3,5,3"));
+    destroyStreams();
+}
+
+
+static int parseUrgency(cchar *value, bool *incremental)
+{
+    HttpStream  *stream;
+    int         urgency;
+
+    stream = createStream(1);
+    httpParsePriorityHeader(stream, value);
+    urgency = stream->urgency;
+    *incremental = stream->incremental;
+    destroyStreams();
+    return urgency;
+}
+
+
+static void testPriorityHeader()
+{
+    bool    incremental;
+
+    ttrue(parseUrgency("u=0", &incremental) == 0 && !incremental);
+    ttrue(parseUrgency("u=7, i", &incremental) == 7 && incremental);
+    ttrue(parseUrgency("i, u=2", &incremental) == 2 && incremental);
+    ttrue(parseUrgency("  u=1 ,\ti=?1 ", &incremental) == 1 && incremental);
+    ttrue(parseUrgency("i, i=?0", &incremental) == HTTP2_DEFAULT_URGENCY && !incremental);
+    ttrue(parseUrgency("", &incremental) == HTTP2_DEFAULT_URGENCY && !incremental);
+
+    /* Out of range and malformed urgencies are ignored */
+    ttrue(parseUrgency("u=9", &incremental) == HTTP2_DEFAULT_URGENCY);
+    ttrue(parseUrgency("u=8, i", &incremental) == HTTP2_DEFAULT_URGENCY && incremental);
+    ttrue(parseUrgency("u=", &incremental) == HTTP2_DEFAULT_URGENCY);
+    ttrue(parseUrgency("u", &incremental) == HTTP2_DEFAULT_URGENCY);
+    ttrue(parseUrgency("u=-1", &incremental) == HTTP2_DEFAULT_URGENCY);
+    ttrue(parseUrgency("u=+1", &incremental) == HTTP2_DEFAULT_URGENCY);
+    ttrue(parseUrgency("u=1x", &incremental) == HTTP2_DEFAULT_URGENCY);
+    ttrue(parseUrgency("u=1.5", &incremental) == HTTP2_DEFAULT_URGENCY);
+    ttrue(parseUrgency("u=007", &incremental) == 7);
+    ttrue(parseUrgency("u=99999999999999999999", &incremental) == HTTP2_DEFAULT_URGENCY);
+    ttrue(parseUrgency("i=1, i=?", &incremental) == HTTP2_DEFAULT_URGENCY && !incremental);
+
+    /* Unknown members and member parameters are ignored */
+    ttrue(parseUrgency("foo=bar, u=2;x=y, junk", &incremental) == 2 && !incremental);
+    ttrue(parseUrgency(",,;, i;a, =, u=4;", &incremental) == 4 && incremental);
+}
+
+
+int main(int argc, char **argv)
+{
+    mprCreate(argc, argv, 0);
+    httpCreate(HTTP_CLIENT_SIDE);
+
+    net = httpCreateNet(mprCreateDispatcher("priority", 0), NULL, HTTP_2, 0);
+    q = httpCreateQueueHead(net, NULL, "scheduler", HTTP_QUEUE_TX);
+    mprAddRoot(net);
+    mprAddRoot(q);
+
+    testUrgency();
+    testIncremental();
+    testDependency();
+    testPriorityHeader();
+    return 0;
+}
+
+#else
+
+int main(int argc, char **argv)
+{
+    return 0;
+}
+
+#endif /* ME_HTTP_HTTP2 */
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -0,0 +1,577 @@
+/**
+    proxy.c.tst - tests for the reverse proxy handler against local upstream servers
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+/*********************************** Locals ***********************************/
+
+#define PROXY_PORT      4190
+#define UPSTREAM_A      4191
+#define UPSTREAM_B      4192
+#define UPSTREAM_DOWN   4193                /* Nothing listens on this port */
+#define BODY_SIZE       (4 * 1024 * 1024 + 1234)
+#define HEALTH_PERIOD   500
+#define SLOW_DELAY      1000
+
+/*
+    Request body received by an upstream
+ */
+typedef struct Sink {
+    MprOff      length;
+    uint        sum;
+} Sink;
+
+static MprDispatcher *dispatcher;
+static MprList      *endpoints;
+static HttpProxy    *pooled, *roundRobin, *leastConn, *failover, *checked;
+#if ME_HTTP_HTTP2
+static HttpProxy    *multiplexed;
+#endif
+static char         *body;
+static uint         bodySum;
+static volatile int healthStatus = HTTP_CODE_OK;
+
+/************************************ Code ************************************/
+
+static uint checksum(uint sum, cchar *data, ssize len)
+{
+    ssize   i;
+
+    for (i = 0; i < len; i++) {
+        sum = sum * 31 + (uchar) data[i];
+    }
+    return sum;
+}
+
+/*
+    Upstream handler. Responds with a JSON description of the request as received by the upstream.
+ */
+static int openUpstream(HttpQueue *q)
+{
+    q->queueData = mprAllocObj(Sink, NULL);
+    if (q->pair) {
+        q->pair->queueData = q->queueData;
+    }
+    return 0;
+}
+
+
+static void incomingUpstream(HttpQueue *q, HttpPacket *packet)
+{
+    Sink    *sink;
+    ssize   len;
+
+    sink = q->queueData;
+    if (packet->flags & HTTP_PACKET_END) {
+        httpFinalizeInput(q->stream);
+
+    } else if ((len = httpGetPacketLength(packet)) > 0) {
+        sink->length += len;
+        sink->sum = checksum(sink->sum, mprGetBufStart(packet->content), len);
+    }
+}
+
+
+static void respond(HttpStream *stream, Sink *sink)
+{
+    MprJson     *json;
+    cchar       **hp, *value;
+
+    static cchar *headers[] = {
+        "keep-alive", "proxy-authorization", "te", "x-custom", "x-forwarded-for", "x-forwarded-host",
+        "x-forwarded-proto", "x-hop", 0
+    };
+    json = mprCreateJson(MPR_JSON_OBJ);
+    mprSetJson(json, "port", itos(stream->net->endpoint->port), MPR_JSON_NUMBER);
+    mprSetJson(json, "remote", itos(stream->port), MPR_JSON_NUMBER);
+    mprSetJson(json, "protocol", itos(stream->net->protocol), MPR_JSON_NUMBER);
+    mprSetJson(json, "length", itos(sink ? sink->length : 0), MPR_JSON_NUMBER);
+    mprSetJson(json, "sum", sfmt("%u", sink ? sink->sum : 0), 0);
+    for (hp = headers; *hp; hp++) {
+        if ((value = httpGetHeader(stream, *hp)) != 0) {
+            mprSetJson(json, *hp, value, 0);
+        }
+    }
+    httpSetHeaderString(stream, "X-Upstream", "yes");
+    httpSetHeaderString(stream, "Proxy-Authenticate", "Basic realm=\"upstream\"");
+    httpSetContentType(stream, "application/json");
+    httpSetStatus(stream, HTTP_CODE_OK);
+    httpWrite(stream->writeq, "%s", mprJsonToString(json, 0));
+    httpFinalize(stream);
+}
+
+
+static void slowResponse(HttpStream *stream, MprEvent *event)
+{
+    if (!stream->destroyed) {
+        respond(stream, NULL);
+        httpProcess(stream->inputq);
+    }
+}
+
+
+static void readyUpstream(HttpQueue *q)
+{
+    HttpStream  *stream;
+    cchar       *name;
+
+    stream = q->stream;
+    name = stream->rx->pathInfo;
+    if (smatch(name, "/up/health")) {
+        httpSetStatus(stream, healthStatus);
+        httpFinalize(stream);
+
+    } else if (smatch(name, "/up/slow")) {
+        mprCreateEvent(stream->dispatcher, "slowResponse", SLOW_DELAY, slowResponse, stream, 0);
+
+    } else {
+        respond(stream, q->queueData);
+    }
+}
+
+
+static HttpProxy *createProxy(HttpRoute *parent, cchar *prefix, int balance, int protocol, cchar *upstreams)
+{
+    HttpProxy   *proxy;
+    HttpRoute   *route;
+    char        *port, *tok;
+
+    proxy = httpCreateProxy(balance, protocol);
+    for (port = stok(sclone(upstreams), " ", &tok); port; port = stok(NULL, " ", &tok)) {
+        ttrue(httpAddProxyUpstream(proxy, sfmt("http://127.0.0.1:%s/up", port)) != 0);
+    }
+    route = httpCreateInheritedRoute(parent);
+    httpSetRoutePattern(route, sfmt("^%s/", prefix), 0);
+    httpSetRoutePrefix(route, prefix);
+    ttrue(httpSetRouteProxy(route, proxy) == 0);
+    httpFinalizeRoute(route);
+    return proxy;
+}
+
+
+static bool listenOn(HttpHost *host, int port)
+{
+    HttpEndpoint    *endpoint;
+
+    if ((endpoint = httpCreateEndpoint("127.0.0.1", port, NULL)) == 0) {
+        return 0;
+    }
+    httpAddHostToEndpoint(endpoint, host);
+    if (httpStartEndpoint(endpoint) < 0) {
+        tskip("Cannot listen on port %d", port);
+        return 0;
+    }
+    mprAddItem(endpoints, endpoint);
+    return 1;
+}
+
+
+/*
+    The proxy and the upstreams share one host. The upstreams listen on their own ports and serve "/up/".
+ */
+static bool startServer()
+{
+    HttpStage   *stage;
+    HttpHost    *host;
+    HttpRoute   *parent, *route;
+
+    if (tget("TM_DEBUG", 0)) {
+        httpStartTracing("stdout:4");
+    }
+    HTTP->serverLimits->rxBodySize = HTTP_UNLIMITED;
+
+    stage = httpCreateHandler("upstreamHandler", NULL);
+    stage->open = openUpstream;
+    stage->incoming = incomingUpstream;
+    stage->ready = readyUpstream;
+
+    host = httpGetDefaultHost();
+    parent = httpGetHostDefaultRoute(host);
+    httpSetRouteDocuments(parent, ".");
+    httpSetRouteHome(parent, ".");
+    httpFinalizeRoute(parent);
+
+    route = httpCreateInheritedRoute(parent);
+    httpSetRoutePattern(route, "^/up/", 0);
+    httpSetRouteHandler(route, "upstreamHandler");
+    httpSetRouteMethods(route, "*");
+    httpFinalizeRoute(route);
+
+    pooled = createProxy(parent, "/pool", HTTP_PROXY_ROUND_ROBIN, 1, sfmt("%d", UPSTREAM_A));
+    roundRobin = createProxy(parent, "/rr", HTTP_PROXY_ROUND_ROBIN, 1, sfmt("%d %d", UPSTREAM_A, UPSTREAM_B));
+    leastConn = createProxy(parent, "/lc", HTTP_PROXY_LEAST_CONN, 1, sfmt("%d %d", UPSTREAM_A, UPSTREAM_B));
+    failover = createProxy(parent, "/failover", HTTP_PROXY_ROUND_ROBIN, 1, sfmt("%d %d", UPSTREAM_DOWN, UPSTREAM_A));
+    httpSetProxyHealth(failover, NULL, HEALTH_PERIOD, 2);
+    checked = createProxy(parent, "/checked", HTTP_PROXY_ROUND_ROBIN, 1, sfmt("%d", UPSTREAM_A));
+    httpSetProxyHealth(checked, "/health", HEALTH_PERIOD, 1);
+#if ME_HTTP_HTTP2
+    multiplexed = createProxy(parent, "/h2", HTTP_PROXY_ROUND_ROBIN, 2, sfmt("%d", UPSTREAM_A));
+#endif
+    return listenOn(host, PROXY_PORT) && listenOn(host, UPSTREAM_A) && listenOn(host, UPSTREAM_B);
+}
+
+
+/*
+    Issue a request to the proxy. The client owns its dispatcher so network events only run while it waits.
+ */
+static HttpStream *startRequest(cchar *method, cchar *uri, cchar *data, ssize len, bool chunked)
+{
+    HttpNet     *net;
+    HttpStream  *stream;
+
+    net = httpCreateNet(dispatcher, NULL, 1, 0);
+    stream = httpCreateStream(net, 0);
+    if (data && !chunked) {
+        httpSetContentLength(stream, len);
+    }
+    if (httpConnect(stream, method, sfmt("http://127.0.0.1:%d%s", PROXY_PORT, uri), NULL) < 0) {
+        httpDestroyNet(net);
+        return 0;
+    }
+    if (data) {
+        httpWriteBlock(stream->writeq, data, len, HTTP_BLOCK);
+    }
+    httpFinalizeOutput(stream);
+    return stream;
+}
+
+
+/*
+    Read the response body. Responses relayed from HTTP/2 upstreams have no content length and use chunking.
+ */
+static MprJson *readResponse(HttpStream *stream)
+{
+    MprBuf      *buf;
+    char        data[ME_BUFSIZE];
+    ssize       nbytes;
+
+    buf = mprCreateBuf(0, 0);
+    while ((nbytes = httpRead(stream, data, sizeof(data))) > 0) {
+        mprPutBlockToBuf(buf, data, nbytes);
+    }
+    mprAddNullToBuf(buf);
+    return mprParseJson(mprGetBufStart(buf));
+}
+
+
+/*
+    Wait for the response and return the JSON description from the upstream
+ */
+static MprJson *finishRequest(HttpStream *stream, int *status)
+{
+    MprJson     *json;
+
+    *status = 0;
+    if (!stream) {
+        return 0;
+    }
+    httpWait(stream, HTTP_STATE_COMPLETE, 30 * 1000);
+    *status = httpGetStatus(stream);
+    json = readResponse(stream);
+    httpDestroyNet(stream->net);
+    return json;
+}
+
+
+static MprJson *request(cchar *method, cchar *uri, cchar *data, ssize len, int *status)
+{
+    return finishRequest(startRequest(method, uri, data, len, 0), status);
+}
+
+
+static int getPort(cchar *uri)
+{
+    MprJson     *json;
+    int         status;
+
+    json = request("GET", uri, NULL, 0, &status);
+    return (status == HTTP_CODE_OK && json) ? (int) stoi(mprGetJson(json, "port")) : 0;
+}
+
+
+/*
+    Wait for a proxy condition that is updated by other threads
+ */
+static bool waitFor(volatile int *value, int expected, MprTicks timeout)
+{
+    MprTicks    mark;
+
+    for (mark = mprGetTicks(); *value != expected; mprSleep(10)) {
+        if (mprGetElapsedTicks(mark) > timeout) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+/*
+    Request bodies larger than the upstream queue are streamed with flow control and must arrive intact,
+    with and without a content length
+ */
+static void testBody()
+{
+    MprJson     *json;
+    int         status;
+
+    json = request("POST", "/pool/echo", body, BODY_SIZE, &status);
+    ttrue(status == HTTP_CODE_OK);
+    ttrue(json && stoi(mprGetJson(json, "length")) == BODY_SIZE);
+    ttrue(json && smatch(mprGetJson(json, "sum"), sfmt("%u", bodySum)));
+
+    json = finishRequest(startRequest("PUT", "/pool/echo", body, BODY_SIZE, 1), &status);
+    ttrue(status == HTTP_CODE_OK);
+    ttrue(json && stoi(mprGetJson(json, "length")) == BODY_SIZE);
+    ttrue(json && smatch(mprGetJson(json, "sum"), sfmt("%u", bodySum)));
+    ttrue(waitFor(&((HttpUpstream*) mprGetFirstItem(pooled->upstreams))->active, 0, 5000));
+}
+
+
+/*
+    Completed upstream connections are parked and reused by the next request
+ */
+static void testPool()
+{
+    HttpUpstream    *up;
+    MprJson         *json;
+    int             remote, status;
+
+    up = mprGetFirstItem(pooled->upstreams);
+    json = request("GET", "/pool/echo", NULL, 0, &status);
+    ttrue(status == HTTP_CODE_OK && json);
+    remote = json ? (int) stoi(mprGetJson(json, "remote")) : 0;
+    ttrue(waitFor(&up->active, 0, 5000));
+    ttrue(mprGetListLength(up->idle) == 1);
+
+    json = request("GET", "/pool/echo", NULL, 0, &status);
+    ttrue(status == HTTP_CODE_OK && json);
+    ttrue(json && stoi(mprGetJson(json, "remote")) == remote);
+    ttrue(waitFor(&up->active, 0, 5000));
+    ttrue(mprGetListLength(up->idle) == 1);
+}
+
+
+static void testRoundRobin()
+{
+    int     ports[4], i;
+
+    for (i = 0; i < 4; i++) {
+        ports[i] = getPort("/rr/echo");
+        ttrue(ports[i] == UPSTREAM_A || ports[i] == UPSTREAM_B);
+    }
+    ttrue(ports[0] != ports[1]);
+    ttrue(ports[0] == ports[2]);
+    ttrue(ports[1] == ports[3]);
+}
+
+
+/*
+    While one upstream is busy with a slow request, requests go to the other upstream
+ */
+static void testLeastConnections()
+{
+    HttpUpstream    *a, *b, *idle;
+    HttpStream      *slow;
+    MprJson         *json;
+    MprTicks        mark;
+    int             busy, i, status;
+
+    a = mprGetItem(leastConn->upstreams, 0);
+    b = mprGetItem(leastConn->upstreams, 1);
+    slow = startRequest("GET", "/lc/slow", NULL, 0, 0);
+    ttrue(slow != 0);
+    mprAddRoot(slow);
+    for (mark = mprGetTicks(); (a->active + b->active) == 0 && mprGetElapsedTicks(mark) < 5000; ) {
+        httpEnableNetEvents(slow->net);
+        mprWaitForEvent(dispatcher, 10, -1);
+    }
+    ttrue(a->active + b->active == 1);
+    busy = a->active ? UPSTREAM_A : UPSTREAM_B;
+
+    idle = (busy == UPSTREAM_A) ? b : a;
+    for (i = 0; i < 3; i++) {
+        ttrue(getPort("/lc/echo") == (busy == UPSTREAM_A ? UPSTREAM_B : UPSTREAM_A));
+        /* The upstream is released just after the response is relayed */
+        ttrue(waitFor(&idle->active, 0, 5000));
+    }
+    json = finishRequest(slow, &status);
+    mprRemoveRoot(slow);
+    ttrue(status == HTTP_CODE_OK);
+    ttrue(json && stoi(mprGetJson(json, "port")) == busy);
+}
+
+
+/*
+    Requests fail over from an upstream that refuses connections. After repeated failures it is taken out of service.
+    The timer returns it on probation where a single further failure takes it out again.
+ */
+static void testFailover()
+{
+    HttpUpstream    *down;
+
+    down = mprGetItem(failover->upstreams, 0);
+    ttrue(getPort("/failover/echo") == UPSTREAM_A);
+    ttrue(down->healthy && down->failures == 1);
+    ttrue(getPort("/failover/echo") == UPSTREAM_A);
+    ttrue(!down->healthy);
+
+    ttrue(waitFor(&down->healthy, 1, HEALTH_PERIOD * 4));
+    ttrue(down->failures == 1);
+    ttrue(getPort("/failover/echo") == UPSTREAM_A);
+    ttrue(!down->healthy);
+}
+
+
+/*
+    Health probes take an upstream out of service and return it when it recovers
+ */
+static void testHealth()
+{
+    HttpUpstream    *up;
+    int             status;
+
+    up = mprGetFirstItem(checked->upstreams);
+    ttrue(getPort("/checked/echo") == UPSTREAM_A);
+
+    healthStatus = HTTP_CODE_SERVICE_UNAVAILABLE;
+    ttrue(waitFor(&up->healthy, 0, HEALTH_PERIOD * 4));
+    request("GET", "/checked/echo", NULL, 0, &status);
+    ttrue(status == HTTP_CODE_SERVICE_UNAVAILABLE);
+
+    healthStatus = HTTP_CODE_OK;
+    ttrue(waitFor(&up->healthy, 1, HEALTH_PERIOD * 4));
+    ttrue(getPort("/checked/echo") == UPSTREAM_A);
+}
+
+
+/*
+    Hop-by-hop headers, including those nominated by Connection, are not forwarded in either direction
+ */
+static void testHeaders()
+{
+    HttpNet     *net;
+    HttpStream  *stream;
+    MprJson     *json;
+
+    net = httpCreateNet(dispatcher, NULL, 1, 0);
+    stream = httpCreateStream(net, 0);
+    httpSetHeaderString(stream, "X-Hop", "private");
+    httpSetHeaderString(stream, "Keep-Alive", "timeout=5");
+    httpSetHeaderString(stream, "TE", "trailers");
+    httpSetHeaderString(stream, "Proxy-Authorization", "Basic dXNlcjpwYXNz");
+    httpSetHeaderString(stream, "X-Forwarded-For", "10.0.0.1");
+    httpSetHeaderString(stream, "X-Custom", "kept");
+    ttrue(httpConnect(stream, "GET", sfmt("http://127.0.0.1:%d/pool/echo", PROXY_PORT), NULL) >= 0);
+    /* The client defines the Connection header when connecting */
+    httpSetHeaderString(stream, "Connection", "Keep-Alive, X-Hop");
+    httpFinalizeOutput(stream);
+    httpWait(stream, HTTP_STATE_COMPLETE, 30 * 1000);
+    ttrue(httpGetStatus(stream) == HTTP_CODE_OK);
+
+    json = readResponse(stream);
+    ttrue(json != 0);
+    if (json) {
+        ttrue(smatch(mprGetJson(json, "x-custom"), "kept"));
+        ttrue(mprGetJson(json, "x-hop") == 0);
+        ttrue(mprGetJson(json, "keep-alive") == 0);
+        ttrue(mprGetJson(json, "te") == 0);
+        ttrue(mprGetJson(json, "proxy-authorization") == 0);
+        ttrue(smatch(mprGetJson(json, "x-forwarded-for"), "10.0.0.1, 127.0.0.1"));
+        ttrue(smatch(mprGetJson(json, "x-forwarded-host"), sfmt("127.0.0.1:%d", PROXY_PORT)));
+        ttrue(smatch(mprGetJson(json, "x-forwarded-proto"), "http"));
+    }
+    ttrue(smatch(httpGetHeader(stream, "x-upstream"), "yes"));
+    ttrue(httpGetHeader(stream, "proxy-authenticate") == 0);
+    httpDestroyNet(net);
+}
+
+
+/*
+    An HTTP/2 upstream connection carries requests and bodies and is kept for reuse
+ */
+static void testHttp2()
+{
+#if ME_HTTP_HTTP2
+    HttpUpstream    *up;
+    MprJson         *json;
+    int             remote, status;
+
+    up = mprGetFirstItem(multiplexed->upstreams);
+    json = request("GET", "/h2/echo", NULL, 0, &status);
+    ttrue(status == HTTP_CODE_OK && json);
+    ttrue(json && stoi(mprGetJson(json, "protocol")) == 2);
+    remote = json ? (int) stoi(mprGetJson(json, "remote")) : 0;
+    ttrue(waitFor(&up->active, 0, 5000));
+
+    json = request("POST", "/h2/echo", body, BODY_SIZE, &status);
+    ttrue(status == HTTP_CODE_OK && json);
+    ttrue(json && stoi(mprGetJson(json, "length")) == BODY_SIZE);
+    ttrue(json && smatch(mprGetJson(json, "sum"), sfmt("%u", bodySum)));
+    ttrue(json && stoi(mprGetJson(json, "remote")) == remote);
+    ttrue(waitFor(&up->active, 0, 5000));
+#endif
+}
+
+
+int main(int argc, char **argv)
+{
+    HttpEndpoint    *endpoint;
+    int             next;
+
+    mprCreate(argc, argv, 0);
+    httpCreate(HTTP_CLIENT_SIDE | HTTP_SERVER_SIDE);
+    mprAddStandardSignals();
+    mprStartWorkerService();
+
+    endpoints = mprCreateList(0, 0);
+    mprAddRoot(endpoints);
+    body = mprAlloc(BODY_SIZE);
+    mprAddRoot(body);
+    mprGetRandomBytes(body, BODY_SIZE, 0);
+    bodySum = checksum(0, body, BODY_SIZE);
+    dispatcher = mprCreateDispatcher("client", 0);
+    mprAddRoot(dispatcher);
+    mprStartDispatcher(dispatcher);
+
+    if (startServer()) {
+        testBody();
+        testPool();
+        testRoundRobin();
+        testLeastConnections();
+        testFailover();
+        testHealth();
+        testHeaders();
+        testHttp2();
+    }
+    for (ITERATE_ITEMS(endpoints, endpoint, next)) {
+        httpStopEndpoint(endpoint);
+    }
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -0,0 +1,289 @@
+/**
+    route.c.tst - tests for request routing and the route dispatch trie
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+#include    "pcre.h"
+
+/*********************************** Locals ***********************************/
+
+#define ROUTE_LOOKUPS   20000
+#define STUDY_MATCHES   200000
+
+static HttpStream *stream;
+
+/************************************ Code ************************************/
+
+static HttpHost *createHost()
+{
+    HttpHost    *host;
+    HttpRoute   *route;
+
+    host = httpCreateHost();
+    route = httpCreateConfiguredRoute(host, 1);
+    httpSetRouteHandler(route, "passHandler");
+    httpSetHostDefaultRoute(host, route);
+    httpFinalizeRoute(route);
+    return host;
+}
+
+
+static HttpRoute *addRoute(HttpHost *host, cchar *pattern, int flags)
+{
+    HttpRoute   *route;
+
+    route = httpCreateInheritedRoute(host->defaultRoute);
+    httpSetRoutePattern(route, pattern, flags);
+    httpFinalizeRoute(route);
+    return route;
+}
+
+
+static HttpRoute *routePath(HttpHost *host, cchar *path)
+{
+    HttpRx      *rx;
+
+    rx = stream->rx;
+    stream->host = host;
+    stream->error = 0;
+    stream->tx->handler = 0;
+    stream->tx->finalized = 0;
+    rx->route = 0;
+    rx->method = sclone("GET");
+    rx->pathInfo = sclone(path);
+    httpRouteRequest(stream);
+    return rx->route;
+}
+
+
+/*
+    Route with the trie and by scanning every route. Both must select the same route.
+ */
+static bool routeBoth(HttpHost *host, cchar *path, HttpRoute *expected)
+{
+    struct HttpRouteTrie    *trie;
+    HttpRoute               *scanned;
+
+    trie = host->routeTrie;
+    host->routeTrie = 0;
+    scanned = routePath(host, path);
+    host->routeTrie = trie;
+    return scanned == expected && routePath(host, path) == expected;
+}
+
+
+static void testOrder()
+{
+    HttpHost    *host;
+    HttpRoute   *list, *user, *admin, *json, *quantified, *not, *def;
+
+    host = createHost();
+    def = host->defaultRoute;
+    list = addRoute(host, "^/api/{controller}/list$", 0);
+    user = addRoute(host, "^/api/users/{id}$", 0);
+    admin = addRoute(host, "^/api/users/admin$", 0);
+    json = addRoute(host, "^/api/.*\\.json$", 0);
+    quantified = addRoute(host, "^/opt/*files/", 0);
+    not = addRoute(host, "^/private/", HTTP_ROUTE_NOT);
+    httpStartHost(host);
+    ttrue(host->routeTrie != 0);
+
+    ttrue(list->flags & HTTP_ROUTE_SIMPLE);
+    ttrue(user->flags & HTTP_ROUTE_SIMPLE);
+    ttrue(!(json->flags & HTTP_ROUTE_SIMPLE));
+
+    /* First match in host order wins across literal, token and regular expression routes */
+    ttrue(routeBoth(host, "/api/users/list", list));
+    ttrue(routeBoth(host, "/api/users/admin", user));
+    ttrue(routeBoth(host, "/api/users/admin.json", user));
+    ttrue(routeBoth(host, "/api/users/a/b.json", json));
+    ttrue(routeBoth(host, "/api/x.json", json));
+    ttrue(routeBoth(host, "/optfiles/a", quantified));
+    ttrue(routeBoth(host, "/opt//files/a", quantified));
+    ttrue(routeBoth(host, "/private/x", def));
+    ttrue(not->flags & HTTP_ROUTE_NOT);
+    ttrue(admin != 0);
+
+    /* Adding a route discards the trie until the host is started again */
+    addRoute(host, "^/late/", 0);
+    ttrue(host->routeTrie == 0);
+    httpCompileRoutes(host);
+    ttrue(host->routeTrie != 0);
+}
+
+
+static void testTokens()
+{
+    HttpHost    *host;
+    HttpRoute   *route;
+    HttpRx      *rx;
+
+    host = createHost();
+    route = addRoute(host, "^/tenant/{tenant}/orders/{id}", 0);
+    httpStartHost(host);
+    ttrue(route->flags & HTTP_ROUTE_SIMPLE);
+
+    rx = stream->rx;
+    ttrue(routePath(host, "/tenant/acme/orders/42/items") == route);
+    ttrue(rx->matchCount == 3);
+    ttrue(rx->matches[0] == 0 && rx->matches[1] == 22);
+    ttrue(rx->matches[2] == 8 && rx->matches[3] == 12);
+    ttrue(rx->matches[4] == 20 && rx->matches[5] == 22);
+
+    ttrue(routePath(host, "/tenant/acme/order/42") == host->defaultRoute);
+    ttrue(routePath(host, "/tenant//orders/") == route);
+    ttrue(rx->matches[2] == 8 && rx->matches[3] == 8);
+}
+
+
+/*
+    Unanchored header, param and condition patterns are studied when compiled. Compare matching with and
+    without the study data. Reports timing as a micro-benchmark.
+ */
+static void testStudy()
+{
+    HttpHost    *host;
+    HttpRoute   *route;
+    HttpRouteOp *op;
+    MprTicks    mark, plain;
+    cchar       *agents[3];
+    int         i, count, matched[ME_MAX_ROUTE_MATCHES * 2], hits;
+
+    host = createHost();
+    route = httpCreateInheritedRoute(host->defaultRoute);
+    httpSetRoutePattern(route, "^/browser/", 0);
+    httpAddRouteRequestHeaderCheck(route, "user-agent", "(Chrome|Firefox)/[0-9]+", 0);
+    httpFinalizeRoute(route);
+    httpStartHost(host);
+
+    op = mprGetFirstItem(route->requestHeaders);
+    ttrue(op && op->mdata && op->mextra);
+    ttrue(route->patternStudy == 0);
+
+    agents[0] = "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/118.0 Safari/537.36";
+    agents[1] = "Mozilla/5.0 (X11; Ubuntu; Linux x86_64; rv:109.0) Gecko/20100101 Firefox/119.0";
+    agents[2] = "Mozilla/5.0 (iPhone; CPU iPhone OS 17_0 like Mac OS X) AppleWebKit/605.1.15 Version/17.0 Mobile/15E148";
+
+    mprAddKey(stream->rx->headers, "user-agent", sclone(agents[0]));
+    ttrue(routePath(host, "/browser/index.html") == route);
+    mprAddKey(stream->rx->headers, "user-agent", sclone(agents[2]));
+    ttrue(routePath(host, "/browser/index.html") == host->defaultRoute);
+    mprRemoveKey(stream->rx->headers, "user-agent");
+
+    hits = 0;
+    mark = mprGetTicks();
+    for (i = 0; i < STUDY_MATCHES; i++) {
+        count = pcre_exec(op->mdata, NULL, agents[i % 3], (int) slen(agents[i % 3]), 0, 0, matched,
+            sizeof(matched) / sizeof(int));
+        hits += count > 0;
+    }
+    plain = mprGetTicks() - mark;
+
+    mark = mprGetTicks();
+    for (i = 0; i < STUDY_MATCHES; i++) {
+        count = pcre_exec(op->mdata, op->mextra, agents[i % 3], (int) slen(agents[i % 3]), 0, 0, matched,
+            sizeof(matched) / sizeof(int));
+        hits -= count > 0;
+    }
+    ttrue(hits == 0);
+    tinfo("Study: %d header matches, plain %lld msec, studied %lld msec", STUDY_MATCHES, (int64) plain,
+        (int64) (mprGetTicks() - mark));
+    httpRemoveHost(host);
+}
+
+
+/*
+    Route through synthetic tables of tenant routes with and without the trie. Reports timing as a micro-benchmark.
+ */
+static void testBenchmark()
+{
+    struct HttpRouteTrie    *trie;
+    HttpHost                *host;
+    MprTicks                mark, scan;
+    cchar                   *path;
+    int                     i, size, tenant, mismatched;
+
+    for (size = 10; size <= 10000; size *= 10) {
+        host = createHost();
+        for (i = 0; i < size; i++) {
+            if (i % 100 == 99) {
+                addRoute(host, sfmt("^/tenant-%d/files/.*\\.txt$", i), 0);
+            } else {
+                addRoute(host, sfmt("^/tenant-%d/api/{resource}/{id}$", i), 0);
+            }
+        }
+        httpStartHost(host);
+        trie = host->routeTrie;
+
+        mismatched = 0;
+        host->routeTrie = 0;
+        mark = mprGetTicks();
+        for (i = 0; i < ROUTE_LOOKUPS; i++) {
+            tenant = (i * 7919) % size;
+            path = sfmt("/tenant-%d/api/users/%d", tenant, i);
+            if (routePath(host, path) != mprGetItem(host->routes, tenant) && tenant % 100 != 99) {
+                mismatched++;
+            }
+        }
+        scan = mprGetTicks() - mark;
+
+        host->routeTrie = trie;
+        mark = mprGetTicks();
+        for (i = 0; i < ROUTE_LOOKUPS; i++) {
+            tenant = (i * 7919) % size;
+            path = sfmt("/tenant-%d/api/users/%d", tenant, i);
+            if (routePath(host, path) != mprGetItem(host->routes, tenant) && tenant % 100 != 99) {
+                mismatched++;
+            }
+        }
+        ttrue(mismatched == 0);
+        tinfo("Routes: %5d routes, %d lookups, scan %lld msec, trie %lld msec", size, ROUTE_LOOKUPS,
+            (int64) scan, (int64) (mprGetTicks() - mark));
+        httpRemoveHost(host);
+        mprYield(0);
+    }
+}
+
+
+int main(int argc, char **argv)
+{
+    HttpNet     *net;
+
+    mprCreate(argc, argv, 0);
+    httpCreate(HTTP_SERVER_SIDE | HTTP_CLIENT_SIDE);
+    net = httpCreateNet(mprCreateDispatcher("route", 0), NULL, 1, 0);
+    stream = httpCreateStream(net, 1);
+    mprAddRoot(stream);
+
+    testOrder();
+    testTokens();
+    testStudy();
+    testBenchmark();
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
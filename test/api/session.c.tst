@@ -0,0 +1,284 @@
+/**
+    session.c.tst - tests for encrypted session tokens
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+/*********************************** Locals ***********************************/
+
+#define SESSION_REQUESTS    20000
+#define SESSION_VARS        8
+
+static HttpStream   *stream;
+static HttpRoute    *cacheRoute;
+static HttpRoute    *tokenRoute;
+
+/************************************ Code ************************************/
+/*
+    Begin a new request on the stream that presents the given session cookie
+ */
+static void request(HttpRoute *route, cchar *cookie)
+{
+    HttpRx      *rx;
+    HttpTx      *tx;
+
+    rx = stream->rx;
+    tx = stream->tx;
+    rx->route = route;
+    rx->session = 0;
+    rx->sessionProbed = 0;
+    rx->cookie = cookie ? sfmt("%s=%s", HTTP_SESSION_COOKIE, cookie) : 0;
+    tx->cookies = mprCreateHash(HTTP_SMALL_HASH_SIZE, 0);
+    tx->flags &= ~HTTP_TX_HEADERS_CREATED;
+}
+
+
+/*
+    Complete the request and return the session cookie value set in the response
+ */
+static cchar *respond()
+{
+    cchar   *cookie;
+
+    httpWriteSession(stream);
+    if ((cookie = mprLookupKey(stream->tx->cookies, HTTP_SESSION_COOKIE)) == 0) {
+        return 0;
+    }
+    return stok(sclone(cookie), ";", NULL);
+}
+
+
+static void testToken()
+{
+    HttpSession *sp;
+    cchar       *token, *next;
+    int         before, after;
+
+    mprGetCacheStats(HTTP->sessionCache, &before, NULL);
+
+    request(tokenRoute, NULL);
+    httpSetSessionVar(stream, "user", "ralph");
+    httpSetSessionVar(stream, "role", "admin");
+    sp = httpGetSession(stream, 0);
+    ttrue(sp && sp->token && sp->cache == 0);
+    token = respond();
+    ttrue(token != 0);
+    ttrue(!schr(token, '=') && !schr(token, '+') && !schr(token, '/'));
+
+    /* The session is restored from the cookie alone */
+    request(tokenRoute, token);
+    ttrue(smatch(httpGetSessionVar(stream, "user", 0), "ralph"));
+    ttrue(smatch(httpGetSessionVar(stream, "role", 0), "admin"));
+    ttrue(smatch(httpGetSessionID(stream), sp->id));
+
+    /* Unchanged sessions are not rewritten */
+    ttrue(respond() == 0);
+
+    /* Changed sessions are rewritten with a fresh nonce */
+    request(tokenRoute, token);
+    httpRemoveSessionVar(stream, "role");
+    next = respond();
+    ttrue(next && !smatch(next, token));
+    request(tokenRoute, next);
+    ttrue(smatch(httpGetSessionVar(stream, "user", 0), "ralph"));
+    ttrue(httpGetSessionVar(stream, "role", 0) == 0);
+
+    /* Token sessions hold no server memory */
+    mprGetCacheStats(HTTP->sessionCache, &after, NULL);
+    ttrue(after == before);
+}
+
+
+static void testTamper()
+{
+    char    *token;
+    ssize   len;
+
+    request(tokenRoute, NULL);
+    httpSetSessionVar(stream, "user", "ralph");
+    token = (char*) respond();
+    len = slen(token);
+
+    /* Any modification of the token is rejected */
+    token[len / 2] = (token[len / 2] == 'A') ? 'B' : 'A';
+    request(tokenRoute, token);
+    ttrue(httpGetSession(stream, 0) == 0);
+
+    request(tokenRoute, "not-a-token");
+    ttrue(httpGetSession(stream, 0) == 0);
+
+    /* Oversized tokens are rejected before decoding */
+    request(tokenRoute, mprGetRandomString(stream->limits->sessionTokenSize + 1));
+    ttrue(httpGetSession(stream, 0) == 0);
+}
+
+
+static void testRotation()
+{
+    HttpSession *sp;
+    cchar       *token, *resealed;
+    int         i;
+
+    request(tokenRoute, NULL);
+    httpSetSessionVar(stream, "user", "ralph");
+    token = respond();
+
+    /* After rotation, older tokens are still accepted and are resealed with the current key */
+    ttrue(httpAddSessionKey("second session secret for rotation tests") == 0);
+    request(tokenRoute, token);
+    sp = httpGetSession(stream, 0);
+    ttrue(sp && sp->dirty);
+    resealed = respond();
+    ttrue(resealed != 0);
+    request(tokenRoute, resealed);
+    ttrue(smatch(httpGetSessionVar(stream, "user", 0), "ralph"));
+
+    /* Once the key is retired, its tokens are rejected */
+    for (i = 0; i < ME_MAX_SESSION_KEYS; i++) {
+        httpAddSessionKey(sfmt("retire session secret %d", i));
+    }
+    request(tokenRoute, token);
+    ttrue(httpGetSession(stream, 0) == 0);
+    request(tokenRoute, resealed);
+    ttrue(httpGetSession(stream, 0) == 0);
+}
+
+
+static void testLimit()
+{
+    request(tokenRoute, NULL);
+    httpSetSessionVar(stream, "data", mprGetRandomString(stream->limits->sessionTokenSize));
+    ttrue(httpWriteSession(stream) == MPR_ERR_WONT_FIT);
+    ttrue(mprLookupKey(stream->tx->cookies, HTTP_SESSION_COOKIE) == 0);
+}
+
+
+static void setVars()
+{
+    int     i;
+
+    for (i = 0; i < SESSION_VARS; i++) {
+        httpSetSessionVar(stream, sfmt("var-%d", i), sfmt("value of session variable %d", i));
+    }
+}
+
+
+/*
+    Compare reading and updating a session in the server session cache with an encrypted session token.
+    Reports timing as a micro-benchmark.
+ */
+static void testBenchmark()
+{
+    MprTicks    mark, cached;
+    cchar       *token, *id;
+    int         i, failed;
+
+    failed = 0;
+    request(cacheRoute, NULL);
+    setVars();
+    id = httpGetSessionID(stream);
+    mprAddRoot(id);
+    respond();
+    mark = mprGetTicks();
+    for (i = 0; i < SESSION_REQUESTS; i++) {
+        request(cacheRoute, id);
+        failed += httpGetSessionVar(stream, "var-0", 0) == 0;
+        httpSetSessionVar(stream, "count", itos(i));
+        respond();
+        mprYield(0);
+    }
+    cached = mprGetTicks() - mark;
+    httpDestroySession(stream);
+    mprRemoveRoot(id);
+
+    request(tokenRoute, NULL);
+    setVars();
+    token = respond();
+    mark = mprGetTicks();
+    for (i = 0; i < SESSION_REQUESTS; i++) {
+        request(tokenRoute, token);
+        failed += httpGetSessionVar(stream, "var-0", 0) == 0;
+        httpSetSessionVar(stream, "count", itos(i));
+        mprRemoveRoot(token);
+        token = respond();
+        mprAddRoot(token);
+        mprYield(0);
+    }
+    ttrue(failed == 0);
+    tinfo("Sessions: %d requests, cache %lld msec, token %lld msec, %d byte token", SESSION_REQUESTS,
+        (int64) cached, (int64) (mprGetTicks() - mark), (int) slen(token));
+    mprRemoveRoot(token);
+}
+
+
+static bool sealSupported()
+{
+    uchar   key[MPR_AEAD_KEY], nonce[MPR_AEAD_NONCE], tag[MPR_AEAD_TAG], out[4];
+
+    memset(key, 0, sizeof(key));
+    memset(nonce, 0, sizeof(nonce));
+    return mprSealData(key, nonce, NULL, 0, (cuchar*) "test", 4, out, tag) == 0;
+}
+
+
+int main(int argc, char **argv)
+{
+    HttpNet     *net;
+    HttpHost    *host;
+
+    mprCreate(argc, argv, 0);
+    httpCreate(HTTP_SERVER_SIDE | HTTP_CLIENT_SIDE);
+
+    host = httpCreateHost();
+    cacheRoute = httpCreateConfiguredRoute(host, 1);
+    httpSetHostDefaultRoute(host, cacheRoute);
+    tokenRoute = httpCreateInheritedRoute(cacheRoute);
+    mprAddRoot(cacheRoute);
+    mprAddRoot(tokenRoute);
+    ttrue(httpSetRouteSessionStore(tokenRoute, "token") == 0);
+    ttrue(httpSetRouteSessionStore(tokenRoute, "unknown") < 0);
+    ttrue(httpAddSessionKey("first session secret for token tests") == 0);
+
+    net = httpCreateNet(mprCreateDispatcher("session", 0), NULL, 1, 0);
+    net->address = mprAllocStruct(HttpAddress);
+    stream = httpCreateStream(net, 1);
+    stream->host = host;
+    mprAddRoot(stream);
+
+    if (sealSupported()) {
+        testToken();
+        testTamper();
+        testRotation();
+        testLimit();
+        testBenchmark();
+    } else {
+        tskip("Authenticated encryption is not supported by the SSL provider");
+    }
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -0,0 +1,236 @@
+/**
+    tls.c.tst - tests for coalesced vectored writes over TLS
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+/*********************************** Locals ***********************************/
+
+#define TLS_PORT        4197
+#define TLS_FRAGMENTS   2000                /* Small packets written before the body */
+#define BODY_SIZE       (4 * 1024 * 1024 + 1234)
+#define SMALL_SNDBUF    4096                /* Send buffer that forces partial writes of each TLS record */
+
+static MprDispatcher *dispatcher;
+static HttpEndpoint *endpoint;
+static MprSsl       *clientSsl;
+static char         *expected;
+static ssize        expectedLength;
+static char         *body;
+
+/************************************ Code ************************************/
+
+static ssize fragmentLength(int i)
+{
+    return 1 + (i * 7) % 61;
+}
+
+
+/*
+    Build the response the handler writes: many small fragments with a known pattern followed by a large body
+ */
+static void createExpected()
+{
+    char    *cp;
+    ssize   len;
+    int     i;
+
+    body = mprAlloc(BODY_SIZE);
+    mprAddRoot(body);
+    mprGetRandomBytes(body, BODY_SIZE, 0);
+
+    for (len = BODY_SIZE, i = 0; i < TLS_FRAGMENTS; i++) {
+        len += fragmentLength(i);
+    }
+    expected = mprAlloc(len);
+    mprAddRoot(expected);
+    for (cp = expected, i = 0; i < TLS_FRAGMENTS; i++) {
+        memset(cp, 'a' + (i % 26), fragmentLength(i));
+        cp += fragmentLength(i);
+    }
+    memcpy(cp, body, BODY_SIZE);
+    expectedLength = len;
+}
+
+
+/*
+    Server handler. Each fragment is a separate packet so the net connector writes a long vector of small
+    fragments. The response is chunked which adds a small chunk header fragment before each packet.
+ */
+static void readyTls(HttpQueue *q)
+{
+    HttpStream  *stream;
+    HttpPacket  *packet;
+    ssize       len;
+    int         i;
+
+    stream = q->stream;
+#if ME_UNIX_LIKE
+    if (smatch(stream->rx->pathInfo, "/small")) {
+        int size = SMALL_SNDBUF;
+        setsockopt(stream->net->sock->fd, SOL_SOCKET, SO_SNDBUF, (char*) &size, sizeof(size));
+    }
+#endif
+    httpSetStatus(stream, HTTP_CODE_OK);
+    httpSetContentType(stream, "application/octet-stream");
+    for (i = 0; i < TLS_FRAGMENTS; i++) {
+        len = fragmentLength(i);
+        packet = httpCreateDataPacket(len);
+        memset(mprGetBufEnd(packet->content), 'a' + (i % 26), len);
+        mprAdjustBufEnd(packet->content, len);
+        httpPutPacketToNext(stream->writeq, packet);
+    }
+    httpWriteBlock(stream->writeq, body, BODY_SIZE, HTTP_BUFFER);
+    httpFinalize(stream);
+}
+
+
+static bool startServer()
+{
+    HttpStage   *stage;
+    HttpHost    *host;
+    HttpRoute   *route;
+    MprSsl      *ssl;
+    cchar       *certs;
+
+    if (tget("TM_DEBUG", 0)) {
+        httpStartTracing("stdout:4");
+    }
+    certs = mprGetPathDir(mprGetPathDir(mprGetCurrentPath()));
+    certs = mprJoinPath(certs, "src/certs/samples");
+    if (!mprPathExists(mprJoinPath(certs, "test.crt"), R_OK)) {
+        tskip("Cannot find the sample certificates in %s", certs);
+        return 0;
+    }
+    stage = httpCreateHandler("tlsHandler", NULL);
+    stage->ready = readyTls;
+
+    ssl = mprCreateSsl(1);
+    mprSetSslCertFile(ssl, mprJoinPath(certs, "test.crt"));
+    mprSetSslKeyFile(ssl, mprJoinPath(certs, "test.key"));
+
+    /* The endpoint selects the SSL configuration of the matching host's default route */
+    host = httpGetDefaultHost();
+    route = httpGetHostDefaultRoute(host);
+    route->ssl = ssl;
+    httpSetRouteDocuments(route, ".");
+    httpSetRouteHome(route, ".");
+    httpSetRouteHandler(route, "tlsHandler");
+    httpFinalizeRoute(route);
+
+    if ((endpoint = httpCreateEndpoint("127.0.0.1", TLS_PORT, NULL)) == 0) {
+        return 0;
+    }
+    httpAddHostToEndpoint(endpoint, host);
+    if (httpSecureEndpoint(endpoint, ssl) < 0) {
+        tskip("SSL is not supported");
+        return 0;
+    }
+    if (httpStartEndpoint(endpoint) < 0) {
+        tskip("Cannot listen on port %d", TLS_PORT);
+        return 0;
+    }
+    /* The sample certificates are not issued by a trusted root, so the client does not verify the server */
+    mprVerifySslPeer(NULL, 0);
+    clientSsl = mprCreateSsl(0);
+    mprAddRoot(clientSsl);
+    return 1;
+}
+
+
+/*
+    Fetch the response over HTTPS. A slow reader lets the server send buffer fill so TLS writes are incomplete
+    and must be retried.
+ */
+static void fetch(cchar *uri, bool slow)
+{
+    HttpNet     *net;
+    HttpStream  *stream;
+    MprBuf      *buf;
+    char        data[ME_BUFSIZE * 4];
+    ssize       nbytes, reads;
+
+    net = httpCreateNet(dispatcher, NULL, 1, 0);
+    stream = httpCreateStream(net, 0);
+    ttrue(httpConnect(stream, "GET", sfmt("https://127.0.0.1:%d%s", TLS_PORT, uri), clientSsl) == 0);
+    httpFinalizeOutput(stream);
+
+    buf = mprCreateBuf(expectedLength + 1, 0);
+    mprAddRoot(buf);
+    for (reads = 0; (nbytes = httpRead(stream, data, sizeof(data))) > 0; reads++) {
+        mprPutBlockToBuf(buf, data, nbytes);
+        if (slow && (reads % 16) == 0) {
+            mprSleep(1);
+        }
+    }
+    ttrue(httpGetStatus(stream) == HTTP_CODE_OK);
+    ttrue(mprGetBufLength(buf) == expectedLength);
+    ttrue(mprGetBufLength(buf) == expectedLength && memcmp(mprGetBufStart(buf), expected, expectedLength) == 0);
+    mprRemoveRoot(buf);
+    httpDestroyNet(net);
+}
+
+
+/*
+    Many small packets and a large body must arrive intact and in order
+ */
+static void testCoalesce()
+{
+    fetch("/coalesce", 0);
+}
+
+
+/*
+    With a small send buffer, records are partially written and retried after WANT_WRITE
+ */
+static void testPartialWrites()
+{
+    fetch("/small", 1);
+}
+
+
+int main(int argc, char **argv)
+{
+    mprCreate(argc, argv, 0);
+    httpCreate(HTTP_CLIENT_SIDE | HTTP_SERVER_SIDE);
+    mprAddStandardSignals();
+    mprStartWorkerService();
+
+    createExpected();
+    dispatcher = mprCreateDispatcher("client", 0);
+    mprAddRoot(dispatcher);
+    mprStartDispatcher(dispatcher);
+
+    if (startServer()) {
+        testCoalesce();
+        testPartialWrites();
+        httpStopEndpoint(endpoint);
+    }
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
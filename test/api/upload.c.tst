@@ -0,0 +1,245 @@
+/**
+    upload.c.tst - tests for spooling uploaded files to disk
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+#if LINUX
+    #include    <sys/resource.h>
+#endif
+
+/*********************************** Locals ***********************************/
+
+#define UPLOAD_PORT     4198
+#define UPLOAD_SIZE     (4 * ME_MAX_UPLOAD_SPOOL + 12345)
+#define UPLOAD_LIMIT    (ME_MAX_UPLOAD_SPOOL * 2)
+
+static HttpEndpoint *endpoint;
+static cchar        *uploadDir;
+static cchar        *sourcePath;
+static char         *source;
+static volatile int uploads;
+
+/************************************ Code ************************************/
+/*
+    Server action. Runs once the uploaded data is on disk and compares the file with what was sent.
+ */
+static void uploadAction(HttpStream *stream)
+{
+    HttpUploadFile  *file;
+    char            *data;
+    ssize           len;
+    bool            intact;
+
+    mprAtomicAdd((int*) &uploads, 1);
+    intact = 0;
+    if (mprGetListLength(stream->rx->files) == 1) {
+        file = mprGetFirstItem(stream->rx->files);
+        data = mprReadPathContents(file->filename, &len);
+        intact = data && len == UPLOAD_SIZE && file->size == UPLOAD_SIZE && memcmp(data, source, len) == 0;
+    }
+    httpSetStatus(stream, HTTP_CODE_OK);
+    httpWrite(stream->writeq, "%s", intact ? "intact" : "corrupt");
+    httpFinalize(stream);
+}
+
+
+static bool startServer()
+{
+    HttpRoute   *parent, *route;
+
+    if (tget("TM_DEBUG", 0)) {
+        httpStartTracing("stdout:4");
+    }
+    endpoint = httpCreateConfiguredEndpoint(NULL, ".", ".", "127.0.0.1", UPLOAD_PORT);
+    ttrue(endpoint != 0);
+    parent = httpGetHostDefaultRoute(httpGetDefaultHost());
+    httpSetRouteUploadDir(parent, uploadDir);
+
+    route = httpCreateInheritedRoute(parent);
+    httpSetRoutePattern(route, "^/upload", 0);
+    httpSetRouteHandler(route, "actionHandler");
+    httpFinalizeRoute(route);
+    httpDefineAction("/upload", uploadAction);
+
+    if (httpStartEndpoint(endpoint) < 0) {
+        tskip("Cannot listen on port %d", UPLOAD_PORT);
+        return 0;
+    }
+    return 1;
+}
+
+
+/*
+    Upload the source file and return the response status. The client owns its dispatcher so network events only
+    run while it waits and do not race with the blocking writes of the upload data.
+ */
+static int upload(cchar **response)
+{
+    MprDispatcher   *dispatcher;
+    HttpNet         *net;
+    HttpStream      *stream;
+    MprList         *files;
+    int             status;
+
+    dispatcher = mprCreateDispatcher("upload", 0);
+    mprStartDispatcher(dispatcher);
+    net = httpCreateNet(dispatcher, NULL, 0, 0);
+    stream = httpCreateStream(net, 0);
+    mprAddRoot(stream);
+    files = mprCreateList(0, 0);
+    mprAddItem(files, sourcePath);
+    mprAddRoot(files);
+
+    httpEnableUpload(stream);
+    ttrue(httpConnect(stream, "POST", sfmt("http://127.0.0.1:%d/upload", UPLOAD_PORT), NULL) >= 0);
+    if (httpWriteUploadData(stream, files, NULL) >= 0) {
+        httpFinalizeOutput(stream);
+    }
+    httpWait(stream, HTTP_STATE_COMPLETE, 30 * 1000);
+    status = httpGetStatus(stream);
+    *response = httpReadString(stream);
+    httpDestroyNet(net);
+    mprStopDispatcher(dispatcher);
+    mprRemoveRoot(files);
+    mprRemoveRoot(stream);
+    return status;
+}
+
+
+/*
+    Uploaded files are removed when the request completes. The server may see the client close after the response.
+ */
+static bool uploadsRemoved()
+{
+    MprList     *files;
+    MprTicks    mark;
+
+    for (mark = mprGetTicks(); mprGetElapsedTicks(mark) < 5000; mprSleep(10)) {
+        if ((files = mprGetPathFiles(uploadDir, 0)) == 0 || mprGetListLength(files) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/*
+    A body spanning many packets and several spool buffers is written by worker threads. The handler must see
+    the complete file byte for byte.
+ */
+static void testSpool()
+{
+    cchar       *response;
+    MprTicks    mark;
+
+    mark = mprGetTicks();
+    ttrue(upload(&response) == HTTP_CODE_OK);
+    ttrue(smatch(response, "intact"));
+    ttrue(uploads == 1);
+    tinfo("Upload: %d bytes in %lld msec", UPLOAD_SIZE, (int64) mprGetElapsedTicks(mark));
+    ttrue(uploadsRemoved());
+}
+
+
+/*
+    A failed write to the upload file must fail the request without running the handler. The rest of the body is
+    not read, so the connection is aborted rather than left waiting for the request to time out.
+ */
+static void testSpoolError()
+{
+#if LINUX
+    struct rlimit   saved, limit;
+    cchar           *response;
+    MprTicks        mark;
+    int             status;
+
+    /*
+        Cap the file size so the spooled writes fail part way through the body
+     */
+    getrlimit(RLIMIT_FSIZE, &saved);
+    limit = saved;
+    limit.rlim_cur = UPLOAD_LIMIT;
+    if (setrlimit(RLIMIT_FSIZE, &limit) < 0) {
+        tskip("Cannot limit file size");
+        return;
+    }
+    uploads = 0;
+    mark = mprGetTicks();
+    status = upload(&response);
+    setrlimit(RLIMIT_FSIZE, &saved);
+
+    ttrue(status != HTTP_CODE_OK);
+    ttrue(!smatch(response, "intact"));
+    ttrue(mprGetElapsedTicks(mark) < 10000);
+    ttrue(uploads == 0);
+    ttrue(uploadsRemoved());
+
+    /* The server continues to accept uploads */
+    ttrue(upload(&response) == HTTP_CODE_OK);
+    ttrue(smatch(response, "intact"));
+    ttrue(uploadsRemoved());
+#endif
+}
+
+
+int main(int argc, char **argv)
+{
+    MprFile     *file;
+
+    mprCreate(argc, argv, 0);
+    httpCreate(HTTP_CLIENT_SIDE | HTTP_SERVER_SIDE);
+    mprAddStandardSignals();
+    mprStartWorkerService();
+
+    uploadDir = mprGetAbsPath("upload.tmp");
+    sourcePath = mprGetAbsPath("upload.dat");
+    source = mprAlloc(UPLOAD_SIZE);
+    mprAddRoot(uploadDir);
+    mprAddRoot(sourcePath);
+    mprAddRoot(source);
+    mprMakeDir(uploadDir, 0755, -1, -1, 1);
+    mprGetRandomBytes(source, UPLOAD_SIZE, 0);
+
+    if ((file = mprOpenFile(sourcePath, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0644)) == 0 ||
+            mprWriteFile(file, source, UPLOAD_SIZE) != UPLOAD_SIZE) {
+        tskip("Cannot create %s", sourcePath);
+        return 0;
+    }
+    mprCloseFile(file);
+
+    if (startServer()) {
+        testSpool();
+        testSpoolError();
+        httpStopEndpoint(endpoint);
+    }
+    mprDeletePath(sourcePath);
+    mprDeletePath(uploadDir);
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
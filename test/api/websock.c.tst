@@ -0,0 +1,400 @@
+/**
+    websock.c.tst - tests for WebSocket frame masking, compression and broadcast
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+/*********************************** Locals ***********************************/
+
+#define MASK_SIZE       4096
+#define MASK_BENCH      (1024 * 1024)
+#define MASK_ROUNDS     256
+
+#define WS_PORT         4199
+#define WS_MESSAGES     3
+#define WS_LARGE        (200 * 1024)
+#define WS_SUBSCRIBERS  10
+#define WS_BROADCASTS   50
+
+static cuchar mask[4] = { 0x12, 0x34, 0xab, 0xcd };
+
+static HttpEndpoint     *endpoint;
+static HttpBroadcast    *group;
+static MprList          *sent;
+static MprList          *received;
+static MprBuf           *message;
+static volatile int     delivered;
+
+/************************************ Code ************************************/
+
+static int maskBytes(char *data, ssize len, cuchar *mask, int offset)
+{
+    ssize   i;
+
+    for (i = 0; i < len; i++) {
+        data[i] ^= mask[offset++ & 0x3];
+    }
+    return offset & 0x3;
+}
+
+
+/*
+    Compare with the byte at a time path for every alignment, length and starting mask offset
+ */
+static void testMask()
+{
+    char    *buf, *expect, *src;
+    ssize   len;
+    int     align, offset, failed;
+
+    src = mprAlloc(MASK_SIZE);
+    buf = mprAlloc(MASK_SIZE + 64);
+    expect = mprAlloc(MASK_SIZE + 64);
+    mprGetRandomBytes(src, MASK_SIZE, 0);
+
+    failed = 0;
+    for (align = 0; align < 32 && !failed; align++) {
+        for (len = 0; len < 300 && !failed; len++) {
+            for (offset = 0; offset < 4; offset++) {
+                memcpy(&buf[align], src, len);
+                memcpy(&expect[align], src, len);
+                if (httpMaskWebSocketData(&buf[align], len, mask, offset) !=
+                        maskBytes(&expect[align], len, mask, offset) || memcmp(&buf[align], &expect[align], len) != 0) {
+                    failed++;
+                    break;
+                }
+            }
+        }
+    }
+    ttrue(!failed);
+
+    /* Masking twice restores the data */
+    memcpy(buf, src, MASK_SIZE);
+    httpMaskWebSocketData(buf, MASK_SIZE, mask, 1);
+    httpMaskWebSocketData(buf, MASK_SIZE, mask, 1);
+    ttrue(memcmp(buf, src, MASK_SIZE) == 0);
+}
+
+
+/*
+    A frame arriving in packets of odd sizes must unmask the same as the whole frame
+ */
+static void testRolling()
+{
+    char    *buf, *expect;
+    ssize   pos, len;
+    int     offset, i;
+
+    buf = mprAlloc(MASK_SIZE);
+    expect = mprAlloc(MASK_SIZE);
+    mprGetRandomBytes(buf, MASK_SIZE, 0);
+    memcpy(expect, buf, MASK_SIZE);
+    maskBytes(expect, MASK_SIZE, mask, 0);
+
+    for (pos = 0, offset = 0, i = 0; pos < MASK_SIZE; pos += len, i++) {
+        len = min((i * 7) % 131 + 1, MASK_SIZE - pos);
+        offset = httpMaskWebSocketData(&buf[pos], len, mask, offset);
+    }
+    ttrue(memcmp(buf, expect, MASK_SIZE) == 0);
+}
+
+
+/*
+    Micro-benchmark of masking throughput versus the byte at a time path
+ */
+static void testBenchmark()
+{
+    MprTicks    mark, bytes, words;
+    char        *buf;
+    int         i;
+
+    buf = mprAlloc(MASK_BENCH);
+    mprAddRoot(buf);
+    memset(buf, 0, MASK_BENCH);
+
+    mark = mprGetTicks();
+    for (i = 0; i < MASK_ROUNDS; i++) {
+        maskBytes(&buf[1], MASK_BENCH - 1, mask, i);
+    }
+    bytes = max(mprGetTicks() - mark, 1);
+
+    mark = mprGetTicks();
+    for (i = 0; i < MASK_ROUNDS; i++) {
+        httpMaskWebSocketData(&buf[1], MASK_BENCH - 1, mask, i);
+    }
+    words = max(mprGetTicks() - mark, 1);
+    mprRemoveRoot(buf);
+
+    tinfo("Mask: bytes %lld MB/sec, words %lld MB/sec", (int64) (MASK_ROUNDS * 1000 / bytes),
+        (int64) (MASK_ROUNDS * 1000 / words));
+}
+
+
+/*
+    Server action that echoes each message back to the client
+ */
+static void echoEvent(HttpStream *stream, int event, int arg)
+{
+    HttpPacket  *packet;
+
+    if (event == HTTP_EVENT_READABLE) {
+        while ((packet = httpGetPacket(stream->readq)) != 0) {
+            if (packet->type == WS_MSG_TEXT || packet->type == WS_MSG_BINARY || packet->type == WS_MSG_CONT) {
+                httpSendBlock(stream, packet->type, mprGetBufStart(packet->content), httpGetPacketLength(packet),
+                    packet->last ? HTTP_BUFFER : HTTP_BUFFER | HTTP_MORE);
+            }
+        }
+    }
+}
+
+
+static void echoAction(HttpStream *stream)
+{
+    httpSetStreamNotifier(stream, echoEvent);
+}
+
+
+static void subscribeAction(HttpStream *stream)
+{
+    httpJoinBroadcast(group, stream);
+}
+
+
+/*
+    Start a server with an echo route using permessage-deflate and a broadcast subscription route
+ */
+static bool startServer()
+{
+    HttpRoute   *parent, *route;
+
+    if (tget("TM_DEBUG", 0)) {
+        httpStartTracing("stdout:4");
+    }
+    endpoint = httpCreateConfiguredEndpoint(NULL, ".", ".", "127.0.0.1", WS_PORT);
+    ttrue(endpoint != 0);
+    parent = httpGetHostDefaultRoute(httpGetDefaultHost());
+
+    route = httpCreateInheritedRoute(parent);
+    httpSetRoutePattern(route, "^/echo", 0);
+    httpSetRouteHandler(route, "actionHandler");
+    httpAddRouteFilter(route, "webSocketFilter", "", HTTP_STAGE_RX | HTTP_STAGE_TX);
+    httpSetRouteWebSocketsDeflate(route, 1);
+    httpFinalizeRoute(route);
+    httpDefineAction("/echo", echoAction);
+
+    route = httpCreateInheritedRoute(parent);
+    httpSetRoutePattern(route, "^/subscribe", 0);
+    httpSetRouteHandler(route, "actionHandler");
+    httpAddRouteFilter(route, "webSocketFilter", "", HTTP_STAGE_RX | HTTP_STAGE_TX);
+    httpFinalizeRoute(route);
+    httpDefineAction("/subscribe", subscribeAction);
+
+    group = httpCreateBroadcast(HTTP_BROADCAST_DROP, 0);
+    mprAddRoot(group);
+
+    if (httpStartEndpoint(endpoint) < 0) {
+        tskip("Cannot listen on port %d", WS_PORT);
+        return 0;
+    }
+    return 1;
+}
+
+
+static void clientEvent(HttpStream *stream, int event, int arg)
+{
+    HttpPacket  *packet;
+
+    if (event == HTTP_EVENT_READABLE) {
+        while ((packet = httpGetPacket(stream->readq)) != 0) {
+            if (packet->type == WS_MSG_TEXT || packet->type == WS_MSG_BINARY || packet->type == WS_MSG_CONT) {
+                mprPutBlockToBuf(message, mprGetBufStart(packet->content), httpGetPacketLength(packet));
+                if (packet->last) {
+                    mprAddNullToBuf(message);
+                    mprAddItem(received, mprCloneBufAsString(message));
+                    mprFlushBuf(message);
+                }
+            }
+        }
+    }
+}
+
+
+static void subscriberEvent(HttpStream *stream, int event, int arg)
+{
+    HttpPacket  *packet;
+
+    if (event == HTTP_EVENT_READABLE) {
+        while ((packet = httpGetPacket(stream->readq)) != 0) {
+            if (packet->type == WS_MSG_TEXT && packet->last && smatch(httpGetPacketString(packet), "market update")) {
+                mprAtomicAdd((int*) &delivered, 1);
+            }
+        }
+    }
+}
+
+
+static void sendMessages(HttpStream *stream, MprEvent *event)
+{
+    char    *msg;
+    int     next;
+
+    for (ITERATE_ITEMS(sent, msg, next)) {
+        httpSendBlock(stream, WS_MSG_TEXT, msg, slen(msg), HTTP_BUFFER);
+    }
+}
+
+
+/*
+    Round trip messages through a server route with permessage-deflate. Small messages are sent uncompressed,
+    large messages span several compressed frames.
+ */
+#if ME_HTTP_COMPRESS
+static void testDeflate()
+{
+    HttpNet         *net;
+    HttpStream      *stream;
+    MprBuf          *buf;
+    MprTicks        mark;
+    cchar           *extensions;
+    int             i;
+
+    sent = mprCreateList(0, 0);
+    received = mprCreateList(0, 0);
+    message = mprCreateBuf(0, 0);
+    mprAddRoot(sent);
+    mprAddRoot(received);
+    mprAddRoot(message);
+
+    mprAddItem(sent, sclone("hello"));
+    buf = mprCreateBuf(0, 0);
+    for (i = 0; mprGetBufLength(buf) < WS_LARGE; i++) {
+        mprPutToBuf(buf, "line %d of a compressible WebSocket message\n", i % 100);
+    }
+    mprAddNullToBuf(buf);
+    mprAddItem(sent, mprCloneBufAsString(buf));
+    mprAddItem(sent, sclone("the quick brown fox jumps over the lazy dog, the quick brown fox jumps over the lazy dog"));
+
+    net = httpCreateNet(NULL, NULL, 0, 0);
+    stream = httpCreateStream(net, 0);
+    httpSetWebSocketDeflate(stream, 1);
+    httpSetStreamNotifier(stream, clientEvent);
+    ttrue(httpConnect(stream, "GET", sfmt("ws://127.0.0.1:%d/echo", WS_PORT), NULL) >= 0);
+    httpWait(stream, HTTP_STATE_CONTENT, 10 * 1000);
+    ttrue(httpGetStatus(stream) == HTTP_CODE_SWITCHING);
+
+    extensions = httpGetHeader(stream, "sec-websocket-extensions");
+    ttrue(sstarts(extensions, "permessage-deflate"));
+    ttrue(stream->rx->webSocket->deflate != 0);
+
+    mprCreateEvent(stream->dispatcher, "send", 0, sendMessages, stream, 0);
+    for (mark = mprGetTicks(); mprGetListLength(received) < WS_MESSAGES && mprGetElapsedTicks(mark) < 10 * 1000; ) {
+        httpWait(stream, 0, 100);
+    }
+    ttrue(mprGetListLength(received) == WS_MESSAGES);
+    for (i = 0; i < WS_MESSAGES; i++) {
+        ttrue(smatch(mprGetItem(received, i), mprGetItem(sent, i)));
+    }
+    httpSendClose(stream, WS_STATUS_OK, "done");
+    httpWait(stream, HTTP_STATE_COMPLETE, 5 * 1000);
+    mprRemoveRoot(sent);
+    mprRemoveRoot(received);
+    mprRemoveRoot(message);
+}
+#endif
+
+
+/*
+    Broadcast to a set of subscribers. Every subscriber must receive every message.
+ */
+static void testBroadcast()
+{
+    HttpStream      *streams[WS_SUBSCRIBERS];
+    MprTicks        mark;
+    int             i, count;
+
+    for (i = 0; i < WS_SUBSCRIBERS; i++) {
+        streams[i] = httpCreateStream(httpCreateNet(NULL, NULL, 0, 0), 0);
+        mprAddRoot(streams[i]);
+        httpSetStreamNotifier(streams[i], subscriberEvent);
+        ttrue(httpConnect(streams[i], "GET", sfmt("ws://127.0.0.1:%d/subscribe", WS_PORT), NULL) >= 0);
+        httpWait(streams[i], HTTP_STATE_CONTENT, 10 * 1000);
+        ttrue(httpGetStatus(streams[i]) == HTTP_CODE_SWITCHING);
+    }
+    for (mark = mprGetTicks(); mprGetListLength(group->subscribers) < WS_SUBSCRIBERS &&
+            mprGetElapsedTicks(mark) < 10 * 1000; ) {
+        mprSleep(5);
+    }
+    ttrue(mprGetListLength(group->subscribers) == WS_SUBSCRIBERS);
+
+    mark = mprGetTicks();
+    for (i = 0, count = 0; i < WS_BROADCASTS; i++) {
+        count += httpBroadcast(group, WS_MSG_TEXT, "market update", -1);
+    }
+    ttrue(count == WS_SUBSCRIBERS * WS_BROADCASTS);
+    while (delivered < WS_SUBSCRIBERS * WS_BROADCASTS && mprGetElapsedTicks(mark) < 10 * 1000) {
+        for (i = 0; i < WS_SUBSCRIBERS; i++) {
+            httpWait(streams[i], 0, 1);
+        }
+    }
+    ttrue(delivered == WS_SUBSCRIBERS * WS_BROADCASTS);
+    ttrue(group->dropped == 0);
+    tinfo("Broadcast: %d messages to %d subscribers in %lld msec", WS_BROADCASTS, WS_SUBSCRIBERS,
+        (int64) mprGetElapsedTicks(mark));
+
+    /* Closed streams leave the group */
+    for (i = 0; i < WS_SUBSCRIBERS; i++) {
+        httpSendClose(streams[i], WS_STATUS_OK, "done");
+        httpWait(streams[i], HTTP_STATE_COMPLETE, 5 * 1000);
+        mprRemoveRoot(streams[i]);
+    }
+    for (mark = mprGetTicks(); mprGetListLength(group->subscribers) > 0 && mprGetElapsedTicks(mark) < 5 * 1000; ) {
+        mprSleep(5);
+    }
+    ttrue(mprGetListLength(group->subscribers) == 0);
+}
+
+
+int main(int argc, char **argv)
+{
+    mprCreate(argc, argv, 0);
+#if ME_HTTP_WEB_SOCKETS
+    httpCreate(HTTP_CLIENT_SIDE | HTTP_SERVER_SIDE);
+    testMask();
+    testRolling();
+    testBenchmark();
+    if (startServer()) {
+#if ME_HTTP_COMPRESS
+        testDeflate();
+#endif
+        testBroadcast();
+        httpStopEndpoint(endpoint);
+    }
+#endif
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -0,0 +1,245 @@
+/**
+    wheel.c.tst - tests for the network and stream timeout timer wheel
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "testme.h"
+#include    "http.h"
+
+/*********************************** Locals ***********************************/
+
+static HttpTimerWheel   *wheel;
+static MprTicks         granularity;
+
+/************************************ Code ************************************/
+/*
+    Create a network that times out after the given number of ticks of inactivity from the current tick
+ */
+static HttpNet *createNet(int ticks)
+{
+    HttpNet     *net;
+
+    net = httpCreateNet(mprCreateDispatcher("wheel", 0), NULL, 1, 0);
+    net->limits = httpCreateLimits(0);
+    net->limits->inactivityTimeout = ticks * granularity;
+    net->lastActivity = HTTP->now = wheel->start + (MprTicks) wheel->tick * granularity;
+    httpScheduleNetTimeout(net);
+    mprAddRoot(net);
+    return net;
+}
+
+
+static void destroyNet(HttpNet *net)
+{
+    httpDestroyNet(net);
+    mprRemoveRoot(net);
+}
+
+
+/*
+    Move the clock forward by the given number of ticks and expire the due timeouts
+ */
+static void advance(int ticks)
+{
+    HTTP->now = wheel->start + (MprTicks) (wheel->tick + ticks) * granularity;
+    httpExpireTimeouts();
+}
+
+
+/*
+    Return the wheel level holding an entry or -1 if not scheduled
+ */
+static int findLevel(HttpWheelEntry *entry)
+{
+    HttpWheelEntry  *head, *ep;
+    int             level, slot;
+
+    for (level = 0; level < HTTP_WHEEL_LEVELS; level++) {
+        for (slot = 0; slot < HTTP_WHEEL_SLOTS; slot++) {
+            head = &wheel->slots[level][slot];
+            for (ep = head->next; ep != head; ep = ep->next) {
+                if (ep == entry) {
+                    return level;
+                }
+            }
+        }
+    }
+    return -1;
+}
+
+
+static void testExpiry()
+{
+    HttpNet     *net;
+    uint64      start;
+
+    net = createNet(10);
+    start = wheel->tick;
+
+    /* Entries expire once past the deadline, so on the tick after it */
+    ttrue(net->wheelEntry.tick == start + 11);
+    ttrue(findLevel(&net->wheelEntry) == 0);
+    advance(10);
+    ttrue(net->timeoutEvent == 0);
+    advance(1);
+    ttrue(net->timeoutEvent != 0);
+    ttrue(net->timeout == HTTP_INACTIVITY_TIMEOUT);
+
+    /* Timed out entries remain scheduled until the network is destroyed */
+    ttrue(net->wheelEntry.next != 0);
+    destroyNet(net);
+    ttrue(net->wheelEntry.next == 0);
+}
+
+
+static void testReschedule()
+{
+    HttpNet     *net;
+    uint64      start;
+
+    net = createNet(10);
+    start = wheel->tick;
+
+    /* Activity is not rescheduled until the entry is due and is then moved to the new deadline */
+    advance(5);
+    net->lastActivity = HTTP->now;
+    ttrue(net->wheelEntry.tick == start + 11);
+    advance(6);
+    ttrue(net->timeoutEvent == 0);
+    ttrue(net->wheelEntry.tick == start + 16);
+
+    advance(4);
+    ttrue(net->timeoutEvent == 0);
+    advance(1);
+    ttrue(net->timeoutEvent != 0);
+    destroyNet(net);
+}
+
+
+static void testCascade()
+{
+    HttpNet     *net;
+    uint64      start, due, rotation;
+
+    /* Start just after a rotation so the entry is not due on a rotation boundary */
+    advance((int) (HTTP_WHEEL_SLOTS - (wheel->tick & (HTTP_WHEEL_SLOTS - 1))) + 1);
+    net = createNet(100);
+    start = wheel->tick;
+    due = start + 101;
+    rotation = due & ~((uint64) HTTP_WHEEL_SLOTS - 1);
+    ttrue(net->wheelEntry.tick == due);
+    ttrue(findLevel(&net->wheelEntry) == 1);
+
+    /* The entry cascades to level 0 when the wheel completes the rotation preceding its tick */
+    advance((int) (rotation - start - 1));
+    ttrue(findLevel(&net->wheelEntry) == 1);
+    advance(1);
+    ttrue(findLevel(&net->wheelEntry) == 0);
+    ttrue(net->timeoutEvent == 0);
+
+    advance((int) (due - rotation - 1));
+    ttrue(net->timeoutEvent == 0);
+    advance(1);
+    ttrue(net->timeoutEvent != 0);
+    destroyNet(net);
+}
+
+
+static void testCancel()
+{
+    HttpNet     *net;
+    HttpStream  *stream, *other;
+    int         count;
+
+    net = createNet(10);
+    count = wheel->count;
+    stream = httpCreateStream(net, 0);
+    other = httpCreateStream(net, 0);
+    ttrue(stream->wheelEntry.next != 0 && stream->wheelEntry.stream == stream);
+    ttrue(wheel->count == count + 2);
+
+    /* Removing a stream unlinks its entry */
+    httpRemoveStream(net, stream);
+    ttrue(stream->wheelEntry.next == 0);
+    ttrue(wheel->count == count + 1);
+
+    /* Destroying the network unlinks the network and its remaining streams */
+    destroyNet(net);
+    ttrue(net->wheelEntry.next == 0 && other->wheelEntry.next == 0);
+    ttrue(wheel->count == count - 1);
+
+    /* Nothing references the collected objects through many rotations */
+    mprGC(MPR_GC_FORCE | MPR_GC_COMPLETE);
+    advance(HTTP_WHEEL_SLOTS * 3);
+    ttrue(wheel->count == count - 1);
+}
+
+
+/*
+    A scheduled network is retained by the wheel even without other references
+ */
+static void testRetain()
+{
+    HttpNet     *net;
+
+    net = createNet(10);
+    mprRemoveRoot(net);
+    mprGC(MPR_GC_FORCE | MPR_GC_COMPLETE);
+    ttrue(mprIsValid(net));
+    ttrue(net->wheelEntry.net == net && !net->destroyed);
+
+    advance(11);
+    ttrue(net->timeoutEvent != 0);
+    httpDestroyNet(net);
+    ttrue(net->wheelEntry.next == 0);
+}
+
+
+int main(int argc, char **argv)
+{
+    HttpNet     *net;
+
+    mprCreate(argc, argv, 0);
+    httpCreate(HTTP_SERVER_SIDE | HTTP_CLIENT_SIDE);
+    wheel = HTTP->wheel;
+    granularity = wheel->granularity;
+
+    /*
+        Creating the first network starts the http timer. Stop it so the tests control the wheel.
+        The timer reference is retained so it is not restarted.
+     */
+    net = createNet(10);
+    mprRemoveEvent(HTTP->timer);
+    destroyNet(net);
+
+    testExpiry();
+    testReschedule();
+    testCascade();
+    testCancel();
+    testRetain();
+    return 0;
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+    Copyright (c) Michael O'Brien. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -0,0 +1,18 @@
+/*
+    benchmark.tst - Test load generation and benchmark results
+ */
+
+require support
+
+//  Closed loop
+let result = deserialize(http("--json -q -i 20 /index.html"))
+ttrue(result.requests == 20)
+ttrue(result.status['2xx'] == 20)
+ttrue(result.latency.p50 <= result.latency.p99)
+ttrue(result.latency.p99 <= result.latency.max)
+
+//  Paced and errors counted
+result = deserialize(http("--json -q --rate 50 --duration 1 /missing.html"))
+ttrue(result.requests >= 40 && result.requests <= 60)
+ttrue(result.status['4xx'] == result.requests)
+ttrue(result.errors.connect == 0)
@@ -0,0 +1,37 @@
+/*
+    compress.tst - Test response compression
+ */
+
+require support
+
+let HOST = tget('TM_HTTP') || 'http://127.0.0.1:4100'
+
+function get(cmd): String {
+    let result = Cmd.run(Cmd.locate('http') + ' --host ' + HOST + ' ' + cmd, {exceptions: false})
+    return result.trim()
+}
+
+//  Compressed if the client accepts gzip
+let headers = get("--showHeaders --header 'Accept-Encoding: gzip' /big.txt")
+ttrue(headers.contains('Content-Encoding: gzip'))
+ttrue(headers.contains('Vary: Accept-Encoding'))
+ttrue(headers.contains('-gzip'))
+
+//  Deflate if gzip is refused
+headers = get("--showHeaders --header 'Accept-Encoding: gzip;q=0, deflate' /big.txt")
+ttrue(headers.contains('Content-Encoding: deflate'))
+
+//  Not compressed otherwise
+ttrue(get("/big.txt") == Path('web/big.txt').readString().trim())
+ttrue(!get("--showHeaders /big.txt").contains('Content-Encoding'))
+
+//  Small responses are not compressed
+ttrue(!get("--showHeaders --header 'Accept-Encoding: gzip' /index.html").contains('Content-Encoding'))
+
+//  HEAD has the same compression headers as GET
+headers = get("--showHeaders --method HEAD --header 'Accept-Encoding: gzip' /big.txt")
+ttrue(headers.contains('Content-Encoding: gzip'))
+ttrue(headers.contains('Vary: Accept-Encoding'))
+ttrue(headers.contains('-gzip'))
+ttrue(!headers.contains('Content-Length: 117004'))
+ttrue(!get("--showHeaders --method HEAD /big.txt").contains('Content-Encoding'))
@@ -0,0 +1,46 @@
+/*
+    loops.tst - Test serving requests on event loop threads
+
+    Starts a second server configured with limits.eventLoops so each loop has its own listening socket.
+ */
+
+require support
+
+const HOST = '127.0.0.1:4200'
+const LOG = Path('loops.log')
+
+function get(cmd): String {
+    let result = Cmd.run(Cmd.locate('http') + ' --http1 --host ' + HOST + ' ' + cmd, {exceptions: false})
+    return result.trim()
+}
+
+LOG.remove()
+let pid = Cmd.daemon(Cmd.locate('server') + ' --config loops.json --log ' + LOG + ':2')
+try {
+    for (let i = 0; i < 50 && !get('--showStatus /index.html').contains('200'); i++) {
+        App.sleep(100)
+    }
+    ttrue(LOG.readString().contains('Using 4 event loops'))
+
+    //  Separate connections are distributed over the loop listeners
+    let index = Path('web/index.html').readString().trim()
+    for (let i = 0; i < 8; i++) {
+        ttrue(get('/index.html') == index)
+    }
+
+    //  Concurrent keep-alive connections
+    let result = deserialize(get('--json -q --threads 4 -i 200 /index.html'))
+    ttrue(result.requests == 800)
+    ttrue(result.status['2xx'] == 800)
+    ttrue(result.errors.connect == 0 && result.errors.io == 0 && result.errors.timeout == 0)
+
+    //  Larger responses that need multiple writes on the loop threads
+    result = deserialize(get('--json -q --threads 4 -i 20 /big.txt'))
+    ttrue(result.status['2xx'] == 80)
+    ttrue(result.errors.io == 0)
+    ttrue(get('/big.txt') == Path('web/big.txt').readString().trim())
+
+} finally {
+    Cmd.kill(pid)
+    LOG.remove()
+}
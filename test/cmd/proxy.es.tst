@@ -0,0 +1,20 @@
+/*
+    proxy.tst - Test the reverse proxy handler
+ */
+
+require support
+
+let HOST = tget('TM_HTTP') || 'http://127.0.0.1:4100'
+
+function get(cmd): String {
+    let result = Cmd.run(Cmd.locate('http') + ' --host ' + HOST + ' ' + cmd, {exceptions: false})
+    return result.trim()
+}
+
+//  Proxied to the same server with the route prefix removed
+ttrue(get('/proxy/index.html') == get('/index.html'))
+ttrue(get('/proxy/big.txt') == Path('web/big.txt').readString().trim())
+
+//  Missing documents are passed through
+ttrue(get('--showStatus /proxy/missing.html').contains('404'))
+
@@ -0,0 +1,25 @@
+/*
+    sendfile.tst - Test static file delivery over plain HTTP/1 where the connector uses sendfile
+ */
+
+require support
+
+let HOST = tget('TM_HTTP') || 'http://127.0.0.1:4100'
+
+function plain(cmd): String {
+    let result = Cmd.run(Cmd.locate('http') + ' --http1 --host ' + HOST + ' ' + cmd, {exceptions: false})
+    return result.trim()
+}
+
+//  Entire file
+ttrue(plain("/big.txt") == Path('web/big.txt').readString().trim())
+
+//  Single and multiple ranges
+ttrue(plain("--range 0-4 /numbers.html") == "01234")
+let data = plain("--range 0-4,6-8 /numbers.html")
+ttrue(data.contains("01234"))
+ttrue(data.contains("678"))
+ttrue(data.contains("Content-Range: bytes 6-8/"))
+
+//  Keep-alive with multiple requests on one connection
+plain("-i 50 /big.txt")
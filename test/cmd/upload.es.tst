@@ -16,3 +16,35 @@ for each (file in uploadDir) {
     break
 }
 cleanDir(uploadDir)
+
+/*
+    Upload throughput over normal and adversarial bodies. Runs of dashes resemble the boundary prefix
+    and defeat a naive scan for the boundary.
+ */
+function makeBody(path: Path, pattern: String, size: Number) {
+    let parts = []
+    for (let len = 0; len < size; len += pattern.length) {
+        parts.push(pattern)
+    }
+    path.write(parts.join(''))
+}
+
+let bodies = {
+    normal: 'The quick brown fox jumps over the lazy dog\r\n',
+    dashes: '--------------------------------------------------\r\n--\r\n',
+}
+for (let [name, pattern] in bodies) {
+    let body = Path(name + '.tmp')
+    makeBody(body, pattern, 4 * 1024 * 1024)
+    let mark = new Date
+    data = http('--upload ' + body + ' /upload/uploadFile.html')
+    let elapsed = mark.elapsed
+    ttrue(data.contains('Upload Complete'))
+    for each (file in uploadDir) {
+        ttrue(file.readString() == body.readString())
+        break
+    }
+    tinfo('Upload', name + ' 4MB in ' + elapsed + ' msec')
+    body.remove()
+    cleanDir(uploadDir)
+}